@@ -0,0 +1,697 @@
+/// \file allocator_benchmark.cpp
+///
+/// Benchmark comparing Syntropy allocators on common allocation patterns.
+///
+/// Each allocator is created anew for each pattern and reports ns/op,
+/// throughput and peak resident set growth over the run. The resident set
+/// is sampled at batch boundaries only, hence transient peaks within a
+/// batch are not captured. Allocators that don't support pointer-level
+/// deallocation are reset between rounds and skip patterns without round
+/// boundaries.
+///
+/// \author Raffaele D. Facendola - April 2021
+
+// ========================================================================= //
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/system_allocator.h"
+#include "syntropy/memory/allocators/concurrent_pool_allocator.h"
+#include "syntropy/memory/allocators/stack_allocator.h"
+#include "syntropy/memory/allocators/virtual_stack_allocator.h"
+#include "syntropy/memory/allocators/tlsf_allocator.h"
+#include "syntropy/memory/allocators/thread_caching_allocator.h"
+
+// ========================================================================= //
+
+using namespace Syntropy;
+using namespace Syntropy::Memory;
+
+namespace
+{
+    /************************************************************************/
+    /* SETTINGS                                                             */
+    /************************************************************************/
+
+    /// \brief Number of blocks allocated in each LIFO / FIFO round.
+    constexpr auto kBatchCount = Int{ 1024 };
+
+    /// \brief Number of rounds for round-based patterns.
+    constexpr auto kRoundCount = Int{ 1024 };
+
+    /// \brief Number of live slots in the random-size pattern.
+    constexpr auto kSlotCount = Int{ 1024 };
+
+    /// \brief Number of blocks transferred by each producer.
+    constexpr auto kTransferCount = Int{ 1 } << 20;
+
+    /// \brief Number of blocks alive during the fragmentation soak.
+    constexpr auto kSoakCount = Int{ 1 } << 14;
+
+    /// \brief Number of replacements performed by the fragmentation soak.
+    constexpr auto kSoakSteps = Int{ 1 } << 22;
+
+    /// \brief Maximum size of each block.
+    constexpr auto kMaxSize = Int{ 1024 };
+
+    /// \brief Alignment of each block.
+    const auto kAlignment = MaxAlignment();
+
+    /************************************************************************/
+    /* RESIDENT SET                                                         */
+    /************************************************************************/
+
+    /// \brief Get the current resident set size of the process, in bytes.
+    Int
+    GetResidentSize() noexcept
+    {
+#if defined(_WIN32)
+
+        auto counters = PROCESS_MEMORY_COUNTERS{};
+
+        GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                             sizeof(counters));
+
+        return static_cast<Int>(counters.WorkingSetSize);
+
+#elif defined(__APPLE__)
+
+        auto info = mach_task_basic_info_data_t{};
+        auto count = mach_msg_type_number_t{ MACH_TASK_BASIC_INFO_COUNT };
+
+        task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info), &count);
+
+        return static_cast<Int>(info.resident_size);
+
+#else
+
+        auto pages = 0ll;
+        auto resident_pages = 0ll;
+
+        if (auto statm = std::fopen("/proc/self/statm", "r"))
+        {
+            std::fscanf(statm, "%lld %lld", &pages, &resident_pages);
+            std::fclose(statm);
+        }
+
+        return resident_pages * sysconf(_SC_PAGESIZE);
+
+#endif
+    }
+
+    /// \brief Tracks the peak resident set growth over a baseline.
+    class Probe
+    {
+    public:
+
+        /// \brief Create a new probe, sampling the baseline.
+        Probe() noexcept
+            : baseline_(GetResidentSize())
+        {
+
+        }
+
+        /// \brief Sample the current resident set size.
+        void
+        Sample() noexcept
+        {
+            auto growth = GetResidentSize() - baseline_;
+            auto peak = peak_.load(std::memory_order_relaxed);
+
+            while ((growth > peak) &&
+                   !peak_.compare_exchange_weak(peak, growth))
+            {
+
+            }
+        }
+
+        /// \brief Get the peak resident set growth sampled so far.
+        Int
+        GetPeak() const noexcept
+        {
+            return peak_.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        /// \brief Resident set size when the probe was created.
+        Int baseline_{ 0 };
+
+        /// \brief Peak resident set growth.
+        std::atomic<Int> peak_{ 0 };
+
+    };
+
+    /************************************************************************/
+    /* UTILITIES                                                            */
+    /************************************************************************/
+
+    /// \brief Generate a sequence of random block sizes in [8; kMaxSize].
+    std::vector<Bytes>
+    MakeSizes(Int count, Int seed) noexcept
+    {
+        auto random = std::mt19937_64(seed);
+        auto distribution = std::uniform_int_distribution<Int>(8, kMaxSize);
+
+        auto sizes = std::vector<Bytes>(count);
+
+        for (auto&& size : sizes)
+        {
+            size = ToBytes(distribution(random));
+        }
+
+        return sizes;
+    }
+
+    /// \brief Allocate a block, touching its first byte.
+    template <typename TAllocator>
+    RWByteSpan
+    Allocate(Mutable<TAllocator> allocator, Bytes size) noexcept
+    {
+        auto block = allocator.Allocate(size, kAlignment);
+
+        if (!block)
+        {
+            std::fprintf(stderr, "Out of memory.\n");
+            std::abort();
+        }
+
+        block[ToBytes(0)] = Byte{ 1 };
+
+        return block;
+    }
+
+    /// \brief Reset allocators which don't support pointer-level
+    ///        deallocation.
+    template <typename TAllocator>
+    void
+    Reset(Mutable<TAllocator> allocator, Bool reclaims) noexcept
+    {
+        if constexpr (requires { allocator.DeallocateAll(); })
+        {
+            if (!reclaims)
+            {
+                allocator.DeallocateAll();
+            }
+        }
+    }
+
+    /// \brief Serializes accesses to an allocator that is not thread-safe.
+    template <typename TAllocator>
+    class Locked
+    {
+    public:
+
+        /// \brief Create a new allocator.
+        template <typename... TArguments>
+        Locked(Forwarding<TArguments>... arguments) noexcept
+            : allocator_(Forward<TArguments>(arguments)...)
+        {
+
+        }
+
+        /// \brief Allocate a new memory block.
+        RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept
+        {
+            auto lock = std::lock_guard<std::mutex>(mutex_);
+
+            return allocator_.Allocate(size, alignment);
+        }
+
+        /// \brief Deallocate a memory block.
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+        {
+            auto lock = std::lock_guard<std::mutex>(mutex_);
+
+            allocator_.Deallocate(block, alignment);
+        }
+
+    private:
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Mutex guarding the underlying allocator.
+        std::mutex mutex_;
+
+    };
+
+    /// \brief A bounded single-producer single-consumer queue of blocks.
+    class Channel
+    {
+    public:
+
+        /// \brief Push a block, waiting while the channel is full.
+        void
+        Push(Immutable<RWByteSpan> block) noexcept
+        {
+            auto tail = tail_.load(std::memory_order_relaxed);
+
+            while (tail - head_.load(std::memory_order_acquire) == kSize)
+            {
+                std::this_thread::yield();
+            }
+
+            blocks_[tail % kSize] = block;
+
+            tail_.store(tail + 1, std::memory_order_release);
+        }
+
+        /// \brief Pop a block, waiting while the channel is empty.
+        RWByteSpan
+        Pop() noexcept
+        {
+            auto head = head_.load(std::memory_order_relaxed);
+
+            while (tail_.load(std::memory_order_acquire) == head)
+            {
+                std::this_thread::yield();
+            }
+
+            auto block = blocks_[head % kSize];
+
+            head_.store(head + 1, std::memory_order_release);
+
+            return block;
+        }
+
+    private:
+
+        /// \brief Channel capacity.
+        static constexpr Int kSize = 1024;
+
+        /// \brief Index of the next block to pop.
+        alignas(64) std::atomic<Int> head_{ 0 };
+
+        /// \brief Index of the next block to push.
+        alignas(64) std::atomic<Int> tail_{ 0 };
+
+        /// \brief Blocks in flight.
+        RWByteSpan blocks_[kSize];
+
+    };
+
+    /************************************************************************/
+    /* PATTERNS                                                             */
+    /************************************************************************/
+
+    /// \brief Allocate a batch and deallocate it in reverse order.
+    template <typename TAllocator>
+    Int
+    RunLIFO(Mutable<TAllocator> allocator,
+            Mutable<Probe> probe,
+            Bool reclaims) noexcept
+    {
+        auto sizes = MakeSizes(kBatchCount, 1);
+        auto blocks = std::vector<RWByteSpan>(kBatchCount);
+
+        for (auto round = 0; round < kRoundCount; ++round)
+        {
+            for (auto index = 0; index < kBatchCount; ++index)
+            {
+                blocks[index] = Allocate(allocator, sizes[index]);
+            }
+
+            probe.Sample();
+
+            for (auto index = kBatchCount - 1; index >= 0; --index)
+            {
+                allocator.Deallocate(blocks[index], kAlignment);
+            }
+
+            Reset(allocator, reclaims);
+        }
+
+        return kRoundCount * kBatchCount * 2;
+    }
+
+    /// \brief Allocate a batch and deallocate it in the same order.
+    template <typename TAllocator>
+    Int
+    RunFIFO(Mutable<TAllocator> allocator,
+            Mutable<Probe> probe,
+            Bool reclaims) noexcept
+    {
+        auto sizes = MakeSizes(kBatchCount, 2);
+        auto blocks = std::vector<RWByteSpan>(kBatchCount);
+
+        for (auto round = 0; round < kRoundCount; ++round)
+        {
+            for (auto index = 0; index < kBatchCount; ++index)
+            {
+                blocks[index] = Allocate(allocator, sizes[index]);
+            }
+
+            probe.Sample();
+
+            for (auto index = 0; index < kBatchCount; ++index)
+            {
+                allocator.Deallocate(blocks[index], kAlignment);
+            }
+
+            Reset(allocator, reclaims);
+        }
+
+        return kRoundCount * kBatchCount * 2;
+    }
+
+    /// \brief Randomly allocate or deallocate blocks of random size.
+    template <typename TAllocator>
+    Int
+    RunRandom(Mutable<TAllocator> allocator,
+              Mutable<Probe> probe,
+              Bool reclaims) noexcept
+    {
+        auto sizes = MakeSizes(kSlotCount * 4, 3);
+        auto slots = std::vector<RWByteSpan>(kSlotCount);
+
+        auto random = std::mt19937_64(4);
+        auto operations = Int{ 0 };
+
+        for (auto round = 0; round < kRoundCount; ++round)
+        {
+            for (auto step = 0; step < kSlotCount * 2; ++step)
+            {
+                auto index = static_cast<Int>(random() % kSlotCount);
+
+                if (auto&& slot = slots[index]; slot)
+                {
+                    allocator.Deallocate(slot, kAlignment);
+                    slot = {};
+                }
+                else
+                {
+                    auto size = sizes[(step + round) % sizes.size()];
+
+                    slot = Allocate(allocator, size);
+                }
+
+                ++operations;
+            }
+
+            probe.Sample();
+
+            for (auto&& slot : slots)
+            {
+                if (slot)
+                {
+                    allocator.Deallocate(slot, kAlignment);
+                    slot = {};
+
+                    ++operations;
+                }
+            }
+
+            Reset(allocator, reclaims);
+        }
+
+        return operations;
+    }
+
+    /// \brief Allocate blocks on producer threads and deallocate them on
+    ///        consumer threads.
+    template <typename TAllocator>
+    Int
+    RunProducerConsumer(Mutable<TAllocator> allocator,
+                        Mutable<Probe> probe) noexcept
+    {
+        auto pair_count = Int{ std::thread::hardware_concurrency() / 2 };
+
+        pair_count = (pair_count < 1) ? 1 : (pair_count > 4) ? 4 : pair_count;
+
+        auto channels = std::vector<Channel>(pair_count);
+        auto threads = std::vector<std::thread>{};
+        auto done = std::atomic<Int>{ 0 };
+
+        for (auto pair = 0; pair < pair_count; ++pair)
+        {
+            threads.emplace_back([&, pair]()
+            {
+                auto sizes = MakeSizes(kBatchCount, 5 + pair);
+
+                for (auto index = 0; index < kTransferCount; ++index)
+                {
+                    auto size = sizes[index % kBatchCount];
+
+                    channels[pair].Push(Allocate(allocator, size));
+                }
+            });
+
+            threads.emplace_back([&, pair]()
+            {
+                for (auto index = 0; index < kTransferCount; ++index)
+                {
+                    allocator.Deallocate(channels[pair].Pop(), kAlignment);
+                }
+
+                ++done;
+            });
+        }
+
+        while (done.load() < pair_count)
+        {
+            probe.Sample();
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+
+        return pair_count * kTransferCount * 2;
+    }
+
+    /// \brief Keep a large set of blocks alive, replacing random blocks
+    ///        with blocks of a different size.
+    template <typename TAllocator>
+    Int
+    RunSoak(Mutable<TAllocator> allocator,
+            Mutable<Probe> probe) noexcept
+    {
+        auto sizes = MakeSizes(kSoakCount * 4, 6);
+        auto blocks = std::vector<RWByteSpan>(kSoakCount);
+
+        auto random = std::mt19937_64(7);
+
+        for (auto index = 0; index < kSoakCount; ++index)
+        {
+            blocks[index] = Allocate(allocator, sizes[index]);
+        }
+
+        for (auto step = 0; step < kSoakSteps; ++step)
+        {
+            auto&& block = blocks[random() % kSoakCount];
+
+            allocator.Deallocate(block, kAlignment);
+
+            block = Allocate(allocator, sizes[step % sizes.size()]);
+
+            if ((step % 4096) == 0)
+            {
+                probe.Sample();
+            }
+        }
+
+        for (auto&& block : blocks)
+        {
+            allocator.Deallocate(block, kAlignment);
+        }
+
+        return kSoakCount * 2 + kSoakSteps * 2;
+    }
+
+    /************************************************************************/
+    /* RUNNER                                                               */
+    /************************************************************************/
+
+    /// \brief Run a pattern on a new allocator and print the result.
+    template <typename TFactory, typename TPattern>
+    void
+    Run(Ptr<char> allocator_name,
+        Ptr<char> pattern_name,
+        Immutable<TFactory> factory,
+        Immutable<TPattern> pattern,
+        Bool reclaims) noexcept
+    {
+        auto probe = Probe{};
+        auto allocator = factory();
+
+        auto start = std::chrono::steady_clock::now();
+
+        auto operations = pattern(*allocator, probe, reclaims);
+
+        auto end = std::chrono::steady_clock::now();
+
+        probe.Sample();
+
+        auto seconds = std::chrono::duration<double>(end - start).count();
+
+        std::printf("%-22s %-18s %12lld %9.2f %9.2f %12.2f\n",
+                    allocator_name,
+                    pattern_name,
+                    static_cast<long long>(operations),
+                    seconds * 1e9 / operations,
+                    operations / seconds * 1e-6,
+                    probe.GetPeak() / (1024.0 * 1024.0));
+    }
+
+    /// \brief Print a skipped pattern.
+    void
+    Skip(Ptr<char> allocator_name,
+         Ptr<char> pattern_name) noexcept
+    {
+        std::printf("%-22s %-18s %12s\n", allocator_name, pattern_name,
+                    "n/a");
+    }
+
+    /// \brief Run every pattern on an allocator.
+    ///
+    /// \param factory Creates a new allocator.
+    /// \param locked_factory Creates a new thread-safe allocator.
+    /// \param reclaims Whether the allocator supports pointer-level
+    ///                 deallocation.
+    template <typename TFactory, typename TLockedFactory>
+    void
+    RunAll(Ptr<char> name,
+           Immutable<TFactory> factory,
+           Immutable<TLockedFactory> locked_factory,
+           Bool reclaims) noexcept
+    {
+        auto lifo = [](auto& allocator, auto& probe, auto reclaims)
+        {
+            return RunLIFO(allocator, probe, reclaims);
+        };
+
+        auto fifo = [](auto& allocator, auto& probe, auto reclaims)
+        {
+            return RunFIFO(allocator, probe, reclaims);
+        };
+
+        auto random = [](auto& allocator, auto& probe, auto reclaims)
+        {
+            return RunRandom(allocator, probe, reclaims);
+        };
+
+        // Patterns without round boundaries only run on allocators that
+        // reclaim memory.
+
+        auto producer_consumer = [](auto& allocator, auto& probe, auto)
+        {
+            return RunProducerConsumer(allocator, probe);
+        };
+
+        auto soak = [](auto& allocator, auto& probe, auto)
+        {
+            return RunSoak(allocator, probe);
+        };
+
+        Run(name, "lifo", factory, lifo, reclaims);
+        Run(name, "fifo", factory, fifo, reclaims);
+        Run(name, "random-size", factory, random, reclaims);
+
+        if (reclaims)
+        {
+            Run(name, "producer-consumer", locked_factory, producer_consumer,
+                reclaims);
+
+            Run(name, "fragmentation-soak", factory, soak, reclaims);
+        }
+        else
+        {
+            Skip(name, "producer-consumer");
+            Skip(name, "fragmentation-soak");
+        }
+    }
+}
+
+// ========================================================================= //
+
+int main()
+{
+    using TPool = ConcurrentPoolAllocator<SystemAllocator>;
+    using TStack = StackAllocator<SystemAllocator>;
+    using TTLSF = TLSFAllocator<SystemAllocator>;
+
+    std::printf("Peak RSS is sampled at batch boundaries only.\n\n");
+
+    std::printf("%-22s %-18s %12s %9s %9s %12s\n",
+                "allocator", "pattern", "ops", "ns/op", "Mops/s",
+                "peak rss MiB");
+
+    RunAll("system",
+           []() { return std::make_unique<SystemAllocator>(); },
+           []() { return std::make_unique<SystemAllocator>(); },
+           true);
+
+    RunAll("concurrent-pool",
+           []()
+           {
+               return std::make_unique<TPool>(
+                   ToBytes(kMaxSize), kAlignment, ToBytes(1 << 20), 64);
+           },
+           []()
+           {
+               return std::make_unique<TPool>(
+                   ToBytes(kMaxSize), kAlignment, ToBytes(1 << 20), 64);
+           },
+           true);
+
+    RunAll("thread-caching",
+           []() { return std::make_unique<ThreadCachingAllocator>(); },
+           []() { return std::make_unique<ThreadCachingAllocator>(); },
+           true);
+
+    RunAll("stack",
+           []() { return std::make_unique<TStack>(ToBytes(1 << 20)); },
+           []() { return std::make_unique<Locked<TStack>>(ToBytes(1 << 20)); },
+           false);
+
+    RunAll("virtual-stack",
+           []()
+           {
+               return std::make_unique<VirtualStackAllocator>(
+                   ToBytes(Int{ 1 } << 32), ToBytes(1 << 16));
+           },
+           []()
+           {
+               return std::make_unique<Locked<VirtualStackAllocator>>(
+                   ToBytes(Int{ 1 } << 32), ToBytes(1 << 16));
+           },
+           false);
+
+    RunAll("tlsf (locked on mt)",
+           []() { return std::make_unique<TTLSF>(ToBytes(1 << 22)); },
+           []() { return std::make_unique<Locked<TTLSF>>(ToBytes(1 << 22)); },
+           true);
+
+    return 0;
+}
+
+// ========================================================================= //
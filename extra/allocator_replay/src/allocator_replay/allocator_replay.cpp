@@ -0,0 +1,403 @@
+/// \file allocator_replay.cpp
+///
+/// Replays an allocation trace recorded by a TracingAllocator on Syntropy
+/// allocators, to compare them on real allocation behavior.
+///
+/// Events are replayed on a single thread, in the order they were
+/// recorded. Each allocator is created anew and reports ns/op, peak live
+/// memory, peak resident set growth and fragmentation, the fraction of
+/// the peak resident set growth not accounted for by live blocks.
+/// Allocated blocks are written once per page, which is included in the
+/// measured time.
+///
+/// The resident set is sampled periodically and after the last event,
+/// for the whole process: memory retained by the system heap after an
+/// allocator is destroyed hides part of the footprint of the allocators
+/// replayed after it. Replay a single allocator per process for accurate
+/// footprints.
+///
+/// \usage allocator_replay <trace-file> [allocator]
+///
+/// \author Raffaele D. Facendola - May 2021
+
+// ========================================================================= //
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/system_allocator.h"
+#include "syntropy/memory/allocators/tlsf_allocator.h"
+#include "syntropy/memory/allocators/thread_caching_allocator.h"
+#include "syntropy/memory/allocators/segregated_allocator.h"
+#include "syntropy/memory/allocators/tracing_allocator.h"
+
+// ========================================================================= //
+
+using namespace Syntropy;
+using namespace Syntropy::Memory;
+
+namespace
+{
+    /************************************************************************/
+    /* SETTINGS                                                             */
+    /************************************************************************/
+
+    /// \brief Number of operations between two resident set samples.
+    constexpr auto kSampleInterval = Int{ 4096 };
+
+    /// \brief Stride of writes touching each allocated block, such that
+    ///        every page of the block becomes resident.
+    constexpr auto kTouchStride = Int{ 4096 };
+
+    /************************************************************************/
+    /* RESIDENT SET                                                         */
+    /************************************************************************/
+
+    /// \brief Get the current resident set size of the process, in bytes.
+    Int
+    GetResidentSize() noexcept
+    {
+#if defined(_WIN32)
+
+        auto counters = PROCESS_MEMORY_COUNTERS{};
+
+        GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                             sizeof(counters));
+
+        return static_cast<Int>(counters.WorkingSetSize);
+
+#elif defined(__APPLE__)
+
+        auto info = mach_task_basic_info_data_t{};
+        auto count = mach_msg_type_number_t{ MACH_TASK_BASIC_INFO_COUNT };
+
+        task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info), &count);
+
+        return static_cast<Int>(info.resident_size);
+
+#else
+
+        auto pages = 0ll;
+        auto resident_pages = 0ll;
+
+        if (auto statm = std::fopen("/proc/self/statm", "r"))
+        {
+            std::fscanf(statm, "%lld %lld", &pages, &resident_pages);
+            std::fclose(statm);
+        }
+
+        return resident_pages * sysconf(_SC_PAGESIZE);
+
+#endif
+    }
+
+    /************************************************************************/
+    /* TRACE                                                                */
+    /************************************************************************/
+
+    /// \brief A replayable operation.
+    struct Operation
+    {
+        /// \brief Slot the block is stored in while alive.
+        Int slot_{ 0 };
+
+        /// \brief Block size. Negative for deallocations.
+        Int size_{ 0 };
+
+        /// \brief Block alignment.
+        Alignment alignment_;
+    };
+
+    /// \brief A trace, translated to replayable operations.
+    struct Trace
+    {
+        /// \brief Operations, in replay order.
+        std::vector<Operation> operations_;
+
+        /// \brief Number of slots needed to hold blocks alive at once.
+        Int slot_count_{ 0 };
+
+        /// \brief Number of events discarded, because they refer to blocks
+        ///        allocated before the trace began.
+        Int discarded_count_{ 0 };
+
+        /// \brief Number of threads appearing in the trace.
+        Int thread_count_{ 0 };
+    };
+
+    /// \brief Load a trace file.
+    ///
+    /// Addresses are translated to slots which are recycled once the
+    /// block they hold is deallocated, so that replaying doesn't need
+    /// any lookup.
+    Bool
+    LoadTrace(Ptr<char> path, Mutable<Trace> trace) noexcept
+    {
+        auto file = std::fopen(path, "rb");
+
+        if (!file)
+        {
+            std::fprintf(stderr, "Cannot open '%s'.\n", path);
+            return false;
+        }
+
+        auto header = AllocationTraceHeader{};
+
+        if ((std::fread(&header, sizeof(header), 1, file) != 1) ||
+            (header.magic_ != AllocationTraceHeader::kMagic) ||
+            (header.version_ != AllocationTraceHeader::kVersion))
+        {
+            std::fprintf(stderr, "'%s' is not a valid trace file.\n", path);
+            std::fclose(file);
+            return false;
+        }
+
+        auto live = std::unordered_map<Int, Int>{};
+        auto free_slots = std::vector<Int>{};
+
+        auto event = AllocationEvent{};
+
+        while (std::fread(&event, sizeof(event), 1, file) == 1)
+        {
+            auto thread = static_cast<Int>(event.thread_) + 1;
+
+            trace.thread_count_ = (thread > trace.thread_count_)
+                ? thread
+                : trace.thread_count_;
+
+            auto alignment = ToAlignment(Int{ 1 } << ToInt(event.alignment_));
+
+            if (event.kind_ == AllocationEventKind::kAllocate)
+            {
+                auto slot = trace.slot_count_;
+
+                if (!free_slots.empty())
+                {
+                    slot = free_slots.back();
+                    free_slots.pop_back();
+                }
+                else
+                {
+                    ++trace.slot_count_;
+                }
+
+                live[event.address_] = slot;
+
+                trace.operations_.push_back({ slot, event.size_, alignment });
+            }
+            else if (auto it = live.find(event.address_); it != live.end())
+            {
+                trace.operations_.push_back({ it->second, -1, alignment });
+
+                free_slots.push_back(it->second);
+                live.erase(it);
+            }
+            else
+            {
+                ++trace.discarded_count_;
+            }
+        }
+
+        std::fclose(file);
+
+        return true;
+    }
+
+    /************************************************************************/
+    /* REPLAY                                                               */
+    /************************************************************************/
+
+    /// \brief Replay a trace on an allocator and print the result.
+    template <Templates::Allocator TAllocator>
+    void
+    Replay(Ptr<char> name,
+           Immutable<Trace> trace,
+           Mutable<TAllocator> allocator) noexcept
+    {
+        auto slots = std::vector<RWByteSpan>(trace.slot_count_);
+        auto alignments = std::vector<Alignment>(trace.slot_count_);
+
+        auto baseline = GetResidentSize();
+
+        auto live_size = Int{ 0 };
+        auto peak_live_size = Int{ 0 };
+        auto peak_resident_size = Int{ 0 };
+        auto failure_count = Int{ 0 };
+
+        auto elapsed = std::chrono::steady_clock::duration{};
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (auto index = 0ull; index < trace.operations_.size(); ++index)
+        {
+            auto& operation = trace.operations_[index];
+            auto& slot = slots[operation.slot_];
+
+            if (operation.size_ >= 0)
+            {
+                slot = allocator.Allocate(Bytes{ operation.size_ },
+                                          operation.alignment_);
+
+                alignments[operation.slot_] = operation.alignment_;
+
+                for (auto offset = 0; offset < ToInt(slot.GetCount());
+                     offset += kTouchStride)
+                {
+                    slot[ToBytes(offset)] = Byte{ 1 };
+                }
+
+                failure_count += slot ? 0 : 1;
+                live_size += ToInt(slot.GetCount());
+            }
+            else if (slot)
+            {
+                live_size -= ToInt(slot.GetCount());
+
+                allocator.Deallocate(slot, operation.alignment_);
+
+                slot = {};
+            }
+
+            // Sampling is excluded from the measured time. The last
+            // operation is always sampled, such that the resident set
+            // growth of the trace tail is accounted for.
+
+            if (((index % kSampleInterval) == 0)
+                || (index + 1 == trace.operations_.size()))
+            {
+                auto now = std::chrono::steady_clock::now();
+
+                elapsed += now - start;
+
+                auto resident_size = GetResidentSize() - baseline;
+
+                peak_resident_size = (resident_size > peak_resident_size)
+                    ? resident_size
+                    : peak_resident_size;
+
+                start = std::chrono::steady_clock::now();
+            }
+
+            peak_live_size = (live_size > peak_live_size)
+                ? live_size
+                : peak_live_size;
+        }
+
+        elapsed += std::chrono::steady_clock::now() - start;
+
+        // Blocks still alive when the trace ended.
+
+        for (auto index = 0ull; index < slots.size(); ++index)
+        {
+            if (slots[index])
+            {
+                allocator.Deallocate(slots[index], alignments[index]);
+            }
+        }
+
+        auto seconds = std::chrono::duration<double>(elapsed).count();
+        auto count = static_cast<double>(trace.operations_.size());
+
+        auto fragmentation = (peak_resident_size > peak_live_size)
+            ? 1.0 - static_cast<double>(peak_live_size) / peak_resident_size
+            : 0.0;
+
+        std::printf("%-22s %9.2f %14.2f %14.2f %8.1f%% %9lld\n",
+                    name,
+                    seconds * 1e9 / count,
+                    peak_live_size / (1024.0 * 1024.0),
+                    peak_resident_size / (1024.0 * 1024.0),
+                    fragmentation * 100.0,
+                    static_cast<long long>(failure_count));
+    }
+
+}
+
+// ========================================================================= //
+
+int main(int argc, char** argv)
+{
+    if ((argc != 2) && (argc != 3))
+    {
+        std::fprintf(stderr, "Usage: %s <trace-file> [allocator]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    auto filter = (argc == 3) ? argv[2] : nullptr;
+
+    auto is_selected = [filter](Ptr<char> name)
+    {
+        return !filter || (std::strcmp(filter, name) == 0);
+    };
+
+    auto trace = Trace{};
+
+    if (!LoadTrace(argv[1], trace))
+    {
+        return 1;
+    }
+
+    std::printf("%lld operations, %lld threads, %lld discarded events.\n\n",
+                static_cast<long long>(trace.operations_.size()),
+                static_cast<long long>(trace.thread_count_),
+                static_cast<long long>(trace.discarded_count_));
+
+    std::printf("%-22s %9s %14s %14s %9s %9s\n",
+                "allocator", "ns/op", "peak live MiB", "peak rss MiB",
+                "frag", "failures");
+
+    if (is_selected("system"))
+    {
+        auto allocator = std::make_unique<SystemAllocator>();
+
+        Replay("system", trace, *allocator);
+    }
+
+    if (is_selected("thread-caching"))
+    {
+        auto allocator = std::make_unique<ThreadCachingAllocator>();
+
+        Replay("thread-caching", trace, *allocator);
+    }
+
+    if (is_selected("tlsf"))
+    {
+        auto allocator = std::make_unique<TLSFAllocator<SystemAllocator>>(
+            ToBytes(1 << 22));
+
+        Replay("tlsf", trace, *allocator);
+    }
+
+    if (is_selected("segregated"))
+    {
+        auto allocator = std::make_unique<
+            SegregatedAllocator<SystemAllocator>>(ToBytes(Int{ 1 } << 32));
+
+        Replay("segregated", trace, *allocator);
+    }
+
+    return 0;
+}
+
+// ========================================================================= //
@@ -0,0 +1,251 @@
+/// \file compact_unique_ptr.h
+///
+/// \brief This header is part of Syntropy core module.
+/// It contains definitions for exclusive-ownership smart pointers bound to
+/// stateless allocators.
+///
+/// \author Raffaele D. Facendola - May 2021
+
+// ===========================================================================
+
+#pragma once
+
+#include <new>
+
+#include "syntropy/language/foundation/foundation.h"
+#include "syntropy/language/templates/concepts.h"
+#include "syntropy/core/algorithms/compare.h"
+#include "syntropy/core/foundation/unique_ptr.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+#include "syntropy/memory/allocators/system_allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* BASE COMPACT UNIQUE PTR                                              */
+    /************************************************************************/
+
+    /// \brief Represents a pointer that hold exclusive ownership of an
+    ///        object allocated on a stateless allocator and deletes it when
+    ///        going out of scope.
+    ///
+    /// Unlike BaseUniquePtr, neither the allocator nor the allocation size
+    /// are stored: the allocator type is part of the pointer type and the
+    /// size is derived from the pointee type. The allocator is an empty
+    /// base, therefore the pointer is as large as a raw pointer.
+    ///
+    /// \remarks The dynamic type of the pointee must be exactly TType, as
+    ///          the pointee is deallocated with the size of TType.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    class BaseCompactUniquePtr : private TAllocator
+    {
+    public:
+
+        /// \brief Pointer type.
+        using TPointer = typename TTraits::TPointer;
+
+        /// \brief Reference type.
+        using TReference = typename TTraits::TReference;
+
+        /// \brief Create an empty pointer.
+        BaseCompactUniquePtr() noexcept = default;
+
+        /// \brief Create an empty pointer.
+        BaseCompactUniquePtr(Null rhs) noexcept;
+
+        /// \brief No copy-constructor: ownership of the pointee is exclusive.
+        BaseCompactUniquePtr(Immutable<BaseCompactUniquePtr> rhs) = delete;
+
+        /// \brief Move constructor.
+        template <typename UTraits>
+        BaseCompactUniquePtr(
+            Movable<BaseCompactUniquePtr<TType, UTraits, TAllocator>> rhs)
+            noexcept;
+
+        /// \brief Acquire an object's ownership.
+        ///
+        /// \remarks Accessing the object instance through the provided pointer
+        ///          after this call results in undefined behavior.
+        /// \remarks The object must have been allocated on TAllocator with
+        ///          the size and alignment of TType, otherwise the behavior
+        ///          of this method is undefined.
+        explicit
+        BaseCompactUniquePtr(RWPtr<TType> pointee) noexcept;
+
+        /// \brief Destroy the underlying object.
+        ~BaseCompactUniquePtr() noexcept;
+
+        /// \brief Assign a new object to the pointer, causing existing
+        ///        instances to be destroyed as a result of this method.
+        template <typename UTraits>
+        Mutable<BaseCompactUniquePtr>
+        operator=(Movable<BaseCompactUniquePtr<TType, UTraits, TAllocator>>
+                  rhs) noexcept;
+
+        /// \brief Destroy the pointed object and reset the pointer.
+        Mutable<BaseCompactUniquePtr>
+        operator=(Null rhs) noexcept;
+
+        /// \brief Check whether the pointed object is non-null.
+        [[nodiscard]] explicit
+        operator Bool() const noexcept;
+
+        /// \brief Access the pointed object.
+        /// \remarks If the pointed object is null, accessing the returned
+        ///          value results in undefined behavior.
+        [[nodiscard]] TReference
+        operator*() const noexcept;
+
+        /// \brief Access the pointed object.
+        [[nodiscard]] TPointer
+        operator->() const noexcept;
+
+        /// \brief Reset the pointer, destroying the pointee object (if valid).
+        void Reset() noexcept;
+
+        /// \brief Transfer the ownership of the pointee to the caller.
+        [[nodiscard]] TPointer
+        Release() noexcept;
+
+        /// \brief Access the pointed object.
+        [[nodiscard]] TPointer
+        Get() const noexcept;
+
+        /// \brief Get the size of the pointed object, in Bytes.
+        [[nodiscard]] static constexpr Memory::Bytes
+        GetSize() noexcept;
+
+        /// \brief Get the allocator the pointed object was allocated on.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Get the allocator the pointed object was allocated on.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief Pointed object.
+        /// The underlying pointer has to be read-write in order for it to
+        /// be destroyed.
+        RWPtr<TType> pointee_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* COMPACT UNIQUE PTR                                                   */
+    /************************************************************************/
+
+    /// \brief Represents a compact owning pointer to a read-only value.
+    template <typename TType,
+              Templates::StatelessAllocator TAllocator
+                  = Memory::SystemAllocator>
+    using CompactUniquePtr
+        = BaseCompactUniquePtr<TType, UniquePtrTypeTraits<TType>, TAllocator>;
+
+    /************************************************************************/
+    /* RW COMPACT UNIQUE PTR                                                */
+    /************************************************************************/
+
+    /// \brief Represents a compact owning pointer to a read-write value.
+    template <typename TType,
+              Templates::StatelessAllocator TAllocator
+                  = Memory::SystemAllocator>
+    using RWCompactUniquePtr
+        = BaseCompactUniquePtr<TType, RWUniquePtrTypeTraits<TType>, TAllocator>;
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Comparison.
+    // ===========
+
+    /// \brief Check whether two compact unique pointers refer to the same
+    ///        underlying object.
+    template <typename TType, typename TTraits, typename TAllocator,
+              typename UType, typename UTraits, typename UAllocator>
+    [[nodiscard]] Bool
+    operator==(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Immutable<BaseCompactUniquePtr<UType, UTraits, UAllocator>> rhs)
+        noexcept;
+
+    /// \brief Check whether lhs is empty.
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] Bool
+    operator==(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Null rhs) noexcept;
+
+    /// \brief Compare two compact unique pointers.
+    template <typename TType, typename TTraits, typename TAllocator,
+              typename UType, typename UTraits, typename UAllocator>
+    [[nodiscard]] Ordering
+    operator<=>(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Immutable<BaseCompactUniquePtr<UType, UTraits, UAllocator>> rhs)
+        noexcept;
+
+    /// \brief Compare a compact unique pointer against a null pointer.
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] Ordering
+    operator<=>(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Null rhs) noexcept;
+
+    // Access.
+    // =======
+
+    /// \brief Convert rhs to a read-only compact unique pointer.
+    /// \remarks To preserve uniqueness, rhs is moved from.
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] CompactUniquePtr<TType, TAllocator>
+    ToReadOnly(Movable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> rhs)
+        noexcept;
+
+    /// \brief Convert rhs to a read-write compact unique pointer.
+    /// \remarks If the original pointer is not read-writable, accessing
+    ///          the returned values results in undefined behavior.
+    /// \remarks To preserve uniqueness, rhs is moved from.
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] RWCompactUniquePtr<TType, TAllocator>
+    ToReadWrite(Movable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> rhs)
+        noexcept;
+
+    // Utilities.
+    // ==========
+
+    /// \brief Allocate a new object on a stateless allocator.
+    /// If the object could not be allocated, returns an empty pointer.
+    template <typename TType,
+              Templates::StatelessAllocator TAllocator
+                  = Memory::SystemAllocator,
+              typename... TArguments>
+    [[nodiscard]] CompactUniquePtr<TType, TAllocator>
+    MakeCompactUnique(Forwarding<TArguments>... arguments) noexcept;
+
+    /// \brief Allocate a new object on a stateless allocator.
+    /// If the object could not be allocated, returns an empty pointer.
+    template <typename TType,
+              Templates::StatelessAllocator TAllocator
+                  = Memory::SystemAllocator,
+              typename... TArguments>
+    [[nodiscard]] RWCompactUniquePtr<TType, TAllocator>
+    MakeRWCompactUnique(Forwarding<TArguments>... arguments) noexcept;
+
+}
+
+// ===========================================================================
+
+#include "details/compact_unique_ptr.inl"
+
+// ===========================================================================
@@ -0,0 +1,294 @@
+/// \file compact_unique_ptr.inl
+///
+/// \author Raffaele D. Facendola - May 2021
+
+#pragma once
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* BASE COMPACT UNIQUE PTR                                              */
+    /************************************************************************/
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    inline BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::BaseCompactUniquePtr(Null rhs) noexcept
+        : BaseCompactUniquePtr()
+    {
+
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    template <typename UTraits>
+    inline BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::BaseCompactUniquePtr(
+        Movable<BaseCompactUniquePtr<TType, UTraits, TAllocator>> rhs)
+        noexcept
+        : pointee_(const_cast<RWPtr<TType>>(rhs.Release()))
+    {
+
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    inline BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::BaseCompactUniquePtr(RWPtr<TType> pointee) noexcept
+        : pointee_(pointee)
+    {
+
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    inline BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::~BaseCompactUniquePtr() noexcept
+    {
+        Reset();
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    template <typename UTraits>
+    inline Mutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>>
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::operator=(Movable<BaseCompactUniquePtr<TType, UTraits, TAllocator>>
+                rhs) noexcept
+    {
+        auto pointee = const_cast<RWPtr<TType>>(rhs.Release());
+
+        Reset();
+
+        pointee_ = pointee;
+
+        return *this;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    inline Mutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>>
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::operator=(Null rhs) noexcept
+    {
+        Reset();
+
+        return *this;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::operator Bool() const noexcept
+    {
+        return !!pointee_;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline auto
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::operator*() const noexcept -> TReference
+    {
+        SYNTROPY_ASSERT(pointee_);
+
+        return *pointee_;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline auto
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::operator->() const noexcept -> TPointer
+    {
+        return pointee_;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    inline void BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::Reset() noexcept
+    {
+        if (pointee_)
+        {
+            pointee_->~TType();
+
+            auto block = Memory::MakeByteSpan(Memory::ToBytePtr(pointee_),
+                                              GetSize());
+
+            GetAllocator().Deallocate(block, Memory::AlignmentOf<TType>());
+
+            pointee_ = nullptr;
+        }
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline auto
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::Release() noexcept -> TPointer
+    {
+        auto pointee = pointee_;
+
+        pointee_ = nullptr;
+
+        return pointee;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline auto
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::Get() const noexcept -> TPointer
+    {
+        return pointee_;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline constexpr Memory::Bytes
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::GetSize() noexcept
+    {
+        return Memory::SizeOf<TType>();
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator>
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::GetAllocator() noexcept
+    {
+        return *this;
+    }
+
+    template <typename TType,
+              typename TTraits,
+              Templates::StatelessAllocator TAllocator>
+    [[nodiscard]] inline Immutable<TAllocator>
+    BaseCompactUniquePtr<TType, TTraits, TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return *this;
+    }
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Comparison.
+    // ===========
+
+    template <typename TType, typename TTraits, typename TAllocator,
+              typename UType, typename UTraits, typename UAllocator>
+    [[nodiscard]] inline Bool
+    operator==(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Immutable<BaseCompactUniquePtr<UType, UTraits, UAllocator>> rhs)
+        noexcept
+    {
+        return lhs.Get() == rhs.Get();
+    }
+
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] inline Bool
+    operator==(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Null rhs) noexcept
+    {
+        return !lhs;
+    }
+
+    template <typename TType, typename TTraits, typename TAllocator,
+              typename UType, typename UTraits, typename UAllocator>
+    [[nodiscard]] inline Ordering
+    operator<=>(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Immutable<BaseCompactUniquePtr<UType, UTraits, UAllocator>> rhs)
+        noexcept
+    {
+        return (lhs.Get() <=> rhs.Get());
+    }
+
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] inline Ordering
+    operator<=>(
+        Immutable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> lhs,
+        Null rhs) noexcept
+    {
+        return (lhs.Get() <=> nullptr);
+    }
+
+    // Access.
+    // =======
+
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] inline CompactUniquePtr<TType, TAllocator>
+    ToReadOnly(Movable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> rhs)
+        noexcept
+    {
+        return CompactUniquePtr<TType, TAllocator>{ Move(rhs) };
+    }
+
+    template <typename TType, typename TTraits, typename TAllocator>
+    [[nodiscard]] inline RWCompactUniquePtr<TType, TAllocator>
+    ToReadWrite(Movable<BaseCompactUniquePtr<TType, TTraits, TAllocator>> rhs)
+        noexcept
+    {
+        return RWCompactUniquePtr<TType, TAllocator>{ Move(rhs) };
+    }
+
+    // Utilities.
+    // ==========
+
+    template <typename TType,
+              Templates::StatelessAllocator TAllocator,
+              typename... TArguments>
+    [[nodiscard]] inline CompactUniquePtr<TType, TAllocator>
+    MakeCompactUnique(Forwarding<TArguments>... arguments) noexcept
+    {
+        return ToReadOnly(MakeRWCompactUnique<TType, TAllocator>(
+            Forward<TArguments>(arguments)...));
+    }
+
+    template <typename TType,
+              Templates::StatelessAllocator TAllocator,
+              typename... TArguments>
+    [[nodiscard]] inline RWCompactUniquePtr<TType, TAllocator>
+    MakeRWCompactUnique(Forwarding<TArguments>... arguments) noexcept
+    {
+        auto allocator = TAllocator{};
+
+        auto block = allocator.Allocate(Memory::SizeOf<TType>(),
+                                        Memory::AlignmentOf<TType>());
+
+        if (!block.GetData())
+        {
+            return {};
+        }
+
+        auto pointee = new (block.GetData())
+            TType(Forward<TArguments>(arguments)...);
+
+        return RWCompactUniquePtr<TType, TAllocator>{ pointee };
+    }
+
+}
+
+// ===========================================================================
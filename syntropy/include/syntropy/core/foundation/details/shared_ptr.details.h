@@ -0,0 +1,168 @@
+/// \file shared_ptr.details.h
+///
+/// \brief This header is part of Syntropy core module.
+///        It contains implementation details of shared-ownership smart
+///        pointers.
+///
+/// \author Raffaele D. Facendola - May 2021
+
+#pragma once
+
+#include <new>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Details
+{
+    /************************************************************************/
+    /* SHARED BLOCK                                                         */
+    /************************************************************************/
+
+    /// \brief Header of an allocation holding a shared object.
+    ///
+    /// The header is laid out right before the shared object, within the
+    /// same allocation. The object is destroyed when the last strong
+    /// reference is released, while the allocation survives until the
+    /// last weak reference is released.
+    ///
+    /// Strong references collectively hold a single weak reference.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    template <typename TPolicy>
+    class SharedBlock
+    {
+    public:
+
+        /// \brief Create a new header.
+        ///
+        /// The new header holds a single strong reference.
+        SharedBlock(Mutable<Memory::BaseAllocator> allocator) noexcept;
+
+        /// \brief No copy-constructor.
+        SharedBlock(Immutable<SharedBlock> rhs) = delete;
+
+        /// \brief No copy-assignment operator.
+        Mutable<SharedBlock>
+        operator=(Immutable<SharedBlock> rhs) = delete;
+
+        /// \brief Acquire a new strong reference.
+        void
+        AcquireStrong() noexcept;
+
+        /// \brief Acquire a new strong reference, unless the object was
+        ///        already destroyed.
+        ///
+        /// \return Returns true if a strong reference could be acquired,
+        ///         returns false otherwise.
+        [[nodiscard]] Bool
+        TryAcquireStrong() noexcept;
+
+        /// \brief Release a strong reference, destroying the object when
+        ///        it was the last one.
+        void
+        ReleaseStrong() noexcept;
+
+        /// \brief Acquire a new weak reference.
+        void
+        AcquireWeak() noexcept;
+
+        /// \brief Release a weak reference, deallocating the storage when
+        ///        it was the last one.
+        void
+        ReleaseWeak() noexcept;
+
+        /// \brief Get the number of strong references.
+        [[nodiscard]] Int
+        GetStrongCount() const noexcept;
+
+        /// \brief Get the allocator the object was allocated on.
+        [[nodiscard]] Mutable<Memory::BaseAllocator>
+        GetAllocator() const noexcept;
+
+    protected:
+
+        /// \brief Default destructor.
+        ~SharedBlock() noexcept = default;
+
+        /// \brief Destroy the shared object.
+        virtual void
+        Destroy() noexcept = 0;
+
+        /// \brief Destroy the header and deallocate the storage.
+        virtual void
+        Deallocate() noexcept = 0;
+
+        /// \brief Allocator the storage was allocated on.
+        RWPtr<Memory::BaseAllocator> allocator_{ nullptr };
+
+    private:
+
+        /// \brief Number of strong references.
+        typename TPolicy::TCount strong_count_{ 1 };
+
+        /// \brief Number of weak references, plus one for all strong
+        ///        references.
+        typename TPolicy::TCount weak_count_{ 1 };
+
+    };
+
+    /************************************************************************/
+    /* SHARED OBJECT BLOCK                                                  */
+    /************************************************************************/
+
+    /// \brief Allocation holding a header followed by a shared object of
+    ///        type TType.
+    ///
+    /// The object address, the storage size and the storage alignment are
+    /// all derived from the block type, therefore they are not stored.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    template <typename TType, typename TPolicy>
+    class SharedObjectBlock : public SharedBlock<TPolicy>
+    {
+    public:
+
+        /// \brief Create a new shared object.
+        ///
+        /// The new block holds a single strong reference.
+        template <typename... TArguments>
+        SharedObjectBlock(Mutable<Memory::BaseAllocator> allocator,
+                          Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief Access the shared object.
+        [[nodiscard]] RWPtr<TType>
+        GetObject() noexcept;
+
+    protected:
+
+        /// \brief Destroy the shared object.
+        void
+        Destroy() noexcept override;
+
+        /// \brief Destroy the header and deallocate the storage.
+        void
+        Deallocate() noexcept override;
+
+    private:
+
+        /// \brief Storage for the shared object, which is destroyed
+        ///        before the block.
+        alignas(TType) Memory::Byte object_[sizeof(TType)];
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "shared_ptr.details.inl"
+
+// ===========================================================================
@@ -0,0 +1,123 @@
+/// \file shared_ptr.details.inl
+///
+/// \author Raffaele D. Facendola - May 2021
+
+#pragma once
+
+// ===========================================================================
+
+namespace Syntropy::Details
+{
+    /************************************************************************/
+    /* SHARED BLOCK                                                         */
+    /************************************************************************/
+
+    template <typename TPolicy>
+    inline SharedBlock<TPolicy>
+    ::SharedBlock(Mutable<Memory::BaseAllocator> allocator) noexcept
+        : allocator_(PtrOf(allocator))
+    {
+
+    }
+
+    template <typename TPolicy>
+    inline void SharedBlock<TPolicy>
+    ::AcquireStrong() noexcept
+    {
+        TPolicy::Increment(strong_count_);
+    }
+
+    template <typename TPolicy>
+    [[nodiscard]] inline Bool SharedBlock<TPolicy>
+    ::TryAcquireStrong() noexcept
+    {
+        return TPolicy::IncrementNonZero(strong_count_);
+    }
+
+    template <typename TPolicy>
+    inline void SharedBlock<TPolicy>
+    ::ReleaseStrong() noexcept
+    {
+        if (TPolicy::Decrement(strong_count_))
+        {
+            Destroy();
+
+            ReleaseWeak();
+        }
+    }
+
+    template <typename TPolicy>
+    inline void SharedBlock<TPolicy>
+    ::AcquireWeak() noexcept
+    {
+        TPolicy::Increment(weak_count_);
+    }
+
+    template <typename TPolicy>
+    inline void SharedBlock<TPolicy>
+    ::ReleaseWeak() noexcept
+    {
+        if (TPolicy::Decrement(weak_count_))
+        {
+            Deallocate();
+        }
+    }
+
+    template <typename TPolicy>
+    [[nodiscard]] inline Int SharedBlock<TPolicy>
+    ::GetStrongCount() const noexcept
+    {
+        return TPolicy::Load(strong_count_);
+    }
+
+    template <typename TPolicy>
+    [[nodiscard]] inline Mutable<Memory::BaseAllocator> SharedBlock<TPolicy>
+    ::GetAllocator() const noexcept
+    {
+        return *allocator_;
+    }
+
+    /************************************************************************/
+    /* SHARED OBJECT BLOCK                                                  */
+    /************************************************************************/
+
+    template <typename TType, typename TPolicy>
+    template <typename... TArguments>
+    inline SharedObjectBlock<TType, TPolicy>
+    ::SharedObjectBlock(Mutable<Memory::BaseAllocator> allocator,
+                        Forwarding<TArguments>... arguments) noexcept
+        : SharedBlock<TPolicy>(allocator)
+    {
+        new (object_) TType(Forward<TArguments>(arguments)...);
+    }
+
+    template <typename TType, typename TPolicy>
+    [[nodiscard]] inline RWPtr<TType> SharedObjectBlock<TType, TPolicy>
+    ::GetObject() noexcept
+    {
+        return std::launder(reinterpret_cast<RWPtr<TType>>(object_));
+    }
+
+    template <typename TType, typename TPolicy>
+    inline void SharedObjectBlock<TType, TPolicy>
+    ::Destroy() noexcept
+    {
+        GetObject()->~TType();
+    }
+
+    template <typename TType, typename TPolicy>
+    inline void SharedObjectBlock<TType, TPolicy>
+    ::Deallocate() noexcept
+    {
+        auto& allocator = *this->allocator_;
+        auto storage = Memory::BytesOf(*this);
+
+        this->~SharedObjectBlock();
+
+        allocator.Deallocate(storage,
+                             Memory::AlignmentOf<SharedObjectBlock>());
+    }
+
+}
+
+// ===========================================================================
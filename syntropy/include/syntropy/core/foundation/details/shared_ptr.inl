@@ -0,0 +1,519 @@
+/// \file shared_ptr.inl
+///
+/// \author Raffaele D. Facendola - May 2021
+
+#pragma once
+
+#include "syntropy/core/algorithms/swap.h"
+
+#include "syntropy/math/math.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* CONCURRENT COUNT POLICY                                              */
+    /************************************************************************/
+
+    inline void ConcurrentCountPolicy
+    ::Increment(Mutable<TCount> count) noexcept
+    {
+        // New references are always acquired from existing ones: there's
+        // nothing to synchronize with.
+
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] inline Bool ConcurrentCountPolicy
+    ::IncrementNonZero(Mutable<TCount> count) noexcept
+    {
+        auto value = count.load(std::memory_order_relaxed);
+
+        while (value != 0)
+        {
+            if (count.compare_exchange_weak(value,
+                                            value + 1,
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] inline Bool ConcurrentCountPolicy
+    ::Decrement(Mutable<TCount> count) noexcept
+    {
+        // Releasing the last reference must observe every access performed
+        // through other references before destroying the object.
+
+        return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    [[nodiscard]] inline Int ConcurrentCountPolicy
+    ::Load(Immutable<TCount> count) noexcept
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    /************************************************************************/
+    /* LOCAL COUNT POLICY                                                   */
+    /************************************************************************/
+
+    inline void LocalCountPolicy
+    ::Increment(Mutable<TCount> count) noexcept
+    {
+        ++count;
+    }
+
+    [[nodiscard]] inline Bool LocalCountPolicy
+    ::IncrementNonZero(Mutable<TCount> count) noexcept
+    {
+        if (count != 0)
+        {
+            ++count;
+            return true;
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] inline Bool LocalCountPolicy
+    ::Decrement(Mutable<TCount> count) noexcept
+    {
+        return --count == 0;
+    }
+
+    [[nodiscard]] inline Int LocalCountPolicy
+    ::Load(Immutable<TCount> count) noexcept
+    {
+        return count;
+    }
+
+    /************************************************************************/
+    /* BASE SHARED PTR                                                      */
+    /************************************************************************/
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::BaseSharedPtr(Null rhs) noexcept
+        : BaseSharedPtr()
+    {
+
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::BaseSharedPtr(Immutable<BaseSharedPtr> rhs) noexcept
+        : pointee_(rhs.pointee_)
+        , block_(rhs.block_)
+    {
+        if (block_)
+        {
+            block_->AcquireStrong();
+        }
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::BaseSharedPtr(Movable<BaseSharedPtr> rhs) noexcept
+        : pointee_(rhs.pointee_)
+        , block_(rhs.block_)
+    {
+        rhs.pointee_ = nullptr;
+        rhs.block_ = nullptr;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    template <typename UType, typename UTraits>
+    requires Templates::IsConvertible<typename UTraits::TPointer,
+                                      typename TTraits::TPointer>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::BaseSharedPtr(Immutable<BaseSharedPtr<UType, UTraits, TPolicy>> rhs)
+        noexcept
+        : pointee_(rhs.pointee_)
+        , block_(rhs.block_)
+    {
+        if (block_)
+        {
+            block_->AcquireStrong();
+        }
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    template <typename UType, typename UTraits>
+    requires Templates::IsConvertible<typename UTraits::TPointer,
+                                      typename TTraits::TPointer>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::BaseSharedPtr(Movable<BaseSharedPtr<UType, UTraits, TPolicy>> rhs)
+        noexcept
+        : pointee_(rhs.pointee_)
+        , block_(rhs.block_)
+    {
+        rhs.pointee_ = nullptr;
+        rhs.block_ = nullptr;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    template <typename UType, typename UTraits>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::BaseSharedPtr(Immutable<BaseSharedPtr<UType, UTraits, TPolicy>> owner,
+                    RWPtr<TType> pointee) noexcept
+        : pointee_(pointee)
+        , block_(owner.block_)
+    {
+        if (block_)
+        {
+            block_->AcquireStrong();
+        }
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::BaseSharedPtr(RWPtr<TType> pointee, RWPtr<TBlock> block) noexcept
+        : pointee_(pointee)
+        , block_(block)
+    {
+
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::~BaseSharedPtr() noexcept
+    {
+        Reset();
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline Mutable<BaseSharedPtr<TType, TTraits, TPolicy>>
+    BaseSharedPtr<TType, TTraits, TPolicy>
+    ::operator=(BaseSharedPtr rhs) noexcept
+    {
+        Swap(rhs);
+
+        return *this;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline Mutable<BaseSharedPtr<TType, TTraits, TPolicy>>
+    BaseSharedPtr<TType, TTraits, TPolicy>
+    ::operator=(Null rhs) noexcept
+    {
+        Reset();
+
+        return *this;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline BaseSharedPtr<TType, TTraits, TPolicy>
+    ::operator Bool() const noexcept
+    {
+        return !!pointee_;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline auto BaseSharedPtr<TType, TTraits, TPolicy>
+    ::operator*() const noexcept -> TReference
+    {
+        SYNTROPY_ASSERT(pointee_);
+
+        return *pointee_;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline auto BaseSharedPtr<TType, TTraits, TPolicy>
+    ::operator->() const noexcept -> TPointer
+    {
+        return pointee_;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline void BaseSharedPtr<TType, TTraits, TPolicy>
+    ::Reset() noexcept
+    {
+        if (block_)
+        {
+            block_->ReleaseStrong();
+        }
+
+        pointee_ = nullptr;
+        block_ = nullptr;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline auto BaseSharedPtr<TType, TTraits, TPolicy>
+    ::Get() const noexcept -> TPointer
+    {
+        return pointee_;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline Int BaseSharedPtr<TType, TTraits, TPolicy>
+    ::GetCount() const noexcept
+    {
+        return block_ ? block_->GetStrongCount() : 0;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline Mutable<Memory::BaseAllocator>
+    BaseSharedPtr<TType, TTraits, TPolicy>
+    ::GetAllocator() const noexcept
+    {
+        SYNTROPY_ASSERT(block_);
+
+        return block_->GetAllocator();
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline void BaseSharedPtr<TType, TTraits, TPolicy>
+    ::Swap(Mutable<BaseSharedPtr> rhs) noexcept
+    {
+        using Algorithms::Swap;
+
+        Swap(pointee_, rhs.pointee_);
+        Swap(block_, rhs.block_);
+    }
+
+    /************************************************************************/
+    /* BASE WEAK PTR                                                        */
+    /************************************************************************/
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseWeakPtr<TType, TTraits, TPolicy>
+    ::BaseWeakPtr(Null rhs) noexcept
+        : BaseWeakPtr()
+    {
+
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseWeakPtr<TType, TTraits, TPolicy>
+    ::BaseWeakPtr(Immutable<BaseWeakPtr> rhs) noexcept
+        : pointee_(rhs.pointee_)
+        , block_(rhs.block_)
+    {
+        if (block_)
+        {
+            block_->AcquireWeak();
+        }
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseWeakPtr<TType, TTraits, TPolicy>
+    ::BaseWeakPtr(Movable<BaseWeakPtr> rhs) noexcept
+        : pointee_(rhs.pointee_)
+        , block_(rhs.block_)
+    {
+        rhs.pointee_ = nullptr;
+        rhs.block_ = nullptr;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    template <typename UType, typename UTraits>
+    requires Templates::IsConvertible<typename UTraits::TPointer,
+                                      typename TTraits::TPointer>
+    inline BaseWeakPtr<TType, TTraits, TPolicy>
+    ::BaseWeakPtr(Immutable<BaseSharedPtr<UType, UTraits, TPolicy>> rhs)
+        noexcept
+        : pointee_(rhs.pointee_)
+        , block_(rhs.block_)
+    {
+        if (block_)
+        {
+            block_->AcquireWeak();
+        }
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline BaseWeakPtr<TType, TTraits, TPolicy>
+    ::~BaseWeakPtr() noexcept
+    {
+        Reset();
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline Mutable<BaseWeakPtr<TType, TTraits, TPolicy>>
+    BaseWeakPtr<TType, TTraits, TPolicy>
+    ::operator=(BaseWeakPtr rhs) noexcept
+    {
+        Swap(rhs);
+
+        return *this;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline Mutable<BaseWeakPtr<TType, TTraits, TPolicy>>
+    BaseWeakPtr<TType, TTraits, TPolicy>
+    ::operator=(Null rhs) noexcept
+    {
+        Reset();
+
+        return *this;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline BaseSharedPtr<TType, TTraits, TPolicy>
+    BaseWeakPtr<TType, TTraits, TPolicy>
+    ::Lock() const noexcept
+    {
+        if (block_ && block_->TryAcquireStrong())
+        {
+            return { pointee_, block_ };
+        }
+
+        return {};
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline Bool BaseWeakPtr<TType, TTraits, TPolicy>
+    ::IsExpired() const noexcept
+    {
+        return !block_ || (block_->GetStrongCount() == 0);
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline void BaseWeakPtr<TType, TTraits, TPolicy>
+    ::Reset() noexcept
+    {
+        if (block_)
+        {
+            block_->ReleaseWeak();
+        }
+
+        pointee_ = nullptr;
+        block_ = nullptr;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    inline void BaseWeakPtr<TType, TTraits, TPolicy>
+    ::Swap(Mutable<BaseWeakPtr> rhs) noexcept
+    {
+        using Algorithms::Swap;
+
+        Swap(pointee_, rhs.pointee_);
+        Swap(block_, rhs.block_);
+    }
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Comparison.
+    // ===========
+
+    template <typename TType, typename TTraits, typename TPolicy,
+              typename UType, typename UTraits, typename UPolicy>
+    [[nodiscard]] inline Bool
+    operator==(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+               Immutable<BaseSharedPtr<UType, UTraits, UPolicy>> rhs) noexcept
+    {
+        return lhs.Get() == rhs.Get();
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline Bool
+    operator==(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+               Null rhs) noexcept
+    {
+        return !lhs;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy,
+              typename UType, typename UTraits, typename UPolicy>
+    [[nodiscard]] inline Ordering
+    operator<=>(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+                Immutable<BaseSharedPtr<UType, UTraits, UPolicy>> rhs)
+                noexcept
+    {
+        return (lhs.Get() <=> rhs.Get());
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline Ordering
+    operator<=>(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+                Null rhs) noexcept
+    {
+        return (lhs.Get() <=> nullptr);
+    }
+
+    // Access.
+    // =======
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline SharedPtr<TType, TPolicy>
+    ToReadOnly(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> rhs)
+        noexcept
+    {
+        return rhs;
+    }
+
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] inline RWSharedPtr<TType, TPolicy>
+    ToReadWrite(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> rhs)
+        noexcept
+    {
+        return { rhs, ToReadWrite(rhs.Get()) };
+    }
+
+    // Utilities.
+    // ==========
+
+    template <typename TType, typename TPolicy, typename... TArguments>
+    [[nodiscard]] inline SharedPtr<TType, TPolicy>
+    MakeShared(Forwarding<TArguments>... arguments) noexcept
+    {
+        return MakeRWSharedOnAllocator<TType, TPolicy>(
+            Memory::GetScopeAllocator(),
+            Forward<TArguments>(arguments)...);
+    }
+
+    template <typename TType, typename TPolicy, typename... TArguments>
+    [[nodiscard]] inline SharedPtr<TType, TPolicy>
+    MakeSharedOnAllocator(Mutable<Memory::BaseAllocator> allocator,
+                          Forwarding<TArguments>... arguments) noexcept
+    {
+        return MakeRWSharedOnAllocator<TType, TPolicy>(
+            allocator,
+            Forward<TArguments>(arguments)...);
+    }
+
+    template <typename TType, typename TPolicy, typename... TArguments>
+    [[nodiscard]] inline RWSharedPtr<TType, TPolicy>
+    MakeRWShared(Forwarding<TArguments>... arguments) noexcept
+    {
+        return MakeRWSharedOnAllocator<TType, TPolicy>(
+            Memory::GetScopeAllocator(),
+            Forward<TArguments>(arguments)...);
+    }
+
+    template <typename TType, typename TPolicy, typename... TArguments>
+    [[nodiscard]] inline RWSharedPtr<TType, TPolicy>
+    MakeRWSharedOnAllocator(Mutable<Memory::BaseAllocator> allocator,
+                            Forwarding<TArguments>... arguments) noexcept
+    {
+        using TBlock = Details::SharedObjectBlock<TType, TPolicy>;
+
+        // The header and the object share the same allocation.
+
+        auto storage = allocator.Allocate(Memory::SizeOf<TBlock>(),
+                                          Memory::AlignmentOf<TBlock>());
+
+        if (!storage.GetData())
+        {
+            return {};
+        }
+
+        auto block = new (storage.GetData())
+            TBlock{ allocator, Forward<TArguments>(arguments)... };
+
+        auto pointee = block->GetObject();
+
+        return { pointee, block };
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,451 @@
+/// \file shared_ptr.h
+///
+/// \brief This header is part of Syntropy core module.
+/// It contains definitions for shared-ownership smart pointers.
+///
+/// \author Raffaele D. Facendola - May 2021
+
+// ===========================================================================
+
+#pragma once
+
+#include <atomic>
+#include <new>
+
+#include "syntropy/language/foundation/foundation.h"
+#include "syntropy/language/templates/concepts.h"
+#include "syntropy/core/algorithms/compare.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+#include "syntropy/core/foundation/details/shared_ptr.details.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* CONCURRENT COUNT POLICY                                              */
+    /************************************************************************/
+
+    /// \brief Reference-counting policy for objects shared among threads.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    struct ConcurrentCountPolicy
+    {
+        /// \brief Counter type.
+        using TCount = std::atomic<Int>;
+
+        /// \brief Increment a counter.
+        static void
+        Increment(Mutable<TCount> count) noexcept;
+
+        /// \brief Increment a counter, unless it is zero.
+        /// \return Returns true if the counter was incremented, returns
+        ///         false otherwise.
+        [[nodiscard]] static Bool
+        IncrementNonZero(Mutable<TCount> count) noexcept;
+
+        /// \brief Decrement a counter.
+        /// \return Returns true if the counter reached zero, returns false
+        ///         otherwise.
+        [[nodiscard]] static Bool
+        Decrement(Mutable<TCount> count) noexcept;
+
+        /// \brief Read a counter.
+        [[nodiscard]] static Int
+        Load(Immutable<TCount> count) noexcept;
+    };
+
+    /************************************************************************/
+    /* LOCAL COUNT POLICY                                                   */
+    /************************************************************************/
+
+    /// \brief Reference-counting policy for objects accessed by a single
+    ///        thread at a time.
+    ///
+    /// Counters are plain integers: no atomic operation is performed.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    struct LocalCountPolicy
+    {
+        /// \brief Counter type.
+        using TCount = Int;
+
+        /// \brief Increment a counter.
+        static void
+        Increment(Mutable<TCount> count) noexcept;
+
+        /// \brief Increment a counter, unless it is zero.
+        /// \return Returns true if the counter was incremented, returns
+        ///         false otherwise.
+        [[nodiscard]] static Bool
+        IncrementNonZero(Mutable<TCount> count) noexcept;
+
+        /// \brief Decrement a counter.
+        /// \return Returns true if the counter reached zero, returns false
+        ///         otherwise.
+        [[nodiscard]] static Bool
+        Decrement(Mutable<TCount> count) noexcept;
+
+        /// \brief Read a counter.
+        [[nodiscard]] static Int
+        Load(Immutable<TCount> count) noexcept;
+    };
+
+    /************************************************************************/
+    /* BASE SHARED PTR                                                      */
+    /************************************************************************/
+
+    /// \brief Represents a pointer that holds shared ownership of an
+    ///        object and deletes it when the last owner goes out of scope.
+    ///
+    /// Reference counters are laid out right before the object, within
+    /// the same allocation: no separate control block is ever allocated.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    template <typename TType, typename TTraits, typename TPolicy>
+    class BaseSharedPtr
+    {
+        template <typename UType, typename UTraits, typename UPolicy>
+        friend class BaseSharedPtr;
+
+        template <typename UType, typename UTraits, typename UPolicy>
+        friend class BaseWeakPtr;
+
+    public:
+
+        /// \brief Pointer type.
+        using TPointer = typename TTraits::TPointer;
+
+        /// \brief Reference type.
+        using TReference = typename TTraits::TReference;
+
+        /// \brief Header type.
+        using TBlock = Details::SharedBlock<TPolicy>;
+
+        /// \brief Create an empty pointer.
+        BaseSharedPtr() noexcept = default;
+
+        /// \brief Create an empty pointer.
+        BaseSharedPtr(Null rhs) noexcept;
+
+        /// \brief Copy constructor, sharing the ownership of the pointee.
+        BaseSharedPtr(Immutable<BaseSharedPtr> rhs) noexcept;
+
+        /// \brief Move constructor.
+        BaseSharedPtr(Movable<BaseSharedPtr> rhs) noexcept;
+
+        /// \brief Converting copy constructor, sharing the ownership of
+        ///        the pointee.
+        template <typename UType, typename UTraits>
+        requires Templates::IsConvertible<typename UTraits::TPointer,
+                                          typename TTraits::TPointer>
+        BaseSharedPtr(Immutable<BaseSharedPtr<UType, UTraits, TPolicy>> rhs)
+            noexcept;
+
+        /// \brief Converting move constructor.
+        template <typename UType, typename UTraits>
+        requires Templates::IsConvertible<typename UTraits::TPointer,
+                                          typename TTraits::TPointer>
+        BaseSharedPtr(Movable<BaseSharedPtr<UType, UTraits, TPolicy>> rhs)
+            noexcept;
+
+        /// \brief Share the ownership of another pointer, while pointing to
+        ///        an unrelated object, such as one of its members.
+        template <typename UType, typename UTraits>
+        BaseSharedPtr(Immutable<BaseSharedPtr<UType, UTraits, TPolicy>> owner,
+                      RWPtr<TType> pointee) noexcept;
+
+        /// \brief Acquire a strong reference to an object.
+        ///
+        /// \remarks The caller must transfer a strong reference to the
+        ///          object, otherwise the behavior of this method is
+        ///          undefined.
+        BaseSharedPtr(RWPtr<TType> pointee, RWPtr<TBlock> block) noexcept;
+
+        /// \brief Release the ownership of the pointee, destroying it if
+        ///        this was the last owner.
+        ~BaseSharedPtr() noexcept;
+
+        /// \brief Unified assignment operator.
+        Mutable<BaseSharedPtr>
+        operator=(BaseSharedPtr rhs) noexcept;
+
+        /// \brief Release the pointed object and reset the pointer.
+        Mutable<BaseSharedPtr>
+        operator=(Null rhs) noexcept;
+
+        /// \brief Check whether the pointed object is non-null.
+        [[nodiscard]] explicit
+        operator Bool() const noexcept;
+
+        /// \brief Access the pointed object.
+        /// \remarks If the pointed object is null, accessing the returned
+        ///          value results in undefined behavior.
+        [[nodiscard]] TReference
+        operator*() const noexcept;
+
+        /// \brief Access the pointed object.
+        [[nodiscard]] TPointer
+        operator->() const noexcept;
+
+        /// \brief Reset the pointer, destroying the pointee object if this
+        ///        was the last owner.
+        void Reset() noexcept;
+
+        /// \brief Access the pointed object.
+        [[nodiscard]] TPointer
+        Get() const noexcept;
+
+        /// \brief Get the number of pointers sharing the ownership of the
+        ///        pointee.
+        [[nodiscard]] Int
+        GetCount() const noexcept;
+
+        /// \brief Get the allocator the pointed object was allocated on.
+        /// \remarks If the pointed object is null, accessing the returned
+        ///          value results in undefined behavior.
+        [[nodiscard]] Mutable<Memory::BaseAllocator>
+        GetAllocator() const noexcept;
+
+        /// \brief Swap the content of two pointers.
+        void
+        Swap(Mutable<BaseSharedPtr> rhs) noexcept;
+
+    private:
+
+        /// \brief Pointed object.
+        RWPtr<TType> pointee_{ nullptr };
+
+        /// \brief Header of the allocation holding the pointed object.
+        RWPtr<TBlock> block_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* BASE WEAK PTR                                                        */
+    /************************************************************************/
+
+    /// \brief Represents a non-owning reference to an object owned by
+    ///        shared pointers.
+    ///
+    /// Weak pointers don't keep the object alive, but they keep its
+    /// allocation alive until the last weak pointer goes out of scope.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    template <typename TType, typename TTraits, typename TPolicy>
+    class BaseWeakPtr
+    {
+        template <typename UType, typename UTraits, typename UPolicy>
+        friend class BaseWeakPtr;
+
+    public:
+
+        /// \brief Header type.
+        using TBlock = Details::SharedBlock<TPolicy>;
+
+        /// \brief Create an empty pointer.
+        BaseWeakPtr() noexcept = default;
+
+        /// \brief Create an empty pointer.
+        BaseWeakPtr(Null rhs) noexcept;
+
+        /// \brief Copy constructor.
+        BaseWeakPtr(Immutable<BaseWeakPtr> rhs) noexcept;
+
+        /// \brief Move constructor.
+        BaseWeakPtr(Movable<BaseWeakPtr> rhs) noexcept;
+
+        /// \brief Create a weak reference to a shared object.
+        template <typename UType, typename UTraits>
+        requires Templates::IsConvertible<typename UTraits::TPointer,
+                                          typename TTraits::TPointer>
+        BaseWeakPtr(Immutable<BaseSharedPtr<UType, UTraits, TPolicy>> rhs)
+            noexcept;
+
+        /// \brief Release the weak reference.
+        ~BaseWeakPtr() noexcept;
+
+        /// \brief Unified assignment operator.
+        Mutable<BaseWeakPtr>
+        operator=(BaseWeakPtr rhs) noexcept;
+
+        /// \brief Release the weak reference and reset the pointer.
+        Mutable<BaseWeakPtr>
+        operator=(Null rhs) noexcept;
+
+        /// \brief Acquire shared ownership of the object.
+        ///
+        /// \return Returns a pointer to the object if it is still alive,
+        ///         returns an empty pointer otherwise.
+        [[nodiscard]] BaseSharedPtr<TType, TTraits, TPolicy>
+        Lock() const noexcept;
+
+        /// \brief Check whether the referred object was destroyed.
+        [[nodiscard]] Bool
+        IsExpired() const noexcept;
+
+        /// \brief Reset the pointer, releasing the weak reference.
+        void Reset() noexcept;
+
+        /// \brief Swap the content of two pointers.
+        void
+        Swap(Mutable<BaseWeakPtr> rhs) noexcept;
+
+    private:
+
+        /// \brief Referred object.
+        RWPtr<TType> pointee_{ nullptr };
+
+        /// \brief Header of the allocation holding the referred object.
+        RWPtr<TBlock> block_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* SHARED PTR                                                           */
+    /************************************************************************/
+
+    /// \brief Tag for read-only shared pointers.
+    template <typename TType>
+    struct SharedPtrTypeTraits
+    {
+        /// \brief Pointer type.
+        using TPointer = Ptr<TType>;
+
+        /// \brief Reference type.
+        using TReference = Immutable<TType>;
+    };
+
+    /// \brief Represents a shared owning pointer to a read-only value.
+    template <typename TType, typename TPolicy = ConcurrentCountPolicy>
+    using SharedPtr
+        = BaseSharedPtr<TType, SharedPtrTypeTraits<TType>, TPolicy>;
+
+    /// \brief Represents a weak pointer to a read-only value.
+    template <typename TType, typename TPolicy = ConcurrentCountPolicy>
+    using WeakPtr
+        = BaseWeakPtr<TType, SharedPtrTypeTraits<TType>, TPolicy>;
+
+    /************************************************************************/
+    /* RW SHARED PTR                                                        */
+    /************************************************************************/
+
+    /// \brief Tag for read-write shared pointers.
+    template <typename TType>
+    struct RWSharedPtrTypeTraits
+    {
+        /// \brief Pointer type.
+        using TPointer = RWPtr<TType>;
+
+        /// \brief Reference type.
+        using TReference = Mutable<TType>;
+    };
+
+    /// \brief Represents a shared owning pointer to a read-write value.
+    template <typename TType, typename TPolicy = ConcurrentCountPolicy>
+    using RWSharedPtr
+        = BaseSharedPtr<TType, RWSharedPtrTypeTraits<TType>, TPolicy>;
+
+    /// \brief Represents a weak pointer to a read-write value.
+    template <typename TType, typename TPolicy = ConcurrentCountPolicy>
+    using RWWeakPtr
+        = BaseWeakPtr<TType, RWSharedPtrTypeTraits<TType>, TPolicy>;
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Comparison.
+    // ===========
+
+    /// \brief Check whether two shared pointers refer to the same
+    ///        underlying object.
+    template <typename TType, typename TTraits, typename TPolicy,
+              typename UType, typename UTraits, typename UPolicy>
+    [[nodiscard]] Bool
+    operator==(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+               Immutable<BaseSharedPtr<UType, UTraits, UPolicy>> rhs) noexcept;
+
+    /// \brief Check whether lhs is empty.
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] Bool
+    operator==(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+               Null rhs) noexcept;
+
+    /// \brief Compare two shared pointers.
+    template <typename TType, typename TTraits, typename TPolicy,
+              typename UType, typename UTraits, typename UPolicy>
+    [[nodiscard]] Ordering
+    operator<=>(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+                Immutable<BaseSharedPtr<UType, UTraits, UPolicy>> rhs)
+                noexcept;
+
+    /// \brief Compare a shared pointer against a null pointer.
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] Ordering
+    operator<=>(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> lhs,
+                Null rhs) noexcept;
+
+    // Access.
+    // =======
+
+    /// \brief Get a read-only shared pointer sharing the ownership of rhs.
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] SharedPtr<TType, TPolicy>
+    ToReadOnly(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> rhs)
+        noexcept;
+
+    /// \brief Get a read-write shared pointer sharing the ownership of rhs.
+    /// \remarks If the original shared pointer is not read-writable,
+    ///          accessing the returned values results in undefined behavior.
+    template <typename TType, typename TTraits, typename TPolicy>
+    [[nodiscard]] RWSharedPtr<TType, TPolicy>
+    ToReadWrite(Immutable<BaseSharedPtr<TType, TTraits, TPolicy>> rhs)
+        noexcept;
+
+    // Utilities.
+    // ==========
+
+    /// \brief Allocate a new shared object on the active allocator.
+    /// If the object could not be allocated, returns an empty pointer.
+    template <typename TType,
+              typename TPolicy = ConcurrentCountPolicy,
+              typename... TArguments>
+    [[nodiscard]] SharedPtr<TType, TPolicy>
+    MakeShared(Forwarding<TArguments>... arguments) noexcept;
+
+    /// \brief Allocate a new shared object on the given allocator.
+    /// If the object could not be allocated, returns an empty pointer.
+    template <typename TType,
+              typename TPolicy = ConcurrentCountPolicy,
+              typename... TArguments>
+    [[nodiscard]] SharedPtr<TType, TPolicy>
+    MakeSharedOnAllocator(Mutable<Memory::BaseAllocator> allocator,
+                          Forwarding<TArguments>... arguments) noexcept;
+
+    /// \brief Allocate a new shared object on the active allocator.
+    /// If the object could not be allocated, returns an empty pointer.
+    template <typename TType,
+              typename TPolicy = ConcurrentCountPolicy,
+              typename... TArguments>
+    [[nodiscard]] RWSharedPtr<TType, TPolicy>
+    MakeRWShared(Forwarding<TArguments>... arguments) noexcept;
+
+    /// \brief Allocate a new shared object on the given allocator.
+    /// If the object could not be allocated, returns an empty pointer.
+    template <typename TType,
+              typename TPolicy = ConcurrentCountPolicy,
+              typename... TArguments>
+    [[nodiscard]] RWSharedPtr<TType, TPolicy>
+    MakeRWSharedOnAllocator(Mutable<Memory::BaseAllocator> allocator,
+                            Forwarding<TArguments>... arguments) noexcept;
+
+}
+
+// ===========================================================================
+
+#include "details/shared_ptr.inl"
+
+// ===========================================================================
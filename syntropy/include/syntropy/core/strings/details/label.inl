@@ -0,0 +1,202 @@
+/// \file label.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <cstdint>
+
+#include "syntropy/memory/foundation/byte.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* LABEL                                                                */
+    /************************************************************************/
+
+    inline Label
+    ::Label() noexcept
+        : entry_(GetEmpty())
+    {
+
+    }
+
+    inline Label
+    ::Label(Null) noexcept
+        : Label()
+    {
+
+    }
+
+    template <Int TSize>
+    inline Label
+    ::Label(StringLiteral<TSize> characters) noexcept
+        : entry_(Intern(Memory::MakeByteSpan(Memory::ToBytePtr(characters),
+                                             Memory::ToBytes(TSize - 1)),
+                        Hash(characters)))
+    {
+
+    }
+
+    template <Int TSize>
+    inline Label
+    ::Label(Immutable<LabelLiteral<TSize>> characters) noexcept
+        : entry_(Intern(Memory::MakeByteSpan(
+                            Memory::ToBytePtr(characters.characters_),
+                            Memory::ToBytes(TSize - 1)),
+                        characters.hash_))
+    {
+
+    }
+
+    inline Label
+    ::Label(Immutable<StringView> characters) noexcept
+        : entry_(Intern(characters.GetCodeUnits(),
+                        HashOf(characters.GetCodeUnits().GetData(),
+                               ToInt(characters.GetCodeUnits().GetCount()))))
+    {
+
+    }
+
+    inline Label
+    ::operator StringView() const noexcept
+    {
+        return StringView{ GetCodeUnits() };
+    }
+
+    [[nodiscard]] inline Label
+    ::operator Bool() const noexcept
+    {
+        return entry_ != GetEmpty();
+    }
+
+    [[nodiscard]] inline Memory::ByteSpan Label
+    ::GetCodeUnits() const noexcept
+    {
+        return { Memory::ToBytePtr(entry_ + 1),
+                 Memory::ToBytes(entry_->count_) };
+    }
+
+    [[nodiscard]] inline Int Label
+    ::GetHash() const noexcept
+    {
+        return entry_->hash_;
+    }
+
+    inline void Label
+    ::Swap(Mutable<Label> rhs) noexcept
+    {
+        auto entry = entry_;
+
+        entry_ = rhs.entry_;
+        rhs.entry_ = entry;
+    }
+
+    template <Int TSize>
+    [[nodiscard]] constexpr Int Label
+    ::Hash(StringLiteral<TSize> characters) noexcept
+    {
+        // The null-terminator is not part of the label.
+
+        return HashOf(characters, TSize - 1);
+    }
+
+    template <typename TCodeUnit>
+    [[nodiscard]] constexpr Int Label
+    ::HashOf(Ptr<TCodeUnit> code_units, Int count) noexcept
+    {
+        auto hash = static_cast<std::uint64_t>(kEmptyHash);
+
+        for (auto index = Int{ 0 }; index < count; ++index)
+        {
+            hash ^= static_cast<std::uint8_t>(code_units[index]);
+            hash *= std::uint64_t{ 1099511628211ull };
+        }
+
+        return static_cast<Int>(hash);
+    }
+
+    [[nodiscard]] inline Ptr<Label::Entry> Label
+    ::GetEmpty() noexcept
+    {
+        static constexpr auto kEmpty = Entry{ kEmptyHash, 0 };
+
+        return &kEmpty;
+    }
+
+    /************************************************************************/
+    /* LABEL LITERAL <SIZE>                                                 */
+    /************************************************************************/
+
+    template <Int TSize>
+    consteval LabelLiteral<TSize>
+    ::LabelLiteral(StringLiteral<TSize> characters) noexcept
+    {
+        for (auto index = Int{ 0 }; index < TSize; ++index)
+        {
+            characters_[index] = characters[index];
+        }
+
+        hash_ = Label::Hash(characters_);
+    }
+
+    template <Int TSize>
+    consteval LabelLiteral<TSize>
+    ::LabelLiteral(const char (&characters)[TSize]) noexcept
+    {
+        for (auto index = Int{ 0 }; index < TSize; ++index)
+        {
+            characters_[index] = static_cast<char8_t>(characters[index]);
+        }
+
+        hash_ = Label::Hash(characters_);
+    }
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Comparison.
+    // ===========
+
+    [[nodiscard]] inline Bool
+    operator==(Immutable<Label> lhs, Immutable<Label> rhs) noexcept
+    {
+        // Interned labels are unique.
+
+        return lhs.GetCodeUnits().GetData() == rhs.GetCodeUnits().GetData();
+    }
+
+    // Ranges.
+    // =======
+
+    [[nodiscard]] inline StringView
+    ViewOf(Immutable<Label> label) noexcept
+    {
+        return label;
+    }
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::Literals
+{
+    /************************************************************************/
+    /* LITERALS                                                             */
+    /************************************************************************/
+
+    template <LabelLiteral TLiteral>
+    [[nodiscard]] inline Label
+    operator "" _label() noexcept
+    {
+        static const auto label = Label{ TLiteral };
+
+        return label;
+    }
+
+}
+
+// ===========================================================================
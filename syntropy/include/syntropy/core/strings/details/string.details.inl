@@ -39,10 +39,10 @@ namespace Syntropy::Strings::Details
 
     template <typename TType>
     constexpr auto
-    RouteToString(Mutable<TType> lhs, Mutable<TType> rhs)
-        noexcept -> decltype(InvokeToString(rhs, Templates::kMaxPriority))
+    RouteToString(Immutable<TType> rhs)
+        noexcept -> decltype(InvokeToString(rhs, kMaxPriority))
     {
-        return InvokeToString(rhs, Templates::kMaxPriority);
+        return InvokeToString(rhs, kMaxPriority);
     }
 
 }
@@ -5,14 +5,17 @@
 
 #pragma once
 
+#include <charconv>
+
 #include "syntropy/language/foundation/foundation.h"
 
 #include "syntropy/core/ranges/sized_range.h"
 #include "syntropy/core/algorithms/compare.h"
 #include "syntropy/core/algorithms/swap.h"
 
+#include "syntropy/diagnostics/foundation/assert.h"
+
 #include "syntropy/memory/allocators/allocator.h"
-#include "syntropy/memory/foundation/buffer.h"
 #include "syntropy/memory/foundation/memory.h"
 #include "syntropy/memory/foundation/byte_span.h"
 
@@ -24,6 +27,13 @@ namespace Syntropy
     /* STRING                                                               */
     /************************************************************************/
 
+    inline String
+    ::String () noexcept
+        : allocator_(&Memory::GetScopeAllocator())
+    {
+
+    }
+
     inline String
     ::String (Null) noexcept
         : String()
@@ -33,39 +43,165 @@ namespace Syntropy
 
     template <Int TSize>
     String
-    ::String(StringLiteral<TSize> characters) noexcept
-        : code_units_(Memory::ToBytes(TSize))
+    ::String(StringLiteral<TSize> characters,
+             Mutable<Memory::BaseAllocator> allocator) noexcept
+        : allocator_(&allocator)
+    {
+        Assign(Memory::MakeByteSpan(characters));
+    }
+
+    inline String
+    ::String(Immutable<StringView> characters,
+             Mutable<Memory::BaseAllocator> allocator) noexcept
+        : allocator_(&allocator)
+    {
+        Assign(characters.GetCodeUnits());
+    }
+
+    inline String
+    ::String(Immutable<String> rhs) noexcept
+        : allocator_(rhs.allocator_)
+    {
+        Assign(rhs.GetCodeUnits());
+    }
+
+    inline String
+    ::String(Movable<String> rhs) noexcept
+        : allocator_(rhs.allocator_)
+    {
+        // Both representations are trivially relocatable.
+
+        code_units_ = rhs.code_units_;
+
+        rhs.code_units_.inline_ = {};
+    }
+
+    inline Mutable<String> String
+    ::operator=(Immutable<String> rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            Release();
+
+            Assign(rhs.GetCodeUnits());
+        }
+
+        return *this;
+    }
+
+    inline Mutable<String> String
+    ::operator=(String&& rhs) noexcept
+    {
+        if (allocator_ == rhs.allocator_)
+        {
+            Swap(Move(rhs));
+        }
+        else
+        {
+            *this = rhs;
+        }
+
+        return *this;
+    }
+
+    inline String
+    ::~String() noexcept
     {
-        Memory::Copy(code_units_,
-                     Memory::MakeByteSpan(characters));
+        Release();
     }
 
     inline
     String
     ::operator StringView() const noexcept
     {
-        return StringView{ code_units_ };
+        return StringView{ GetCodeUnits() };
     }
 
     [[nodiscard]] inline Memory::ByteSpan
     String
     ::GetCodeUnits() const noexcept
     {
-        return ViewOf(code_units_);
+        if (IsInline())
+        {
+            auto& code_units = code_units_.inline_;
+
+            auto count = Memory::ToBytes(ToInt(code_units.count_));
+
+            return { code_units.data_, count };
+        }
+
+        auto& code_units = code_units_.heap_;
+
+        return { code_units.data_, Memory::ToBytes(code_units.count_) };
     }
 
     [[nodiscard]] inline Mutable<Memory::BaseAllocator>
     String
     ::GetAllocator() const noexcept
     {
-        return code_units_.GetAllocator();
+        return *allocator_;
+    }
+
+    [[nodiscard]] inline Bool
+    String
+    ::IsInline() const noexcept
+    {
+        return code_units_.inline_.count_ != kHeap;
     }
 
     inline void
     String
     ::Swap(Movable<String> rhs) noexcept
     {
-        Algorithms::Swap(code_units_, rhs.code_units_);
+        auto code_units = code_units_;
+
+        code_units_ = rhs.code_units_;
+        rhs.code_units_ = code_units;
+    }
+
+    inline void
+    String
+    ::Assign(Immutable<Memory::ByteSpan> code_units) noexcept
+    {
+        auto count = code_units.GetCount();
+
+        if (count <= Memory::ToBytes(kInlineCount))
+        {
+            auto& storage = code_units_.inline_;
+
+            storage.count_ = ToFix8(Memory::ToInt(count));
+
+            Memory::Copy(Memory::MakeByteSpan(storage.data_, count),
+                         code_units);
+
+            return;
+        }
+
+        auto block = allocator_->Allocate(count,
+                                          Memory::AlignmentOf<Memory::Byte>());
+
+        SYNTROPY_ASSERT(block.GetCount() == count);     // Out of memory?
+
+        Memory::Copy(block, code_units);
+
+        code_units_.heap_ = { kHeap, block.GetData(), Memory::ToInt(count) };
+    }
+
+    inline void
+    String
+    ::Release() noexcept
+    {
+        if (!IsInline())
+        {
+            auto& code_units = code_units_.heap_;
+
+            allocator_->Deallocate(
+                Memory::MakeByteSpan(code_units.data_,
+                                     Memory::ToBytes(code_units.count_)),
+                Memory::AlignmentOf<Memory::Byte>());
+        }
+
+        code_units_.inline_ = {};
     }
 
     /************************************************************************/
@@ -123,7 +259,59 @@ namespace Syntropy::Strings
     ToString(Immutable<TType> rhs) noexcept
         -> decltype(Details::RouteToString(rhs))
     {
-        Details::RouteToString(rhs);
+        return Details::RouteToString(rhs);
+    }
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::Strings::Extensions
+{
+    /************************************************************************/
+    /* TO STRING                                                            */
+    /************************************************************************/
+
+    template <Templates::IsBoolean TType>
+    [[nodiscard]] inline String ToString<TType>
+    ::operator()(Immutable<TType> rhs) const noexcept
+    {
+        auto characters = rhs ? "true" : "false";
+
+        auto code_units = Memory::MakeByteSpan(
+            Memory::ToBytePtr(characters),
+            Memory::ToBytes(rhs ? 4 : 5));
+
+        return String{ StringView{ code_units } };
+    }
+
+    template <Templates::IsIntegral TType>
+    [[nodiscard]] inline String ToString<TType>
+    ::operator()(Immutable<TType> rhs) const noexcept
+    {
+        // Large enough for the sign and the digits of any 64-bit value.
+
+        char characters[24];
+
+        auto result = std::to_chars(characters,
+                                    characters + sizeof(characters),
+                                    static_cast<Int>(rhs));
+
+        auto code_units = Memory::MakeByteSpan(
+            Memory::ToBytePtr(characters),
+            Memory::ToBytes(result.ptr - characters));
+
+        return String{ StringView{ code_units } };
+    }
+
+    template <Int TSize>
+    [[nodiscard]] inline String ToString<char[TSize]>
+    ::operator()(const char (&rhs)[TSize]) const noexcept
+    {
+        auto code_units = Memory::MakeByteSpan(Memory::ToBytePtr(rhs),
+                                               Memory::ToBytes(TSize - 1));
+
+        return String{ StringView{ code_units } };
     }
 
 }
@@ -0,0 +1,120 @@
+
+/// \file string_algorithm.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* SPLIT RANGE                                                          */
+    /************************************************************************/
+
+    inline SplitRange
+    ::SplitRange(Immutable<StringView> string_view,
+                 Immutable<StringView> delimiters,
+                 Bool skip_empty) noexcept
+        : SplitRange(string_view.GetCodeUnits(),
+                     delimiters.GetCodeUnits(),
+                     skip_empty)
+    {
+        auto code_units = delimiters.GetCodeUnits();
+
+        for (auto index = Int{ 0 }; index < ToInt(code_units.GetCount());
+             ++index)
+        {
+            auto code_unit = code_units[Memory::ToBytes(index)];
+
+            SYNTROPY_ASSERT(static_cast<std::uint8_t>(code_unit) < 0x80);
+        }
+    }
+
+    [[nodiscard]] inline StringView SplitRange
+    ::GetFront() const noexcept
+    {
+        auto front = Memory::MakeByteSpan(code_units_.GetData(),
+                                          Memory::ToBytes(front_count_));
+
+        return StringView{ front };
+    }
+
+    [[nodiscard]] inline Bool SplitRange
+    ::IsEmpty() const noexcept
+    {
+        return is_empty_;
+    }
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::Strings
+{
+    /************************************************************************/
+    /* STRING ALGORITHM                                                     */
+    /************************************************************************/
+
+    // Search.
+    // =======
+
+    [[nodiscard]] inline StringView
+    Find(Immutable<StringView> string_view,
+         Immutable<StringView> pattern) noexcept
+    {
+        return StringView{ Find(string_view.GetCodeUnits(),
+                                pattern.GetCodeUnits()) };
+    }
+
+    [[nodiscard]] inline StringView
+    FindAnyOf(Immutable<StringView> string_view,
+              Immutable<StringView> set) noexcept
+    {
+        return StringView{ FindAnyOf(string_view.GetCodeUnits(),
+                                     set.GetCodeUnits()) };
+    }
+
+    [[nodiscard]] inline Bool
+    Contains(Immutable<StringView> string_view,
+             Immutable<StringView> pattern) noexcept
+    {
+        auto result = Find(string_view.GetCodeUnits(),
+                           pattern.GetCodeUnits());
+
+        return result.GetCount() >= pattern.GetCodeUnits().GetCount();
+    }
+
+    // Split.
+    // ======
+
+    [[nodiscard]] inline SplitRange
+    Split(Immutable<StringView> string_view,
+          Immutable<StringView> delimiters) noexcept
+    {
+        return SplitRange{ string_view, delimiters, false };
+    }
+
+    [[nodiscard]] inline SplitRange
+    Tokenize(Immutable<StringView> string_view,
+             Immutable<StringView> delimiters) noexcept
+    {
+        return SplitRange{ string_view, delimiters, true };
+    }
+
+    // Comparison.
+    // ===========
+
+    [[nodiscard]] inline Bool
+    AreEqualIgnoreCase(Immutable<StringView> lhs,
+                       Immutable<StringView> rhs) noexcept
+    {
+        return (lhs.GetCodeUnits().GetCount()
+                == rhs.GetCodeUnits().GetCount())
+            && (CompareIgnoreCase(lhs, rhs) == Ordering::kEquivalent);
+    }
+
+}
+
+// ===========================================================================
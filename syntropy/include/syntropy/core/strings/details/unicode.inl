@@ -0,0 +1,139 @@
+
+/// \file unicode.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <cstdint>
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* CODE POINT RANGE                                                     */
+    /************************************************************************/
+
+    inline CodePointRange
+    ::CodePointRange(Immutable<StringView> string_view) noexcept
+        : code_units_(string_view.GetCodeUnits())
+    {
+
+    }
+
+    inline CodePointRange
+    ::CodePointRange(Immutable<Memory::ByteSpan> code_units) noexcept
+        : code_units_(code_units)
+    {
+
+    }
+
+    [[nodiscard]] inline char32_t CodePointRange
+    ::GetFront() const noexcept
+    {
+        auto lead = GetCodeUnit(0);
+
+        switch (GetLength(lead))
+        {
+            case 1:
+            {
+                return static_cast<char32_t>(lead);
+            }
+
+            case 2:
+            {
+                return static_cast<char32_t>(((lead & 0x1F) << 6)
+                                             | (GetCodeUnit(1) & 0x3F));
+            }
+
+            case 3:
+            {
+                return static_cast<char32_t>(((lead & 0x0F) << 12)
+                                             | ((GetCodeUnit(1) & 0x3F) << 6)
+                                             | (GetCodeUnit(2) & 0x3F));
+            }
+
+            default:
+            {
+                return static_cast<char32_t>(((lead & 0x07) << 18)
+                                             | ((GetCodeUnit(1) & 0x3F) << 12)
+                                             | ((GetCodeUnit(2) & 0x3F) << 6)
+                                             | (GetCodeUnit(3) & 0x3F));
+            }
+        }
+    }
+
+    [[nodiscard]] inline CodePointRange CodePointRange
+    ::PopFront() const noexcept
+    {
+        auto begin = code_units_.GetData() + GetLength(GetCodeUnit(0));
+        auto end = code_units_.GetData() + ToInt(code_units_.GetCount());
+
+        return CodePointRange{ Memory::MakeByteSpan(begin, end) };
+    }
+
+    [[nodiscard]] inline Bool CodePointRange
+    ::IsEmpty() const noexcept
+    {
+        return !code_units_;
+    }
+
+    [[nodiscard]] inline Immutable<Memory::ByteSpan> CodePointRange
+    ::GetCodeUnits() const noexcept
+    {
+        return code_units_;
+    }
+
+    [[nodiscard]] inline Int CodePointRange
+    ::GetLength(Int lead) noexcept
+    {
+        return (lead < 0x80) ? 1 : (lead < 0xE0) ? 2 : (lead < 0xF0) ? 3 : 4;
+    }
+
+    [[nodiscard]] inline Int CodePointRange
+    ::GetCodeUnit(Int index) const noexcept
+    {
+        return static_cast<std::uint8_t>(code_units_[Memory::ToBytes(index)]);
+    }
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::Strings
+{
+    /************************************************************************/
+    /* UNICODE                                                              */
+    /************************************************************************/
+
+    // Validation.
+    // ===========
+
+    [[nodiscard]] inline Bool
+    IsValidUTF8(Immutable<StringView> string_view) noexcept
+    {
+        return IsValidUTF8(string_view.GetCodeUnits());
+    }
+
+    // Decoding.
+    // =========
+
+    [[nodiscard]] inline CodePointRange
+    CodePointsOf(Immutable<StringView> string_view) noexcept
+    {
+        return CodePointRange{ string_view };
+    }
+
+    // Transcoding.
+    // ============
+
+    [[nodiscard]] inline Int
+    CountUTF32(Immutable<StringView> string_view) noexcept
+    {
+        return CountCodePoints(string_view);
+    }
+
+}
+
+// ===========================================================================
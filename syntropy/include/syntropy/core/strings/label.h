@@ -0,0 +1,228 @@
+
+/// \file label.h
+///
+/// \brief This header is part of the Syntropy core module.
+///        It contains definitions for interned immutable strings.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/core/strings/string_view.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    template <Int TSize>
+    struct LabelLiteral;
+
+    /************************************************************************/
+    /* LABEL                                                                */
+    /************************************************************************/
+
+    /// \brief An UTF-8-encoded immutable string optimized for fast
+    ///        comparison.
+    ///
+    /// Labels are interned in a process-wide registry: equal labels are
+    /// guaranteed to refer to the same code-units, therefore labels are
+    /// compared and hashed in constant time. Interned code-units are never
+    /// deallocated.
+    ///
+    /// Labels can be created concurrently from any thread: looking up an
+    /// existing label is lock-free, whereas interning a new label only
+    /// locks a fraction of the registry.
+    ///
+    /// Running out of registry storage is a fatal error.
+    ///
+    /// Well-known labels should be declared via the _label literal, which
+    /// hashes them at compile time and interns each of them once.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class Label
+    {
+    public:
+
+        /// \brief Create an empty label.
+        Label() noexcept;
+
+        /// \brief Create an empty label.
+        Label(Null) noexcept;
+
+        /// \brief Create a label from a null-terminated characters
+        ///        sequence.
+        ///
+        /// The null-terminator is not part of the label.
+        template <Int TSize>
+        Label(StringLiteral<TSize> characters) noexcept;
+
+        /// \brief Create a label from a characters sequence hashed at
+        ///        compile time.
+        template <Int TSize>
+        Label(Immutable<LabelLiteral<TSize>> characters) noexcept;
+
+        /// \brief Create a label from the characters in a string view.
+        explicit Label(Immutable<StringView> characters) noexcept;
+
+        /// \brief Default copy constructor.
+        Label(Immutable<Label> rhs) noexcept = default;
+
+        /// \brief Default copy-assignment operator.
+        Mutable<Label>
+        operator=(Immutable<Label> rhs) noexcept = default;
+
+        /// \brief Default destructor.
+        ~Label() noexcept = default;
+
+        /// \brief Implicit conversion to StringView.
+        operator StringView() const noexcept;
+
+        /// \brief Check whether the label is non-empty.
+        [[nodiscard]] explicit
+        operator Bool() const noexcept;
+
+        /// \brief Access the underlying code-units.
+        [[nodiscard]] Memory::ByteSpan
+        GetCodeUnits() const noexcept;
+
+        /// \brief Get the label hash.
+        ///
+        /// Unlike the label address, the hash is stable across runs.
+        [[nodiscard]] Int
+        GetHash() const noexcept;
+
+        /// \brief Swap this label with another one.
+        void
+        Swap(Mutable<Label> rhs) noexcept;
+
+        /// \brief Compute the hash of the label for a characters sequence,
+        ///        without interning it.
+        ///
+        /// Distinct labels may share the same hash: when switching on
+        /// label hashes, labels should be compared after their hash
+        /// matches.
+        template <Int TSize>
+        [[nodiscard]] static constexpr Int
+        Hash(StringLiteral<TSize> characters) noexcept;
+
+    private:
+
+        class Registry;
+
+        /// \brief An interned label, immediately followed by its
+        ///        code-units.
+        struct Entry
+        {
+            /// \brief Label hash.
+            Int hash_;
+
+            /// \brief Number of code-units.
+            Int count_;
+        };
+
+        /// \brief Hash of empty labels.
+        static constexpr Int
+        kEmptyHash = static_cast<Int>(14695981039346656037ull);
+
+        /// \brief Hash a sequence of code-units, via FNV-1a.
+        template <typename TCodeUnit>
+        [[nodiscard]] static constexpr Int
+        HashOf(Ptr<TCodeUnit> code_units, Int count) noexcept;
+
+        /// \brief Get the entry shared by empty labels.
+        [[nodiscard]] static Ptr<Entry>
+        GetEmpty() noexcept;
+
+        /// \brief Intern a sequence of code-units, given its hash.
+        ///
+        /// \remarks If the registry ran out of storage, the application
+        ///          is terminated.
+        [[nodiscard]] static Ptr<Entry>
+        Intern(Immutable<Memory::ByteSpan> code_units, Int hash) noexcept;
+
+        /// \brief Interned label.
+        Ptr<Entry> entry_{ nullptr };
+
+    };
+
+    /************************************************************************/
+    /* LABEL LITERAL <SIZE>                                                 */
+    /************************************************************************/
+
+    /// \brief A characters sequence whose label hash is computed at
+    ///        compile time.
+    ///
+    /// This type is meant to be used as a template argument of the _label
+    /// literal.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    template <Int TSize>
+    struct LabelLiteral
+    {
+        /// \brief Create a literal from a UTF-8 characters sequence.
+        consteval
+        LabelLiteral(StringLiteral<TSize> characters) noexcept;
+
+        /// \brief Create a literal from an ASCII characters sequence.
+        consteval
+        LabelLiteral(const char (&characters)[TSize]) noexcept;
+
+        /// \brief Characters sequence.
+        char8_t characters_[TSize] = {};
+
+        /// \brief Label hash.
+        Int hash_ = 0;
+    };
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Comparison.
+    // ===========
+
+    /// \brief Check whether two labels are equal.
+    [[nodiscard]] Bool
+    operator==(Immutable<Label> lhs, Immutable<Label> rhs) noexcept;
+
+    // Ranges.
+    // =======
+
+    /// \brief Get a view to a label.
+    ///
+    /// Labels are never deallocated: the view is valid even after the
+    /// label is destroyed.
+    [[nodiscard]] StringView
+    ViewOf(Immutable<Label> label) noexcept;
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::Literals
+{
+    /************************************************************************/
+    /* LITERALS                                                             */
+    /************************************************************************/
+
+    /// \brief User-defined literal used to declare a well-known label.
+    ///
+    /// The label hash is computed at compile time and the label is
+    /// interned the first time the literal is evaluated: further
+    /// evaluations don't hash nor look up the registry.
+    template <LabelLiteral TLiteral>
+    [[nodiscard]] Label
+    operator "" _label() noexcept;
+
+}
+
+// ===========================================================================
+
+#include "details/label.inl"
+
+// ===========================================================================
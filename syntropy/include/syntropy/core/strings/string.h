@@ -9,9 +9,9 @@
 #pragma once
 
 #include "syntropy/language/foundation/foundation.h"
+#include "syntropy/language/templates/concepts.h"
 
 #include "syntropy/memory/allocators/allocator.h"
-#include "syntropy/memory/foundation/buffer.h"
 #include "syntropy/memory/foundation/size.h"
 #include "syntropy/memory/foundation/byte.h"
 
@@ -31,39 +31,66 @@ namespace Syntropy
     /************************************************************************/
 
     /// \brief An UTF-8-encoded contiguous sequence of immutable characters.
+    ///
+    /// Strings up to kInlineCount code-units are stored inline, without
+    /// allocating any memory: the allocator is only used by longer
+    /// strings. BaseAllocator is set upon construction and is never
+    /// propagated.
     //
     /// \author Raffaele D. Facendola - February 2021.
     class String
     {
     public:
 
-        /// \brief Create an empty string.
-        String () noexcept = default;
+        /// \brief Maximum number of code-units stored inline.
+        static constexpr Int
+        kInlineCount = 23;
 
-        /// \brief Create an empty string.
+        /// \brief Create an empty string on the current allocator.
+        String () noexcept;
+
+        /// \brief Create an empty string on the current allocator.
         String (Null) noexcept;
 
         /// \brief Initialize a string from a characters sequence.
         template <Int TSize>
-        String(StringLiteral<TSize> characters) noexcept;
+        String(StringLiteral<TSize> characters,
+               Mutable<Memory::BaseAllocator> allocator
+                   = Memory::GetScopeAllocator()) noexcept;
+
+        /// \brief Initialize a string from a copy of the characters in a
+        ///        string view.
+        explicit String(Immutable<StringView> characters,
+                        Mutable<Memory::BaseAllocator> allocator
+                            = Memory::GetScopeAllocator()) noexcept;
 
-        /// \brief Default copy constructor.
-        String(Immutable<String> rhs) noexcept = default;
+        /// \brief Create a string which is a copy of rhs.
+        String(Immutable<String> rhs) noexcept;
 
-        /// \brief Default move constructor.
-        String(Movable<String> rhs) noexcept = default;
+        /// \brief Create a string by acquiring the ownership of another
+        ///        string.
+        ///
+        /// After this method rhs is guaranteed to be empty.
+        String(Movable<String> rhs) noexcept;
 
-        /// \brief Default copy-assignment operator.
+        /// \brief Copy-assignment operator.
+        ///
+        /// The allocator is not propagated.
         Mutable<String>
-        operator=(Immutable<String> rhs) noexcept = default;
+        operator=(Immutable<String> rhs) noexcept;
 
-        /// \brief Default move-assignment operator.
+        /// \brief Move-assignment operator.
+        ///
+        /// The allocator is not propagated, therefore if rhs allocator is
+        /// different that this one's, this method behaves as a
+        /// copy-assignment.
+        ///
         /// \remarks @rfacendola Clang doesn't recognize Movable<String> rhs.
         Mutable<String>
-        operator=(String&& rhs) noexcept = default;
+        operator=(String&& rhs) noexcept;
 
-        /// \brief Default destructor.
-        ~String() noexcept = default;
+        /// \brief Destructor.
+        ~String() noexcept;
 
         /// \brief Implicit conversion to StringView.
         operator StringView() const noexcept;
@@ -76,6 +103,10 @@ namespace Syntropy
         [[nodiscard]] Mutable<Memory::BaseAllocator>
         GetAllocator() const noexcept;
 
+        /// \brief Check whether the string code-units are stored inline.
+        [[nodiscard]] Bool
+        IsInline() const noexcept;
+
         /// \brief Swap this string with another one.
         ///
         /// \remarks If the strings don't share a common allocator, the behavior
@@ -85,9 +116,65 @@ namespace Syntropy
 
     private:
 
+        /// \brief Code-units stored inline.
+        struct Inline
+        {
+            /// \brief Number of code-units, or kHeap.
+            Fix8 count_;
+
+            /// \brief Inline code-units.
+            Memory::Byte data_[kInlineCount];
+        };
+
+        /// \brief Code-units stored out-of-line.
+        ///
+        /// The tag shares the same position of the inline count, therefore
+        /// it can always be inspected to tell which representation is in
+        /// use.
+        struct Heap
+        {
+            /// \brief Always kHeap.
+            Fix8 tag_;
+
+            /// \brief Allocated code-units.
+            Memory::RWBytePtr data_;
+
+            /// \brief Number of code-units.
+            Int count_;
+        };
+
+        /// \brief Either representation of the string code-units.
+        union CodeUnits
+        {
+            /// \brief Inline code-units.
+            Inline inline_{};
+
+            /// \brief Out-of-line code-units.
+            Heap heap_;
+        };
+
+        /// \brief Tag of out-of-line code-units.
+        static constexpr Fix8
+        kHeap = ToFix8(-1);
+
+        /// \brief Store a copy of the provided code-units, either inline or
+        ///        on the string allocator.
+        ///
+        /// \remarks The string must not own any allocated memory.
+        void
+        Assign(Immutable<Memory::ByteSpan> code_units) noexcept;
+
+        /// \brief Return allocated code-units, if any, to the allocator and
+        ///        make the string empty.
+        void
+        Release() noexcept;
+
+        /// \brief Owning allocator.
+        RWPtr<Memory::BaseAllocator> allocator_{ nullptr };
+
         /// \brief Sequence of code-units. Each code-point is encoded by no
         ///        more than four code-units.
-        Memory::Buffer code_units_;
+        CodeUnits code_units_;
 
     };
 
@@ -144,6 +231,41 @@ namespace Syntropy::Strings
 
 // ===========================================================================
 
+namespace Syntropy::Strings::Extensions
+{
+    /************************************************************************/
+    /* TO STRING                                                            */
+    /************************************************************************/
+
+    /// \brief Convert a boolean value to either "true" or "false".
+    template <Templates::IsBoolean TType>
+    struct ToString<TType>
+    {
+        [[nodiscard]] String
+        operator()(Immutable<TType> rhs) const noexcept;
+    };
+
+    /// \brief Convert an integral value to its decimal representation.
+    template <Templates::IsIntegral TType>
+    struct ToString<TType>
+    {
+        [[nodiscard]] String
+        operator()(Immutable<TType> rhs) const noexcept;
+    };
+
+    /// \brief Convert a null-terminated array of characters to a string,
+    ///        without the null-terminator.
+    template <Int TSize>
+    struct ToString<char[TSize]>
+    {
+        [[nodiscard]] String
+        operator()(const char (&rhs)[TSize]) const noexcept;
+    };
+
+}
+
+// ===========================================================================
+
 #include "details/string.inl"
 
 // ===========================================================================
@@ -0,0 +1,204 @@
+
+/// \file string_algorithm.h
+///
+/// \brief This header is part of the Syntropy core module.
+///        It contains definitions for searching, splitting and comparing
+///        strings.
+///
+/// None of the algorithms in this header allocates memory.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <cstdint>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/core/foundation/ordering.h"
+#include "syntropy/core/ranges/forward_range.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+#include "syntropy/core/strings/string_view.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* SPLIT RANGE                                                          */
+    /************************************************************************/
+
+    /// \brief Adapter class used to lazily split a string view into views
+    ///        separated by delimiters.
+    ///
+    /// Each delimiter is a single code-unit: since UTF-8 continuation
+    /// code-units are never ASCII, ASCII delimiters never split a
+    /// code-point.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class SplitRange
+    {
+    public:
+
+        /// \brief Create an empty range.
+        constexpr
+        SplitRange() noexcept = default;
+
+        /// \brief Create a range to the views in a string view separated
+        ///        by any of the provided delimiters.
+        ///
+        /// \param skip_empty Whether empty views, either between two
+        ///                   consecutive delimiters or at the boundaries of
+        ///                   the string view, are discarded.
+        ///
+        /// \remarks Each delimiter must be an ASCII code-unit.
+        SplitRange(Immutable<StringView> string_view,
+                   Immutable<StringView> delimiters,
+                   Bool skip_empty) noexcept;
+
+        /// \brief Default copy-constructor.
+        SplitRange(Immutable<SplitRange> rhs) noexcept = default;
+
+        /// \brief Default copy-assignment operator.
+        Mutable<SplitRange>
+        operator=(Immutable<SplitRange> rhs) noexcept = default;
+
+        /// \brief Default destructor.
+        ~SplitRange() noexcept = default;
+
+        /// \brief Access the first view in the range.
+        ///
+        /// \remarks Undefined behavior if the range is empty.
+        [[nodiscard]] StringView
+        GetFront() const noexcept;
+
+        /// \brief Discard the first view in the range and return the range
+        ///        to the remaining views.
+        ///
+        /// \remarks Undefined behavior if the range is empty.
+        [[nodiscard]] SplitRange
+        PopFront() const noexcept;
+
+        /// \brief Check whether the range is empty.
+        [[nodiscard]] Bool
+        IsEmpty() const noexcept;
+
+    private:
+
+        /// \brief Create a range to the views in a sequence of code-units.
+        SplitRange(Immutable<Memory::ByteSpan> code_units,
+                   Immutable<Memory::ByteSpan> delimiters,
+                   Bool skip_empty) noexcept;
+
+        /// \brief Code-units starting from the first view.
+        Memory::ByteSpan code_units_;
+
+        /// \brief Delimiter code-units.
+        Memory::ByteSpan delimiters_;
+
+        /// \brief Number of code-units in the first view.
+        Int front_count_{ 0 };
+
+        /// \brief Whether the range is exhausted.
+        Bool is_empty_{ true };
+
+        /// \brief Whether empty views are discarded.
+        Bool skip_empty_{ false };
+
+    };
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::Strings
+{
+    /************************************************************************/
+    /* STRING ALGORITHM                                                     */
+    /************************************************************************/
+
+    // Search.
+    // =======
+
+    /// \brief Reduce a sequence from the front until it starts with a
+    ///        pattern or the sequence is exhausted.
+    ///
+    /// \return Returns the reduced sequence starting from the first
+    ///         occurrence of pattern, or an empty sequence at the end of
+    ///         code-units if no occurrence was found.
+    [[nodiscard]] Memory::ByteSpan
+    Find(Immutable<Memory::ByteSpan> code_units,
+         Immutable<Memory::ByteSpan> pattern) noexcept;
+
+    /// \brief Reduce a string view from the front until it starts with a
+    ///        pattern or the string view is exhausted.
+    [[nodiscard]] StringView
+    Find(Immutable<StringView> string_view,
+         Immutable<StringView> pattern) noexcept;
+
+    /// \brief Reduce a sequence from the front until it starts with any
+    ///        code-unit in a set or the sequence is exhausted.
+    [[nodiscard]] Memory::ByteSpan
+    FindAnyOf(Immutable<Memory::ByteSpan> code_units,
+              Immutable<Memory::ByteSpan> set) noexcept;
+
+    /// \brief Reduce a string view from the front until it starts with any
+    ///        code-unit in a set or the string view is exhausted.
+    [[nodiscard]] StringView
+    FindAnyOf(Immutable<StringView> string_view,
+              Immutable<StringView> set) noexcept;
+
+    /// \brief Check whether a string view contains a pattern.
+    [[nodiscard]] Bool
+    Contains(Immutable<StringView> string_view,
+             Immutable<StringView> pattern) noexcept;
+
+    // Split.
+    // ======
+
+    /// \brief Split a string view by any code-unit in a set of
+    ///        delimiters.
+    ///
+    /// Consecutive delimiters delimit empty views: splitting "a,,b" by ","
+    /// results in "a", "" and "b".
+    [[nodiscard]] SplitRange
+    Split(Immutable<StringView> string_view,
+          Immutable<StringView> delimiters) noexcept;
+
+    /// \brief Split a string view in non-empty tokens, separated by any
+    ///        code-unit in a set of delimiters.
+    ///
+    /// Consecutive delimiters are treated as one: tokenizing " a  b " by
+    /// " " results in "a" and "b".
+    [[nodiscard]] SplitRange
+    Tokenize(Immutable<StringView> string_view,
+             Immutable<StringView> delimiters) noexcept;
+
+    // Comparison.
+    // ===========
+
+    /// \brief Check whether two string views are equal, ignoring the case
+    ///        of ASCII letters.
+    [[nodiscard]] Bool
+    AreEqualIgnoreCase(Immutable<StringView> lhs,
+                       Immutable<StringView> rhs) noexcept;
+
+    /// \brief Compare two string views lexicographically, ignoring the
+    ///        case of ASCII letters.
+    ///
+    /// Letters are compared as lower-case.
+    [[nodiscard]] Ordering
+    CompareIgnoreCase(Immutable<StringView> lhs,
+                      Immutable<StringView> rhs) noexcept;
+
+}
+
+// ===========================================================================
+
+#include "details/string_algorithm.inl"
+
+// ===========================================================================
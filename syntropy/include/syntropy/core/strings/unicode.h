@@ -0,0 +1,198 @@
+
+/// \file unicode.h
+///
+/// \brief This header is part of the Syntropy core module.
+///        It contains definitions for UTF-8 validation, decoding and
+///        transcoding.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/core/ranges/span.h"
+#include "syntropy/core/ranges/forward_range.h"
+
+#include "syntropy/core/strings/string_view.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* CODE POINT RANGE                                                     */
+    /************************************************************************/
+
+    /// \brief Adapter class used to iterate the code-points of an
+    ///        UTF-8-encoded sequence.
+    ///
+    /// Code-units are expected to be well-formed UTF-8, as checked by
+    /// Strings::IsValidUTF8.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class CodePointRange
+    {
+    public:
+
+        /// \brief Create an empty range.
+        constexpr
+        CodePointRange() noexcept = default;
+
+        /// \brief Create a range to the code-points in a string view.
+        explicit
+        CodePointRange(Immutable<StringView> string_view) noexcept;
+
+        /// \brief Create a range to the code-points in a sequence of
+        ///        code-units.
+        explicit
+        CodePointRange(Immutable<Memory::ByteSpan> code_units) noexcept;
+
+        /// \brief Default copy-constructor.
+        CodePointRange(Immutable<CodePointRange> rhs) noexcept = default;
+
+        /// \brief Default copy-assignment operator.
+        Mutable<CodePointRange>
+        operator=(Immutable<CodePointRange> rhs) noexcept = default;
+
+        /// \brief Default destructor.
+        ~CodePointRange() noexcept = default;
+
+        /// \brief Decode the first code-point in the range.
+        ///
+        /// \remarks Undefined behavior if the range is empty.
+        [[nodiscard]] char32_t
+        GetFront() const noexcept;
+
+        /// \brief Discard the first code-point in the range and return the
+        ///        range to the remaining code-points.
+        ///
+        /// \remarks Undefined behavior if the range is empty.
+        [[nodiscard]] CodePointRange
+        PopFront() const noexcept;
+
+        /// \brief Check whether the range is empty.
+        [[nodiscard]] Bool
+        IsEmpty() const noexcept;
+
+        /// \brief Access the code-units of the remaining code-points.
+        [[nodiscard]] Immutable<Memory::ByteSpan>
+        GetCodeUnits() const noexcept;
+
+    private:
+
+        /// \brief Get the number of code-units in a sequence, from its
+        ///        leading code-unit.
+        [[nodiscard]] static Int
+        GetLength(Int lead) noexcept;
+
+        /// \brief Access the code-unit at given index as an unsigned value.
+        [[nodiscard]] Int
+        GetCodeUnit(Int index) const noexcept;
+
+        /// \brief Remaining code-units.
+        Memory::ByteSpan code_units_;
+
+    };
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::Strings
+{
+    /************************************************************************/
+    /* UNICODE                                                              */
+    /************************************************************************/
+
+    // Validation.
+    // ===========
+
+    /// \brief Check whether a sequence of code-units is well-formed UTF-8.
+    ///
+    /// Overlong encodings, surrogates, code-points above U+10FFFF and
+    /// truncated sequences are rejected.
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<Memory::ByteSpan> code_units) noexcept;
+
+    /// \brief Check whether a string view is well-formed UTF-8.
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<StringView> string_view) noexcept;
+
+    // Decoding.
+    // =========
+
+    /// \brief Get the number of code-points in a well-formed string view.
+    [[nodiscard]] Int
+    CountCodePoints(Immutable<StringView> string_view) noexcept;
+
+    /// \brief Get a range to the code-points in a well-formed string view.
+    [[nodiscard]] CodePointRange
+    CodePointsOf(Immutable<StringView> string_view) noexcept;
+
+    // Transcoding.
+    // ============
+
+    // Conversions from UTF-8 expect well-formed code-units. Conversions to
+    // UTF-8 replace unpaired surrogates and values above U+10FFFF with
+    // U+FFFD. Conversions stop before the first code-point that doesn't
+    // fit the destination in its entirety.
+
+    /// \brief Get the number of UTF-16 code-units needed to encode a
+    ///        well-formed string view.
+    [[nodiscard]] Int
+    CountUTF16(Immutable<StringView> string_view) noexcept;
+
+    /// \brief Get the number of UTF-32 code-units needed to encode a
+    ///        well-formed string view.
+    [[nodiscard]] Int
+    CountUTF32(Immutable<StringView> string_view) noexcept;
+
+    /// \brief Get the number of UTF-8 code-units needed to encode a
+    ///        sequence of UTF-16 code-units.
+    [[nodiscard]] Memory::Bytes
+    CountUTF8(Immutable<Span<char16_t>> code_units) noexcept;
+
+    /// \brief Get the number of UTF-8 code-units needed to encode a
+    ///        sequence of UTF-32 code-units.
+    [[nodiscard]] Memory::Bytes
+    CountUTF8(Immutable<Span<char32_t>> code_units) noexcept;
+
+    /// \brief Convert a well-formed string view to UTF-16.
+    ///
+    /// \return Returns the number of code-units written to destination.
+    Int
+    ToUTF16(Immutable<StringView> string_view,
+            Immutable<RWSpan<char16_t>> destination) noexcept;
+
+    /// \brief Convert a well-formed string view to UTF-32.
+    ///
+    /// \return Returns the number of code-units written to destination.
+    Int
+    ToUTF32(Immutable<StringView> string_view,
+            Immutable<RWSpan<char32_t>> destination) noexcept;
+
+    /// \brief Convert a sequence of UTF-16 code-units to UTF-8.
+    ///
+    /// \return Returns the number of code-units written to destination.
+    Memory::Bytes
+    FromUTF16(Immutable<Span<char16_t>> code_units,
+              Immutable<Memory::RWByteSpan> destination) noexcept;
+
+    /// \brief Convert a sequence of UTF-32 code-units to UTF-8.
+    ///
+    /// \return Returns the number of code-units written to destination.
+    Memory::Bytes
+    FromUTF32(Immutable<Span<char32_t>> code_units,
+              Immutable<Memory::RWByteSpan> destination) noexcept;
+
+}
+
+// ===========================================================================
+
+#include "details/unicode.inl"
+
+// ===========================================================================
@@ -110,6 +110,11 @@ namespace Syntropy::Templates
     concept IsStandardLayoutType
         = (Details::IsStandardLayoutType<TTypes> && ...);
 
+    /// \brief True if all types are empty class types.
+    template <typename... TTypes>
+    concept IsEmpty
+        = (Details::IsEmpty<TTypes> && ...);
+
     /// \brief True is TType can be constructed by TArguments.
     template <typename TType, typename... TArguments>
     concept IsConstructibleFrom
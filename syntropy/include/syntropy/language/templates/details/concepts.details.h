@@ -113,6 +113,10 @@ namespace Syntropy::Templates::Details
     template <typename TType>
     concept IsStandardLayoutType = std::is_standard_layout_v<TType>;
 
+    /// \brief Concept for class types with no non-static data member.
+    template <typename TType>
+    concept IsEmpty = std::is_empty_v<TType>;
+
     /// \brief Concept for types that can be constructed by TArguments... .
     template <typename TType, typename... TArguments>
     concept IsConstructibleFrom
@@ -0,0 +1,60 @@
+/// \file allocation_context.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for scope-based allocation contexts.
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* ALLOCATION CONTEXT                                                   */
+    /************************************************************************/
+
+    /// \brief Represents a RAII guard used to change the active thread-local
+    ///        allocator in the current scope and restore the previous one
+    ///        upon destruction.
+    ///
+    /// Allocation contexts can be nested but overlapping results in
+    /// undefined behavior.
+    ///
+    /// \author Raffaele D. Facendola - April 2020.
+    class AllocationContext
+    {
+    public:
+
+        /// \brief Set a new active allocator for the current scope.
+        AllocationContext(Mutable<BaseAllocator> allocator) noexcept;
+
+        /// \brief No copy constructor.
+        AllocationContext(Immutable<AllocationContext>) = delete;
+
+        /// \brief Restore the previous active allocator.
+        ~AllocationContext() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<AllocationContext>
+        operator=(Immutable<AllocationContext>) = delete;
+
+    private:
+
+        /// \brief Allocator active before this context.
+        RWPtr<BaseAllocator> previous_allocator_{ nullptr };
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/allocation_context.inl"
+
+// ===========================================================================
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "syntropy/language/foundation/foundation.h"
+#include "syntropy/language/templates/concepts.h"
 
 #include "syntropy/memory/foundation/byte_span.h"
 #include "syntropy/memory/foundation/size.h"
@@ -42,6 +43,45 @@ namespace Syntropy::Templates
               // Deallocate a memory block.
               allocator.Deallocate(block, alignment);
           };
+
+    /// \brief Concept for allocators which can resize a memory block
+    ///        in-place.
+    template <typename TAllocator>
+    concept ReallocatingAllocator
+        = Allocator<TAllocator>
+        && requires(Mutable<TAllocator> allocator,
+                    Immutable<Memory::RWByteSpan> block,
+                    Memory::Bytes size,
+                    Memory::Alignment alignment)
+          {
+              // Resize a memory block in-place.
+              { allocator.Reallocate(block, size, alignment) }
+                -> IsSame<Bool>;
+          };
+
+    /// \brief Concept for allocators which can allocate zero-filled
+    ///        memory blocks without writing them, for instance because
+    ///        fresh memory pages are known to be zero.
+    template <typename TAllocator>
+    concept ZeroingAllocator
+        = Allocator<TAllocator>
+        && requires(Mutable<TAllocator> allocator,
+                    Memory::Bytes size,
+                    Memory::Alignment alignment)
+          {
+              // Allocate a zero-filled memory block.
+              { allocator.AllocateZeroed(size, alignment) }
+                -> IsSame<Memory::RWByteSpan>;
+          };
+
+    /// \brief Concept for allocators carrying no state, such that any
+    ///        default-constructed instance can deallocate blocks allocated
+    ///        by any other instance.
+    template <typename TAllocator>
+    concept StatelessAllocator
+        = Allocator<TAllocator>
+        && IsEmpty<TAllocator>
+        && IsDefaultConstructible<TAllocator>;
 }
 
 // ===========================================================================
@@ -79,6 +119,18 @@ namespace Syntropy::Memory
     Mutable<BaseAllocator>
     SetAllocator(Mutable<BaseAllocator> allocator) noexcept;
 
+    /// \brief Allocate a zero-filled memory block on an allocator.
+    ///
+    /// Blocks are zeroed explicitly unless the allocator is a
+    /// ZeroingAllocator.
+    ///
+    /// If a memory block could not be allocated, returns an empty block.
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] RWByteSpan
+    AllocateZeroed(Mutable<TAllocator> allocator,
+                   Bytes size,
+                   Alignment alignment) noexcept;
+
     /************************************************************************/
     /* BASE ALLOCATOR                                                       */
     /************************************************************************/
@@ -119,6 +171,15 @@ namespace Syntropy::Memory
         [[nodiscard]] virtual RWByteSpan
         Allocate(Bytes size, Alignment alignment) noexcept = 0;
 
+        /// \brief Allocate a zero-filled memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        ///
+        /// Blocks are zeroed explicitly, unless the allocator knows them
+        /// to be zero already. Blocks shall be deallocated via
+        /// ::Deallocate(block, alignment).
+        [[nodiscard]] virtual RWByteSpan
+        AllocateZeroed(Bytes size, Alignment alignment) noexcept;
+
         /// \brief Deallocate a memory block.
         /// \remarks The behavior of this function is undefined unless the
         ///          provided block was returned by a previous call to
@@ -127,6 +188,20 @@ namespace Syntropy::Memory
         Deallocate(Immutable<RWByteSpan> block,
                    Alignment alignment) noexcept = 0;
 
+        /// \brief Attempt to resize a memory block in-place.
+        ///
+        /// If the block could be resized without moving its content,
+        /// returns true and the block shall be deallocated with the new
+        /// size, otherwise returns false and the block is left untouched.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        [[nodiscard]] virtual Bool
+        Reallocate(Immutable<RWByteSpan> block,
+                   Bytes size,
+                   Alignment alignment) noexcept;
+
     private:
 
         /// \brief Get the active allocator in the current scope.
@@ -159,10 +234,26 @@ namespace Syntropy::Memory
         [[nodiscard]] virtual RWByteSpan
         Allocate(Bytes size, Alignment alignment) noexcept override;
 
+        /// \brief Allocate a zero-filled memory block.
+        ///
+        /// Blocks are zeroed explicitly unless the underlying allocator is
+        /// a ZeroingAllocator.
+        [[nodiscard]] virtual RWByteSpan
+        AllocateZeroed(Bytes size, Alignment alignment) noexcept override;
+
         virtual void
         Deallocate(Immutable<RWByteSpan> block,
                    Alignment alignment) noexcept override;
 
+        /// \brief Attempt to resize a memory block in-place.
+        ///
+        /// Always fails unless the underlying allocator is a
+        /// ReallocatingAllocator.
+        [[nodiscard]] virtual Bool
+        Reallocate(Immutable<RWByteSpan> block,
+                   Bytes size,
+                   Alignment alignment) noexcept override;
+
         /// \brief Access the underlying allocator.
         [[nodiscard]] Mutable<TAllocator>
         GetAllocator();
@@ -177,6 +268,40 @@ namespace Syntropy::Memory
         TAllocator allocator_;
 
     };
+
+    /************************************************************************/
+    /* STATIC ALLOCATOR                                                     */
+    /************************************************************************/
+
+    /// \brief Represents a stateless handle to an allocator instance known
+    ///        at compile time.
+    ///
+    /// Used to refer to an allocator with static storage duration where a
+    /// StatelessAllocator is expected.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    template <auto& TInstance>
+    class StaticAllocator
+    {
+    public:
+
+        /// \brief Allocate a new memory block on the underlying instance.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block on the underlying instance.
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] static constexpr decltype(TInstance)
+        GetAllocator() noexcept;
+
+    };
 }
 
 // ===========================================================================
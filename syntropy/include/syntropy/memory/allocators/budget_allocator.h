@@ -0,0 +1,366 @@
+/// \file budget_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for hierarchical memory budgets and
+///        allocators enforcing them.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* MEMORY BUDGET                                                        */
+    /************************************************************************/
+
+    /// \brief Represents a named memory budget, nested under a parent
+    ///        budget.
+    ///
+    /// Memory charged to a budget is charged to each of its ancestors up
+    /// to the root budget as well. Each budget can be given a soft limit,
+    /// whose callback is invoked when the limit is first exceeded, and a
+    /// hard limit, past which charges are rejected.
+    ///
+    /// Accounting is lock-free and batched: each thread charges a stripe
+    /// of the budget, which reserves memory from the hierarchy in batches
+    /// of kBatchSize bytes. Limits are enforced on reserved memory, which
+    /// exceeds usage by the credit left on stripes: up to 3 * kBatchSize
+    /// bytes per stripe, that is up to 3 * kBatchSize * kStripeCount bytes
+    /// per budget, summed over the budget and each nested budget. Before
+    /// rejecting a charge, the budget whose limit would be exceeded returns
+    /// the credit of its nested budgets and its own, and the charge is
+    /// retried.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class MemoryBudget
+    {
+    public:
+
+        /// \brief Statistics of a budget.
+        struct TStatistics;
+
+        /// \brief Callback invoked when a budget limit is exceeded.
+        ///
+        /// The callback is invoked on the charging thread, with the budget
+        /// whose limit was exceeded and the memory reserved by it.
+        using TLimitCallback = void (*)(Immutable<MemoryBudget> budget,
+                                        Bytes reserved) noexcept;
+
+        /// \brief Limit value for budgets without any limit.
+        static constexpr Int
+        kUnlimited = std::numeric_limits<Int>::max();
+
+        /// \brief Number of stripes in each budget.
+        static constexpr Int
+        kStripeCount = 16;
+
+        /// \brief Amount of memory reserved by a stripe at once, in bytes.
+        static constexpr Int
+        kBatchSize = 65536;
+
+        /// \brief Get the root budget, which has no limit by default.
+        [[nodiscard]] static Mutable<MemoryBudget>
+        GetRoot() noexcept;
+
+        /// \brief Create a new budget nested under a parent budget.
+        ///
+        /// \param name Budget name, which must outlive the budget.
+        /// \param parent Parent budget, which must outlive the budget.
+        MemoryBudget(Ptr<char> name,
+                     Mutable<MemoryBudget> parent = GetRoot()) noexcept;
+
+        /// \brief No copy constructor.
+        MemoryBudget(Immutable<MemoryBudget>) = delete;
+
+        /// \brief Destructor.
+        ///
+        /// Memory still charged to the budget is returned to its ancestors.
+        ///
+        /// \remarks The behavior of this method is undefined if the budget
+        ///          has any nested budget.
+        ~MemoryBudget() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<MemoryBudget>
+        operator=(Immutable<MemoryBudget>) = delete;
+
+        /// \brief Charge memory to this budget and its ancestors.
+        ///
+        /// \return Returns true if the memory could be charged, returns
+        ///         false if a hard limit would be exceeded.
+        [[nodiscard]] Bool
+        Charge(Bytes size) noexcept;
+
+        /// \brief Return memory charged to this budget.
+        ///
+        /// \remarks The behavior of this method is undefined unless the
+        ///          memory was charged by a previous call to
+        ///          ::Charge(size).
+        void
+        Refund(Bytes size) noexcept;
+
+        /// \brief Set the soft limit and its callback.
+        ///
+        /// The callback is invoked each time the memory reserved by the
+        /// budget crosses the limit upwards.
+        void
+        SetSoftLimit(Bytes limit, TLimitCallback callback = nullptr) noexcept;
+
+        /// \brief Set the hard limit and its callback.
+        ///
+        /// The callback is invoked each time a charge is rejected due to
+        /// this limit.
+        void
+        SetHardLimit(Bytes limit, TLimitCallback callback = nullptr) noexcept;
+
+        /// \brief Get the budget name.
+        [[nodiscard]] Ptr<char>
+        GetName() const noexcept;
+
+        /// \brief Get the parent budget. The root budget has no parent.
+        [[nodiscard]] RWPtr<MemoryBudget>
+        GetParent() const noexcept;
+
+        /// \brief Get the memory charged to this budget and its nested
+        ///        budgets.
+        ///
+        /// \remarks This method is meant for telemetry: the result is
+        ///          approximate while other threads are charging memory.
+        [[nodiscard]] Bytes
+        GetUsage() const noexcept;
+
+        /// \brief Collect statistics of this budget and every nested
+        ///        budget, depth-first.
+        ///
+        /// The function is called with an Immutable<TStatistics> argument,
+        /// for each budget. Parents are visited before their children.
+        ///
+        /// \remarks Budgets cannot be created or destroyed during this
+        ///          call.
+        template <typename TFunction>
+        void
+        Snapshot(Forwarding<TFunction> function) const noexcept;
+
+    private:
+
+        /// \brief Per-thread accounting state, on its own cache line.
+        struct alignas(64) Stripe
+        {
+            /// \brief Memory reserved by the stripe but not charged yet.
+            std::atomic<Int> credit_{ 0 };
+
+            /// \brief Number of charges performed on the stripe.
+            std::atomic<Int> charge_count_{ 0 };
+        };
+
+        /// \brief Create the root budget.
+        MemoryBudget(Ptr<char> name, Null parent) noexcept;
+
+        /// \brief Get the index of the calling thread.
+        [[nodiscard]] static Int
+        GetThreadIndex() noexcept;
+
+        /// \brief Get the lock guarding the budget hierarchy.
+        [[nodiscard]] static Mutable<std::mutex>
+        GetHierarchyMutex() noexcept;
+
+        /// \brief Reserve memory on this budget and its ancestors.
+        ///
+        /// \return Returns nullptr if the memory could be reserved,
+        ///         otherwise returns the budget whose hard limit would be
+        ///         exceeded.
+        [[nodiscard]] RWPtr<MemoryBudget>
+        Reserve(Int size) noexcept;
+
+        /// \brief Return reserved memory from this budget and its
+        ///        ancestors.
+        void
+        Unreserve(Int size) noexcept;
+
+        /// \brief Return unused batches of each stripe.
+        void
+        Drain() noexcept;
+
+        /// \brief Return unused batches of each stripe of this budget and
+        ///        its nested budgets.
+        ///
+        /// \remarks The caller must hold the hierarchy lock.
+        void
+        DrainTree() noexcept;
+
+        /// \brief Get the memory reserved but not charged by this budget
+        ///        and its nested budgets.
+        ///
+        /// \remarks The caller must hold the hierarchy lock.
+        [[nodiscard]] Int
+        GetCredit() const noexcept;
+
+        /// \brief Visit this budget and its nested budgets.
+        ///
+        /// \remarks The caller must hold the hierarchy lock.
+        template <typename TFunction>
+        void
+        Visit(Mutable<TFunction> function, Int depth) const noexcept;
+
+        /// \brief Budget name.
+        Ptr<char> name_{ nullptr };
+
+        /// \brief Parent budget.
+        RWPtr<MemoryBudget> parent_{ nullptr };
+
+        /// \brief First nested budget.
+        RWPtr<MemoryBudget> first_child_{ nullptr };
+
+        /// \brief Next budget sharing the same parent.
+        RWPtr<MemoryBudget> next_sibling_{ nullptr };
+
+        /// \brief Memory reserved by this budget and its nested budgets.
+        std::atomic<Int> reserved_{ 0 };
+
+        /// \brief Peak of reserved memory.
+        std::atomic<Int> peak_{ 0 };
+
+        /// \brief Soft limit.
+        std::atomic<Int> soft_limit_{ kUnlimited };
+
+        /// \brief Hard limit.
+        std::atomic<Int> hard_limit_{ kUnlimited };
+
+        /// \brief Callback invoked when the soft limit is exceeded.
+        std::atomic<TLimitCallback> soft_callback_{ nullptr };
+
+        /// \brief Callback invoked when a charge is rejected.
+        std::atomic<TLimitCallback> hard_callback_{ nullptr };
+
+        /// \brief Number of charges rejected due to the hard limit.
+        std::atomic<Int> rejection_count_{ 0 };
+
+        /// \brief Per-thread accounting state.
+        Stripe stripes_[kStripeCount];
+
+    };
+
+    /************************************************************************/
+    /* MEMORY BUDGET :: STATISTICS                                          */
+    /************************************************************************/
+
+    /// \brief Statistics of a budget.
+    struct MemoryBudget::TStatistics
+    {
+        /// \brief Budget name.
+        Ptr<char> name_{ nullptr };
+
+        /// \brief Depth of the budget in the visited hierarchy.
+        Int depth_{ 0 };
+
+        /// \brief Memory charged to the budget and its nested budgets.
+        Bytes usage_;
+
+        /// \brief Memory reserved by the budget and its nested budgets.
+        Bytes reserved_;
+
+        /// \brief Peak of reserved memory.
+        Bytes peak_;
+
+        /// \brief Soft limit.
+        Bytes soft_limit_;
+
+        /// \brief Hard limit.
+        Bytes hard_limit_;
+
+        /// \brief Number of charges performed on the budget.
+        Int charge_count_{ 0 };
+
+        /// \brief Number of charges rejected due to the hard limit.
+        Int rejection_count_{ 0 };
+    };
+
+    /************************************************************************/
+    /* BUDGET ALLOCATOR                                                     */
+    /************************************************************************/
+
+    /// \brief Tier Omega allocator used to charge allocations performed on
+    ///        another allocator to a memory budget.
+    ///
+    /// Allocations exceeding any hard limit of the budget hierarchy fail.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class BudgetAllocator : public BaseAllocator
+    {
+    public:
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param budget Budget allocations are charged to.
+        /// \param allocator Underlying allocator.
+        BudgetAllocator(Mutable<MemoryBudget> budget,
+                        Mutable<BaseAllocator> allocator
+                            = GetScopeAllocator()) noexcept;
+
+        /// \brief Default virtual destructor.
+        virtual ~BudgetAllocator() = default;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated or the budget would be
+        /// exceeded, returns an empty block.
+        [[nodiscard]] virtual RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept override;
+
+        /// \brief Allocate a new zero-filled memory block.
+        /// If a memory block could not be allocated or the budget would be
+        /// exceeded, returns an empty block.
+        [[nodiscard]] virtual RWByteSpan
+        AllocateZeroed(Bytes size, Alignment alignment) noexcept override;
+
+        virtual void
+        Deallocate(Immutable<RWByteSpan> block,
+                   Alignment alignment) noexcept override;
+
+        /// \brief Attempt to resize a memory block in-place.
+        ///
+        /// Growing a block fails if the budget would be exceeded.
+        [[nodiscard]] virtual Bool
+        Reallocate(Immutable<RWByteSpan> block,
+                   Bytes size,
+                   Alignment alignment) noexcept override;
+
+        /// \brief Access the budget.
+        [[nodiscard]] Mutable<MemoryBudget>
+        GetBudget() const noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<BaseAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief Budget allocations are charged to.
+        RWPtr<MemoryBudget> budget_{ nullptr };
+
+        /// \brief Underlying allocator.
+        RWPtr<BaseAllocator> allocator_{ nullptr };
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/budget_allocator.inl"
+
+// ===========================================================================
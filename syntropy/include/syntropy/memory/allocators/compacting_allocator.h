@@ -0,0 +1,236 @@
+/// \file compacting_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for handle-based compacting allocators.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+#include "syntropy/virtual_memory/foundation/virtual_buffer.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* COMPACTING ALLOCATOR                                                 */
+    /************************************************************************/
+
+    /// \brief Tier 0 allocator whose blocks are referred to by handles and
+    ///        can be relocated to defragment memory.
+    ///
+    /// Blocks are allocated sequentially on a reserved virtual memory
+    /// range. Deallocated blocks leave holes which are reclaimed by an
+    /// incremental compaction that slides unpinned blocks towards the
+    /// beginning of the range, then returns trailing pages to the system.
+    ///
+    /// Handles are generation-checked: handles to deallocated blocks are
+    /// detected even if their slot was reused. Blocks must be pinned
+    /// while accessed via pointers, or accessed only between compaction
+    /// steps.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class CompactingAllocator
+    {
+    public:
+
+        /// \brief A handle to a relocatable block.
+        class THandle;
+
+        /// \brief Granularity of each block, in bytes. This is also the
+        ///        maximum alignment supported.
+        static constexpr Int
+        kGranularity = 16;
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param capacity Maximum amount of memory for blocks.
+        /// \param handle_count Maximum number of live blocks.
+        CompactingAllocator(Bytes capacity, Int handle_count) noexcept;
+
+        /// \brief No copy constructor.
+        CompactingAllocator(Immutable<CompactingAllocator>) = delete;
+
+        /// \brief Default destructor.
+        ~CompactingAllocator() noexcept = default;
+
+        /// \brief No assignment operator.
+        Mutable<CompactingAllocator>
+        operator=(Immutable<CompactingAllocator>) = delete;
+
+        /// \brief Allocate a new memory block.
+        ///
+        /// If the allocator is exhausted, a full compaction is performed
+        /// before giving up.
+        ///
+        /// \return Returns a handle to the new block. If a memory block
+        ///         could not be allocated, returns an empty handle.
+        [[nodiscard]] THandle
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided handle is valid and the block is not pinned.
+        void
+        Deallocate(Immutable<THandle> handle) noexcept;
+
+        /// \brief Check whether a handle refers to a live block.
+        [[nodiscard]] Bool
+        IsValid(Immutable<THandle> handle) const noexcept;
+
+        /// \brief Access a block, preventing compaction from moving it until
+        ///        a matching call to ::Unpin(handle).
+        ///
+        /// Pins are counted: a block can be pinned multiple times.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided handle is valid.
+        [[nodiscard]] RWByteSpan
+        Pin(Immutable<THandle> handle) noexcept;
+
+        /// \brief Release a pin on a block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided handle is valid and pinned.
+        void
+        Unpin(Immutable<THandle> handle) noexcept;
+
+        /// \brief Access a block without pinning it.
+        ///
+        /// \remarks The returned span is invalidated by the next compaction
+        ///          step or allocation, unless the block is pinned.
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided handle is valid.
+        [[nodiscard]] RWByteSpan
+        Resolve(Immutable<THandle> handle) const noexcept;
+
+        /// \brief Perform an incremental compaction step.
+        ///
+        /// \param budget Maximum amount of memory scanned by this step.
+        ///               Each scanned block is moved at most once.
+        ///
+        /// \return Returns true if a compaction cycle was completed by this
+        ///         step, returns false otherwise.
+        Bool
+        Compact(Bytes budget) noexcept;
+
+        /// \brief Get the total size of live blocks.
+        [[nodiscard]] Bytes
+        GetAllocatedSize() const noexcept;
+
+        /// \brief Get the extent of the memory used by blocks, including
+        ///        holes which weren't compacted yet.
+        [[nodiscard]] Bytes
+        GetUsedSize() const noexcept;
+
+    private:
+
+        /// \brief Header of a block.
+        struct Block;
+
+        /// \brief Entry in the handle table.
+        struct Entry;
+
+        /// \brief Acquire an entry in the handle table.
+        /// If no entry could be acquired, returns a negative index.
+        [[nodiscard]] Int
+        AcquireEntry() noexcept;
+
+        /// \brief Commit the heap up to a given address.
+        [[nodiscard]] Bool
+        CommitUpTo(RWBytePtr end) noexcept;
+
+        /// \brief Return heap pages past the last block to the system.
+        void
+        Trim() noexcept;
+
+        /// \brief Memory blocks are allocated on.
+        VirtualMemory::VirtualBuffer heap_;
+
+        /// \brief Memory handle table entries are allocated on.
+        VirtualMemory::VirtualBuffer table_;
+
+        /// \brief Maximum number of entries in the handle table.
+        Int handle_count_{ 0 };
+
+        /// \brief Number of entries initialized so far.
+        Int entry_count_{ 0 };
+
+        /// \brief Index of the first free entry. Negative if none.
+        Int free_entry_{ -1 };
+
+        /// \brief Pointer past the last block.
+        RWBytePtr top_{ nullptr };
+
+        /// \brief Pointer past the last committed heap byte.
+        RWBytePtr heap_committed_{ nullptr };
+
+        /// \brief Pointer past the last committed table byte.
+        RWBytePtr table_committed_{ nullptr };
+
+        /// \brief Next block to be scanned by the current compaction cycle.
+        ///        Null if no cycle is in progress.
+        RWBytePtr scan_{ nullptr };
+
+        /// \brief Destination of the next block moved by the current
+        ///        compaction cycle.
+        RWBytePtr destination_{ nullptr };
+
+        /// \brief Total size of live blocks.
+        Bytes allocated_size_;
+
+    };
+
+    /************************************************************************/
+    /* COMPACTING ALLOCATOR :: HANDLE                                       */
+    /************************************************************************/
+
+    /// \brief Represents a generation-checked handle to a relocatable
+    ///        block.
+    class CompactingAllocator::THandle
+    {
+        friend class CompactingAllocator;
+
+    public:
+
+        /// \brief Create an empty handle.
+        THandle() noexcept = default;
+
+        /// \brief Check whether the handle is non-empty.
+        ///
+        /// \remarks Non-empty handles may still refer to deallocated blocks.
+        [[nodiscard]] explicit
+        operator Bool() const noexcept;
+
+        /// \brief Check whether two handles are equal.
+        [[nodiscard]] Bool
+        operator==(Immutable<THandle> rhs) const noexcept;
+
+    private:
+
+        /// \brief Create a new handle.
+        THandle(Int index, Int generation) noexcept;
+
+        /// \brief Index of the entry in the handle table.
+        Int index_{ -1 };
+
+        /// \brief Generation of the entry when the handle was created.
+        Int generation_{ 0 };
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/compacting_allocator.inl"
+
+// ===========================================================================
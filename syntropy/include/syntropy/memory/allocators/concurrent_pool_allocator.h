@@ -0,0 +1,222 @@
+/// \file concurrent_pool_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for thread-safe allocators of
+///        fixed-size blocks.
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* CONCURRENT POOL ALLOCATOR <ALLOCATOR>                                */
+    /************************************************************************/
+
+    /// \brief Tier 1 thread-safe allocator that uses an underlying
+    ///        allocator to allocate fixed-size blocks.
+    ///
+    /// Free blocks are kept in a lock-free stack of batches, whose head is
+    /// tagged with a version counter to prevent ABA issues. Optionally,
+    /// threads cache up to a magazine worth of blocks locally and exchange
+    /// full magazines with the shared stack.
+    ///
+    /// Chunks are allocated from the underlying allocator on demand and
+    /// never deallocated, except when the allocator is destroyed or via
+    /// ::DeallocateAll(). Calls to the underlying allocator are serialized.
+    /// Chunks are aligned to their own size, hence the underlying allocator
+    /// must honor alignments as large as the chunk size.
+    ///
+    /// \author Raffaele D. Facendola - August 2020
+    template <Templates::Allocator TAllocator>
+    class ConcurrentPoolAllocator
+    {
+    public:
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param block_size Size of each allocated block.
+        /// \param alignment Alignment of each allocated block.
+        /// \param chunk_size Size of each chunk requested to the underlying
+        ///                   allocator, rounded up to a power of two.
+        /// \param magazine_size Maximum number of blocks cached by each
+        ///                      thread. Zero disables magazines.
+        /// \param arguments Arguments used to construct the underlying
+        ///                  allocator.
+        template <typename... TArguments>
+        ConcurrentPoolAllocator(Bytes block_size,
+                                Alignment alignment,
+                                Bytes chunk_size,
+                                Int magazine_size,
+                                Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief No copy constructor.
+        ConcurrentPoolAllocator(Immutable<ConcurrentPoolAllocator>) = delete;
+
+        /// \brief Destructor.
+        ~ConcurrentPoolAllocator() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<ConcurrentPoolAllocator>
+        operator=(Immutable<ConcurrentPoolAllocator>) = delete;
+
+        /// \brief Allocate a new memory block.
+        ///
+        /// If the requested size or alignment exceed the ones of pool
+        /// blocks or a memory block could not be allocated, returns an
+        /// empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment), on any thread.
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Deallocate every allocation performed on this allocator
+        ///        so far.
+        ///
+        /// \remarks This method is not thread-safe.
+        void
+        DeallocateAll() noexcept;
+
+        /// \brief Access the underlying allocator.
+        ///
+        /// \remarks Accessing the underlying allocator is not thread-safe.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Access the underlying allocator.
+        ///
+        /// \remarks Accessing the underlying allocator is not thread-safe.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief A free block.
+        struct FreeBlock;
+
+        /// \brief An index to a free block, tagged with a version counter.
+        struct TaggedIndex;
+
+        /// \brief A chunk allocated on the underlying allocator.
+        struct Chunk;
+
+        /// \brief Blocks cached by threads mapped to the same slot.
+        struct Magazine;
+
+        /// \brief Link to the first free block in the next batch.
+        using TLink = std::atomic<std::uint32_t>;
+
+        /// \brief Maximum number of chunks.
+        static constexpr Int
+        kMaxChunkCount = 1024;
+
+        /// \brief Number of magazines.
+        static constexpr Int
+        kMagazineCount = 64;
+
+        /// \brief Size of a cache line, used to prevent false sharing
+        ///        between magazines.
+        static constexpr Int
+        kCacheLineSize = 64;
+
+        /// \brief Get the index of the calling thread.
+        [[nodiscard]] static Int
+        GetThreadIndex() noexcept;
+
+        /// \brief Pop a batch of free blocks from the shared stack, growing
+        ///        the pool if necessary.
+        /// If no batch could be acquired, returns nullptr.
+        [[nodiscard]] RWPtr<FreeBlock>
+        PopBatch() noexcept;
+
+        /// \brief Push a batch of free blocks to the shared stack.
+        void
+        PushBatch(RWPtr<FreeBlock> batch) noexcept;
+
+        /// \brief Push a chain of batches to the shared stack.
+        void
+        PushBatches(RWPtr<FreeBlock> first, RWPtr<FreeBlock> last) noexcept;
+
+        /// \brief Allocate a new chunk and push its blocks to the shared
+        ///        stack.
+        [[nodiscard]] Bool
+        Grow() noexcept;
+
+        /// \brief Get the index of a block, starting from 1.
+        [[nodiscard]] std::uint32_t
+        GetIndex(RWPtr<FreeBlock> block) const noexcept;
+
+        /// \brief Get a block by index.
+        [[nodiscard]] RWPtr<FreeBlock>
+        GetBlock(std::uint32_t index) const noexcept;
+
+        /// \brief Access the link of the batch starting at given block.
+        [[nodiscard]] Mutable<TLink>
+        GetLink(std::uint32_t index) const noexcept;
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Size of each block, including padding.
+        Int block_size_{ 0 };
+
+        /// \brief Alignment of each block.
+        Alignment alignment_;
+
+        /// \brief Size of each chunk. This is always a power of two.
+        Int chunk_size_{ 0 };
+
+        /// \brief Size of each chunk header, including batch links.
+        Int header_size_{ 0 };
+
+        /// \brief Number of blocks in each chunk.
+        Int block_count_{ 0 };
+
+        /// \brief Maximum number of blocks in each magazine.
+        Int magazine_size_{ 0 };
+
+        /// \brief Stack of free batches.
+        std::atomic<TaggedIndex> free_batches_;
+
+        /// \brief Guards chunks and the underlying allocator.
+        std::mutex mutex_;
+
+        /// \brief Number of chunks allocated so far.
+        Int chunk_count_{ 0 };
+
+        /// \brief Chunks allocated so far, indexed by allocation order.
+        RWPtr<Chunk> chunks_[kMaxChunkCount] = {};
+
+        /// \brief Magazines, indexed by thread.
+        Magazine magazines_[kMagazineCount];
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/concurrent_pool_allocator.inl"
+
+// ===========================================================================
@@ -0,0 +1,30 @@
+/// \file allocation_context.inl
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* ALLOCATION CONTEXT                                                   */
+    /************************************************************************/
+
+    inline AllocationContext
+    ::AllocationContext(Mutable<BaseAllocator> allocator) noexcept
+        : previous_allocator_(PtrOf(SetAllocator(allocator)))
+    {
+
+    }
+
+    inline AllocationContext
+    ::~AllocationContext() noexcept
+    {
+        SetAllocator(*previous_allocator_);
+    }
+
+}
+
+// ===========================================================================
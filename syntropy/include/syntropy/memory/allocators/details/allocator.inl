@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "syntropy/memory/foundation/memory.h"
+
 // ===========================================================================
 
 namespace Syntropy::Memory
@@ -13,6 +15,24 @@ namespace Syntropy::Memory
     /* BASE ALLOCATOR                                                       */
     /************************************************************************/
 
+    [[nodiscard]] inline RWByteSpan
+    BaseAllocator::AllocateZeroed(Bytes size, Alignment alignment) noexcept
+    {
+        auto block = Allocate(size, alignment);
+
+        Zero(block);
+
+        return block;
+    }
+
+    [[nodiscard]] inline Bool
+    BaseAllocator::Reallocate(Immutable<RWByteSpan>,
+                              Bytes,
+                              Alignment) noexcept
+    {
+        return false;
+    }
+
     [[nodiscard]] inline Mutable<RWPtr<BaseAllocator>>
     BaseAllocator::GetAllocator() noexcept
     {
@@ -42,6 +62,13 @@ namespace Syntropy::Memory
         return allocator_.Allocate(size, alignment);
     }
 
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan PolymorphicAllocator<TAllocator>
+    ::AllocateZeroed(Bytes size, Alignment alignment) noexcept
+    {
+        return Memory::AllocateZeroed(allocator_, size, alignment);
+    }
+
     template <Templates::Allocator TAllocator>
     inline void PolymorphicAllocator<TAllocator>
     ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
@@ -49,6 +76,22 @@ namespace Syntropy::Memory
         allocator_.Deallocate(block, alignment);
     }
 
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bool PolymorphicAllocator<TAllocator>
+    ::Reallocate(Immutable<RWByteSpan> block,
+                 Bytes size,
+                 Alignment alignment) noexcept
+    {
+        if constexpr (Templates::ReallocatingAllocator<TAllocator>)
+        {
+            return allocator_.Reallocate(block, size, alignment);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
     template <Templates::Allocator TAllocator>
     [[nodiscard]] inline Mutable<TAllocator> PolymorphicAllocator<TAllocator>
     ::GetAllocator()
@@ -63,6 +106,32 @@ namespace Syntropy::Memory
         return allocator_;
     }
 
+    /************************************************************************/
+    /* STATIC ALLOCATOR                                                     */
+    /************************************************************************/
+
+    template <auto& TInstance>
+    [[nodiscard]] inline RWByteSpan StaticAllocator<TInstance>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        return TInstance.Allocate(size, alignment);
+    }
+
+    template <auto& TInstance>
+    inline void StaticAllocator<TInstance>
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        TInstance.Deallocate(block, alignment);
+    }
+
+    template <auto& TInstance>
+    [[nodiscard]] inline constexpr decltype(TInstance)
+    StaticAllocator<TInstance>
+    ::GetAllocator() noexcept
+    {
+        return TInstance;
+    }
+
     // Non-member functions.
     // =====================
 
@@ -90,6 +159,26 @@ namespace Syntropy::Memory
         return scope_allocator;
     }
 
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan
+    AllocateZeroed(Mutable<TAllocator> allocator,
+                   Bytes size,
+                   Alignment alignment) noexcept
+    {
+        if constexpr (Templates::ZeroingAllocator<TAllocator>)
+        {
+            return allocator.AllocateZeroed(size, alignment);
+        }
+        else
+        {
+            auto block = allocator.Allocate(size, alignment);
+
+            Zero(block);
+
+            return block;
+        }
+    }
+
 }
 
 // ===========================================================================
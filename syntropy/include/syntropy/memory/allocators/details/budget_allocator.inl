@@ -0,0 +1,447 @@
+/// \file budget_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* MEMORY BUDGET                                                        */
+    /************************************************************************/
+
+    [[nodiscard]] inline Mutable<MemoryBudget> MemoryBudget
+    ::GetRoot() noexcept
+    {
+        static auto root = MemoryBudget("root", nullptr);
+
+        return root;
+    }
+
+    inline MemoryBudget
+    ::MemoryBudget(Ptr<char> name, Null parent) noexcept
+        : name_(name)
+    {
+
+    }
+
+    inline MemoryBudget
+    ::MemoryBudget(Ptr<char> name, Mutable<MemoryBudget> parent) noexcept
+        : name_(name)
+        , parent_(PtrOf(parent))
+    {
+        auto lock = std::lock_guard<std::mutex>(GetHierarchyMutex());
+
+        next_sibling_ = parent_->first_child_;
+
+        parent_->first_child_ = this;
+    }
+
+    inline MemoryBudget
+    ::~MemoryBudget() noexcept
+    {
+        SYNTROPY_UNDEFINED_BEHAVIOR(!first_child_,
+            "Nested budgets must be destroyed before their parent.");
+
+        if (parent_)
+        {
+            auto lock = std::lock_guard<std::mutex>(GetHierarchyMutex());
+
+            auto sibling = &parent_->first_child_;
+
+            while (*sibling != this)
+            {
+                sibling = &(*sibling)->next_sibling_;
+            }
+
+            *sibling = next_sibling_;
+
+            parent_->Unreserve(reserved_.load(std::memory_order_relaxed));
+        }
+    }
+
+    [[nodiscard]] inline Bool MemoryBudget
+    ::Charge(Bytes size) noexcept
+    {
+        auto amount = ToInt(size);
+
+        auto& stripe = stripes_[GetThreadIndex() % kStripeCount];
+
+        stripe.charge_count_.fetch_add(1, std::memory_order_relaxed);
+
+        // Fast path: consume the stripe credit.
+
+        auto credit = stripe.credit_.load(std::memory_order_relaxed);
+
+        while (credit >= amount)
+        {
+            if (stripe.credit_.compare_exchange_weak(credit,
+                                                     credit - amount))
+            {
+                return true;
+            }
+        }
+
+        // Slow path: reserve a new batch along with the charge. Near a hard
+        // limit, the exact amount is reserved instead.
+
+        if (!Reserve(amount + kBatchSize))
+        {
+            stripe.credit_.fetch_add(kBatchSize, std::memory_order_relaxed);
+
+            return true;
+        }
+
+        auto budget = Reserve(amount);
+
+        if (!budget)
+        {
+            return true;
+        }
+
+        // Unused credit held anywhere below the rejecting budget counts
+        // towards its limit: return it before rejecting the charge.
+
+        {
+            auto lock = std::lock_guard<std::mutex>(GetHierarchyMutex());
+
+            budget->DrainTree();
+        }
+
+        budget = Reserve(amount);
+
+        if (budget)
+        {
+            budget->rejection_count_.fetch_add(1, std::memory_order_relaxed);
+
+            if (auto callback = budget->hard_callback_.load())
+            {
+                auto reserved = budget->reserved_.load();
+
+                callback(*budget, Bytes{ reserved });
+            }
+
+            return false;
+        }
+
+        return true;
+    }
+
+    inline void MemoryBudget
+    ::Refund(Bytes size) noexcept
+    {
+        auto amount = ToInt(size);
+
+        auto& stripe = stripes_[GetThreadIndex() % kStripeCount];
+
+        auto credit = stripe.credit_.fetch_add(amount) + amount;
+
+        // Keep a single batch on the stripe, returning the excess.
+
+        if ((credit > 2 * kBatchSize)
+            && stripe.credit_.compare_exchange_strong(credit, kBatchSize))
+        {
+            Unreserve(credit - kBatchSize);
+        }
+    }
+
+    inline void MemoryBudget
+    ::SetSoftLimit(Bytes limit, TLimitCallback callback) noexcept
+    {
+        soft_callback_.store(callback);
+        soft_limit_.store(ToInt(limit));
+    }
+
+    inline void MemoryBudget
+    ::SetHardLimit(Bytes limit, TLimitCallback callback) noexcept
+    {
+        hard_callback_.store(callback);
+        hard_limit_.store(ToInt(limit));
+    }
+
+    [[nodiscard]] inline Ptr<char> MemoryBudget
+    ::GetName() const noexcept
+    {
+        return name_;
+    }
+
+    [[nodiscard]] inline RWPtr<MemoryBudget> MemoryBudget
+    ::GetParent() const noexcept
+    {
+        return parent_;
+    }
+
+    [[nodiscard]] inline Bytes MemoryBudget
+    ::GetUsage() const noexcept
+    {
+        auto lock = std::lock_guard<std::mutex>(GetHierarchyMutex());
+
+        return Bytes{ reserved_.load() - GetCredit() };
+    }
+
+    template <typename TFunction>
+    inline void MemoryBudget
+    ::Snapshot(Forwarding<TFunction> function) const noexcept
+    {
+        auto lock = std::lock_guard<std::mutex>(GetHierarchyMutex());
+
+        Visit(function, 0);
+    }
+
+    [[nodiscard]] inline Int MemoryBudget
+    ::GetThreadIndex() noexcept
+    {
+        static auto thread_count = std::atomic<Int>{ 0 };
+
+        static thread_local auto thread_index
+            = thread_count.fetch_add(1, std::memory_order_relaxed);
+
+        return thread_index;
+    }
+
+    [[nodiscard]] inline Mutable<std::mutex> MemoryBudget
+    ::GetHierarchyMutex() noexcept
+    {
+        static auto mutex = std::mutex{};
+
+        return mutex;
+    }
+
+    [[nodiscard]] inline RWPtr<MemoryBudget> MemoryBudget
+    ::Reserve(Int size) noexcept
+    {
+        for (auto budget = this; budget; budget = budget->parent_)
+        {
+            auto reserved = budget->reserved_.fetch_add(size) + size;
+
+            if (reserved > budget->hard_limit_.load(std::memory_order_relaxed))
+            {
+                // Roll back up to the rejecting budget, included.
+
+                for (auto rollback = this; rollback != budget->parent_;
+                     rollback = rollback->parent_)
+                {
+                    rollback->reserved_.fetch_sub(size);
+                }
+
+                return budget;
+            }
+        }
+
+        // Peaks and soft limits are updated once the whole hierarchy
+        // accepted the reservation.
+
+        for (auto budget = this; budget; budget = budget->parent_)
+        {
+            auto reserved = budget->reserved_.load(std::memory_order_relaxed);
+
+            auto peak = budget->peak_.load(std::memory_order_relaxed);
+
+            while ((reserved > peak)
+                   && !budget->peak_.compare_exchange_weak(peak, reserved))
+            {
+
+            }
+
+            auto soft_limit = budget->soft_limit_.load(
+                std::memory_order_relaxed);
+
+            if ((reserved - size <= soft_limit) && (reserved > soft_limit))
+            {
+                if (auto callback = budget->soft_callback_.load())
+                {
+                    callback(*budget, Bytes{ reserved });
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    inline void MemoryBudget
+    ::Unreserve(Int size) noexcept
+    {
+        for (auto budget = this; budget; budget = budget->parent_)
+        {
+            budget->reserved_.fetch_sub(size);
+        }
+    }
+
+    inline void MemoryBudget
+    ::Drain() noexcept
+    {
+        auto credit = Int{ 0 };
+
+        for (auto&& stripe : stripes_)
+        {
+            credit += stripe.credit_.exchange(0);
+        }
+
+        Unreserve(credit);
+    }
+
+    inline void MemoryBudget
+    ::DrainTree() noexcept
+    {
+        Drain();
+
+        for (auto child = first_child_; child; child = child->next_sibling_)
+        {
+            child->DrainTree();
+        }
+    }
+
+    [[nodiscard]] inline Int MemoryBudget
+    ::GetCredit() const noexcept
+    {
+        auto credit = Int{ 0 };
+
+        for (auto&& stripe : stripes_)
+        {
+            credit += stripe.credit_.load(std::memory_order_relaxed);
+        }
+
+        for (auto child = first_child_; child; child = child->next_sibling_)
+        {
+            credit += child->GetCredit();
+        }
+
+        return credit;
+    }
+
+    template <typename TFunction>
+    inline void MemoryBudget
+    ::Visit(Mutable<TFunction> function, Int depth) const noexcept
+    {
+        auto statistics = TStatistics{};
+
+        auto reserved = reserved_.load();
+
+        statistics.name_ = name_;
+        statistics.depth_ = depth;
+        statistics.usage_ = Bytes{ reserved - GetCredit() };
+        statistics.reserved_ = Bytes{ reserved };
+        statistics.peak_ = Bytes{ peak_.load() };
+        statistics.soft_limit_ = Bytes{ soft_limit_.load() };
+        statistics.hard_limit_ = Bytes{ hard_limit_.load() };
+        statistics.rejection_count_ = rejection_count_.load();
+
+        for (auto&& stripe : stripes_)
+        {
+            statistics.charge_count_ += stripe.charge_count_.load();
+        }
+
+        function(static_cast<Immutable<TStatistics>>(statistics));
+
+        for (auto child = first_child_; child; child = child->next_sibling_)
+        {
+            child->Visit(function, depth + 1);
+        }
+    }
+
+    /************************************************************************/
+    /* BUDGET ALLOCATOR                                                     */
+    /************************************************************************/
+
+    inline BudgetAllocator
+    ::BudgetAllocator(Mutable<MemoryBudget> budget,
+                      Mutable<BaseAllocator> allocator) noexcept
+        : budget_(PtrOf(budget))
+        , allocator_(PtrOf(allocator))
+    {
+
+    }
+
+    [[nodiscard]] inline RWByteSpan BudgetAllocator
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        if (!budget_->Charge(size))
+        {
+            return {};
+        }
+
+        auto block = allocator_->Allocate(size, alignment);
+
+        if (!block)
+        {
+            budget_->Refund(size);
+        }
+
+        return block;
+    }
+
+    [[nodiscard]] inline RWByteSpan BudgetAllocator
+    ::AllocateZeroed(Bytes size, Alignment alignment) noexcept
+    {
+        if (!budget_->Charge(size))
+        {
+            return {};
+        }
+
+        auto block = allocator_->AllocateZeroed(size, alignment);
+
+        if (!block)
+        {
+            budget_->Refund(size);
+        }
+
+        return block;
+    }
+
+    inline void BudgetAllocator
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        allocator_->Deallocate(block, alignment);
+
+        budget_->Refund(block.GetCount());
+    }
+
+    [[nodiscard]] inline Bool BudgetAllocator
+    ::Reallocate(Immutable<RWByteSpan> block,
+                 Bytes size,
+                 Alignment alignment) noexcept
+    {
+        auto count = block.GetCount();
+
+        if ((size > count) && !budget_->Charge(size - count))
+        {
+            return false;
+        }
+
+        if (!allocator_->Reallocate(block, size, alignment))
+        {
+            if (size > count)
+            {
+                budget_->Refund(size - count);
+            }
+
+            return false;
+        }
+
+        if (size < count)
+        {
+            budget_->Refund(count - size);
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] inline Mutable<MemoryBudget> BudgetAllocator
+    ::GetBudget() const noexcept
+    {
+        return *budget_;
+    }
+
+    [[nodiscard]] inline Mutable<BaseAllocator> BudgetAllocator
+    ::GetAllocator() const noexcept
+    {
+        return *allocator_;
+    }
+
+}
+
+// ===========================================================================
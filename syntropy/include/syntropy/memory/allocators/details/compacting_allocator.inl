@@ -0,0 +1,415 @@
+/// \file compacting_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <new>
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/memory/foundation/memory.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* COMPACTING ALLOCATOR :: BLOCK                                        */
+    /************************************************************************/
+
+    /// \brief Header of a block.
+    ///
+    /// Each block is laid out as a header followed by the block payload.
+    /// Headers are as large as the block granularity, such that payloads
+    /// are always aligned to it.
+    struct alignas(CompactingAllocator::kGranularity)
+    CompactingAllocator::Block
+    {
+        /// \brief Payload size, in bytes.
+        Int size_{ 0 };
+
+        /// \brief Index of the entry referring to this block. Negative for
+        ///        free blocks.
+        Int entry_{ -1 };
+
+        /// \brief Get the payload.
+        [[nodiscard]] RWByteSpan
+        GetPayload() noexcept
+        {
+            return MakeByteSpan(ToBytePtr(this) + SizeOf<Block>(),
+                                Bytes{ size_ });
+        }
+
+        /// \brief Get the total block size, including the header.
+        [[nodiscard]] Bytes
+        GetSize() const noexcept
+        {
+            return SizeOf<Block>() + Bytes{ size_ };
+        }
+    };
+
+    /************************************************************************/
+    /* COMPACTING ALLOCATOR :: ENTRY                                        */
+    /************************************************************************/
+
+    /// \brief Entry in the handle table.
+    struct CompactingAllocator::Entry
+    {
+        /// \brief Block referred to by this entry. Null for free entries.
+        RWPtr<Block> block_{ nullptr };
+
+        /// \brief Entry generation, incremented each time the entry is
+        ///        released.
+        Int generation_{ 0 };
+
+        /// \brief Number of pins on the block.
+        Int pin_count_{ 0 };
+
+        /// \brief Next free entry. Meaningful only for free entries.
+        Int next_free_{ -1 };
+    };
+
+    /************************************************************************/
+    /* COMPACTING ALLOCATOR                                                 */
+    /************************************************************************/
+
+    inline CompactingAllocator
+    ::CompactingAllocator(Bytes capacity, Int handle_count) noexcept
+        : heap_(VirtualMemory::Ceil(capacity))
+        , table_(VirtualMemory::Ceil(SizeOf<Entry>() * handle_count))
+        , handle_count_(handle_count)
+    {
+        top_ = heap_.GetData();
+        heap_committed_ = heap_.GetData();
+        table_committed_ = table_.GetData();
+
+        if (!heap_.GetData() || !table_.GetData())
+        {
+            handle_count_ = 0;
+        }
+    }
+
+    [[nodiscard]] inline auto CompactingAllocator
+    ::Allocate(Bytes size, Alignment alignment) noexcept -> THandle
+    {
+        if ((size <= Bytes{ 0 }) || (ToInt(alignment) > kGranularity))
+        {
+            return {};
+        }
+
+        auto payload_size = Math::Ceil(ToInt(size), kGranularity);
+
+        auto block_end = top_ + SizeOf<Block>() + Bytes{ payload_size };
+
+        auto heap_end = heap_.GetData() + heap_.GetCount();
+
+        if (block_end > heap_end)
+        {
+            // Reclaim holes before giving up.
+
+            while (!Compact(GetUsedSize()));
+
+            block_end = top_ + SizeOf<Block>() + Bytes{ payload_size };
+
+            if (block_end > heap_end)
+            {
+                return {};                              // Out of memory.
+            }
+        }
+
+        if (!CommitUpTo(block_end))
+        {
+            return {};
+        }
+
+        auto index = AcquireEntry();
+
+        if (index < 0)
+        {
+            return {};                                  // Out of handles.
+        }
+
+        auto& entry = FromBytePtr<Entry>(table_.GetData())[index];
+
+        entry.block_ = new (top_) Block{ payload_size, index };
+        entry.pin_count_ = 0;
+
+        top_ = block_end;
+
+        allocated_size_ += Bytes{ payload_size };
+
+        return { index, entry.generation_ };
+    }
+
+    inline void CompactingAllocator
+    ::Deallocate(Immutable<THandle> handle) noexcept
+    {
+        SYNTROPY_UNDEFINED_BEHAVIOR(IsValid(handle),
+            "The provided handle doesn't refer to a live block.");
+
+        auto entries = FromBytePtr<Entry>(table_.GetData());
+
+        auto& entry = entries[handle.index_];
+
+        SYNTROPY_UNDEFINED_BEHAVIOR(entry.pin_count_ == 0,
+            "The provided block is pinned.");
+
+        auto block = entry.block_;
+
+        allocated_size_ -= Bytes{ block->size_ };
+
+        block->entry_ = -1;
+
+        // The last block is reclaimed immediately, unless a compaction
+        // cycle is in progress.
+
+        if (!scan_ && (ToBytePtr(block) + block->GetSize() == top_))
+        {
+            top_ = ToBytePtr(block);
+        }
+
+        entry.block_ = nullptr;
+        entry.next_free_ = free_entry_;
+
+        ++entry.generation_;
+
+        free_entry_ = handle.index_;
+    }
+
+    [[nodiscard]] inline Bool CompactingAllocator
+    ::IsValid(Immutable<THandle> handle) const noexcept
+    {
+        if ((handle.index_ < 0) || (handle.index_ >= entry_count_))
+        {
+            return false;
+        }
+
+        auto& entry = FromBytePtr<Entry>(table_.GetData())[handle.index_];
+
+        return entry.block_ && (entry.generation_ == handle.generation_);
+    }
+
+    [[nodiscard]] inline RWByteSpan CompactingAllocator
+    ::Pin(Immutable<THandle> handle) noexcept
+    {
+        SYNTROPY_UNDEFINED_BEHAVIOR(IsValid(handle),
+            "The provided handle doesn't refer to a live block.");
+
+        auto& entry = FromBytePtr<Entry>(table_.GetData())[handle.index_];
+
+        ++entry.pin_count_;
+
+        return entry.block_->GetPayload();
+    }
+
+    inline void CompactingAllocator
+    ::Unpin(Immutable<THandle> handle) noexcept
+    {
+        SYNTROPY_UNDEFINED_BEHAVIOR(IsValid(handle),
+            "The provided handle doesn't refer to a live block.");
+
+        auto& entry = FromBytePtr<Entry>(table_.GetData())[handle.index_];
+
+        SYNTROPY_UNDEFINED_BEHAVIOR(entry.pin_count_ > 0,
+            "The provided block is not pinned.");
+
+        --entry.pin_count_;
+    }
+
+    [[nodiscard]] inline RWByteSpan CompactingAllocator
+    ::Resolve(Immutable<THandle> handle) const noexcept
+    {
+        SYNTROPY_UNDEFINED_BEHAVIOR(IsValid(handle),
+            "The provided handle doesn't refer to a live block.");
+
+        auto& entry = FromBytePtr<Entry>(table_.GetData())[handle.index_];
+
+        return entry.block_->GetPayload();
+    }
+
+    inline Bool CompactingAllocator
+    ::Compact(Bytes budget) noexcept
+    {
+        auto entries = FromBytePtr<Entry>(table_.GetData());
+
+        if (!scan_)
+        {
+            scan_ = heap_.GetData();
+            destination_ = heap_.GetData();
+        }
+
+        // Blocks are slid towards the destination, unless pinned. Free
+        // blocks are skipped. The destination never overtakes the scan.
+
+        for (auto scanned = Bytes{ 0 }; (scan_ < top_) && (scanned < budget);)
+        {
+            auto block = FromBytePtr<Block>(scan_);
+
+            auto block_size = block->GetSize();
+
+            auto index = block->entry_;
+
+            if ((index >= 0) && (entries[index].pin_count_ == 0))
+            {
+                // Source and destination may overlap.
+
+                if (destination_ != scan_)
+                {
+                    Copy(MakeByteSpan(destination_, block_size),
+                         MakeByteSpan(scan_, block_size));
+
+                    entries[index].block_ = FromBytePtr<Block>(destination_);
+                }
+
+                destination_ = destination_ + block_size;
+            }
+            else if (index >= 0)
+            {
+                // Pinned blocks stay put: the gap before them becomes a
+                // free block.
+
+                if (destination_ != scan_)
+                {
+                    auto gap_size = Bytes{ scan_ - destination_ };
+
+                    new (destination_)
+                        Block{ ToInt(gap_size - SizeOf<Block>()), -1 };
+                }
+
+                destination_ = scan_ + block_size;
+            }
+
+            scan_ = scan_ + block_size;
+            scanned += block_size;
+        }
+
+        if (scan_ < top_)
+        {
+            return false;
+        }
+
+        top_ = destination_;
+
+        scan_ = nullptr;
+        destination_ = nullptr;
+
+        Trim();
+
+        return true;
+    }
+
+    [[nodiscard]] inline Bytes CompactingAllocator
+    ::GetAllocatedSize() const noexcept
+    {
+        return allocated_size_;
+    }
+
+    [[nodiscard]] inline Bytes CompactingAllocator
+    ::GetUsedSize() const noexcept
+    {
+        return Bytes{ top_ - heap_.GetData() };
+    }
+
+    [[nodiscard]] inline Int CompactingAllocator
+    ::AcquireEntry() noexcept
+    {
+        auto entries = FromBytePtr<Entry>(table_.GetData());
+
+        if (free_entry_ >= 0)
+        {
+            auto index = free_entry_;
+
+            free_entry_ = entries[index].next_free_;
+
+            return index;
+        }
+
+        if (entry_count_ >= handle_count_)
+        {
+            return -1;
+        }
+
+        // Table pages are committed as the table grows.
+
+        auto entry_end = ToBytePtr(entries + entry_count_ + 1);
+
+        if (entry_end > table_committed_)
+        {
+            auto commit_end = table_committed_ + VirtualMemory::GetPageSize();
+
+            if (!VirtualMemory::Commit({ table_committed_, commit_end }))
+            {
+                return -1;
+            }
+
+            table_committed_ = commit_end;
+        }
+
+        new (entries + entry_count_) Entry{};
+
+        return entry_count_++;
+    }
+
+    [[nodiscard]] inline Bool CompactingAllocator
+    ::CommitUpTo(RWBytePtr end) noexcept
+    {
+        if (end <= heap_committed_)
+        {
+            return true;
+        }
+
+        auto commit_end = Align(end, VirtualMemory::GetPageAlignment());
+
+        if (!VirtualMemory::Commit({ heap_committed_, commit_end }))
+        {
+            return false;
+        }
+
+        heap_committed_ = commit_end;
+
+        return true;
+    }
+
+    inline void CompactingAllocator
+    ::Trim() noexcept
+    {
+        auto trim_begin = Align(top_, VirtualMemory::GetPageAlignment());
+
+        if (trim_begin < heap_committed_)
+        {
+            VirtualMemory::Decommit({ trim_begin, heap_committed_ });
+
+            heap_committed_ = trim_begin;
+        }
+    }
+
+    /************************************************************************/
+    /* COMPACTING ALLOCATOR :: HANDLE                                       */
+    /************************************************************************/
+
+    inline CompactingAllocator::THandle
+    ::THandle(Int index, Int generation) noexcept
+        : index_(index)
+        , generation_(generation)
+    {
+
+    }
+
+    [[nodiscard]] inline CompactingAllocator::THandle
+    ::operator Bool() const noexcept
+    {
+        return index_ >= 0;
+    }
+
+    [[nodiscard]] inline Bool CompactingAllocator::THandle
+    ::operator==(Immutable<THandle> rhs) const noexcept
+    {
+        return (index_ == rhs.index_) && (generation_ == rhs.generation_);
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,518 @@
+/// \file concurrent_pool_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include <bit>
+#include <limits>
+#include <new>
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* CONCURRENT POOL ALLOCATOR <ALLOCATOR> :: FREE BLOCK                  */
+    /************************************************************************/
+
+    /// \brief A free block.
+    ///
+    /// Free blocks are grouped in batches. The link to the next batch in
+    /// the same stack is stored in the chunk header rather than in the
+    /// block, since it may be read after the block was allocated.
+    template <Templates::Allocator TAllocator>
+    struct ConcurrentPoolAllocator<TAllocator>::FreeBlock
+    {
+        /// \brief Next free block in the same batch.
+        RWPtr<FreeBlock> next_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* CONCURRENT POOL ALLOCATOR <ALLOCATOR> :: TAGGED POINTER              */
+    /************************************************************************/
+
+    /// \brief An index to a free block, tagged with a version counter.
+    ///
+    /// The tag is increased on every update so that a stale head is
+    /// detected even if the same block was popped and pushed back
+    /// meanwhile.
+    ///
+    /// Blocks are referred to by index rather than by address, such that
+    /// both the index and a 32-bit tag fit a single-word compare-and-swap.
+    /// The tag wraps around only after 2^32 updates.
+    template <Templates::Allocator TAllocator>
+    struct ConcurrentPoolAllocator<TAllocator>::TaggedIndex
+    {
+        /// \brief Index of the free block, starting from 1. Zero denotes
+        ///        no block.
+        std::uint32_t index_{ 0 };
+
+        /// \brief Version counter.
+        std::uint32_t tag_{ 0 };
+    };
+
+    /************************************************************************/
+    /* CONCURRENT POOL ALLOCATOR <ALLOCATOR> :: CHUNK                       */
+    /************************************************************************/
+
+    /// \brief A chunk allocated on the underlying allocator.
+    ///
+    /// Chunks are aligned to their size. Each chunk header is followed by
+    /// a link for each block in the chunk, then by the blocks themselves.
+    template <Templates::Allocator TAllocator>
+    struct ConcurrentPoolAllocator<TAllocator>::Chunk
+    {
+        /// \brief Index of the chunk.
+        Int index_{ 0 };
+
+        /// \brief Memory span enclosing the chunk.
+        RWByteSpan self_;
+    };
+
+    /************************************************************************/
+    /* CONCURRENT POOL ALLOCATOR <ALLOCATOR> :: MAGAZINE                    */
+    /************************************************************************/
+
+    /// \brief Blocks cached by threads mapped to the same slot.
+    ///
+    /// Magazines are acquired via a try-lock: if a magazine is contended,
+    /// the shared stack is used instead.
+    template <Templates::Allocator TAllocator>
+    struct alignas(ConcurrentPoolAllocator<TAllocator>::kCacheLineSize)
+    ConcurrentPoolAllocator<TAllocator>::Magazine
+    {
+        /// \brief Whether the magazine is currently acquired by a thread.
+        std::atomic<Bool> busy_{ false };
+
+        /// \brief First cached block.
+        RWPtr<FreeBlock> head_{ nullptr };
+
+        /// \brief Number of cached blocks.
+        Int count_{ 0 };
+    };
+
+    /************************************************************************/
+    /* CONCURRENT POOL ALLOCATOR <ALLOCATOR>                                */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator>
+    template <typename... TArguments>
+    inline ConcurrentPoolAllocator<TAllocator>
+    ::ConcurrentPoolAllocator(Bytes block_size,
+                              Alignment alignment,
+                              Bytes chunk_size,
+                              Int magazine_size,
+                              Forwarding<TArguments>... arguments) noexcept
+        : allocator_(Forward<TArguments>(arguments)...)
+        , alignment_(Math::Max(alignment, AlignmentOf<FreeBlock>()))
+        , magazine_size_(Math::Max(magazine_size, Int{ 0 }))
+    {
+        // Free blocks are linked together: each block must be large enough
+        // to fit the link and a chunk must fit at least one block, along
+        // with its header and batch link.
+
+        auto block_stride = Math::Max(ToInt(block_size),
+                                      ToInt(SizeOf<FreeBlock>()));
+
+        block_size_ = Math::Ceil(block_stride, ToInt(alignment_));
+
+        auto link_size = ToInt(SizeOf<TLink>());
+
+        auto link_offset = ToInt(SizeOf<Chunk>());
+
+        auto min_chunk_size = link_offset + link_size + ToInt(alignment_)
+                            + block_size_;
+
+        chunk_size_ = static_cast<Int>(std::bit_ceil(
+            static_cast<std::uint64_t>(Math::Max(ToInt(chunk_size),
+                                                 min_chunk_size))));
+
+        block_count_ = (chunk_size_ - link_offset - ToInt(alignment_))
+                     / (block_size_ + link_size);
+
+        header_size_ = Math::Ceil(link_offset + block_count_ * link_size,
+                                  ToInt(alignment_));
+
+        static_assert(std::atomic<TaggedIndex>::is_always_lock_free,
+                      "The stack of free batches must be lock-free.");
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline ConcurrentPoolAllocator<TAllocator>
+    ::~ConcurrentPoolAllocator() noexcept
+    {
+        DeallocateAll();
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan ConcurrentPoolAllocator<TAllocator>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        if ((ToInt(size) <= 0)
+            || (ToInt(size) > block_size_)
+            || (alignment > alignment_))
+        {
+            return {};
+        }
+
+        if (magazine_size_ > 0)
+        {
+            auto& magazine = magazines_[GetThreadIndex() % kMagazineCount];
+
+            if (!magazine.busy_.exchange(true, std::memory_order_acquire))
+            {
+                if (!magazine.head_)
+                {
+                    magazine.head_ = PopBatch();
+
+                    for (auto block = magazine.head_; block;)
+                    {
+                        block = block->next_;
+                        ++magazine.count_;
+                    }
+                }
+
+                auto block = magazine.head_;
+
+                if (block)
+                {
+                    magazine.head_ = block->next_;
+                    --magazine.count_;
+                }
+
+                magazine.busy_.store(false, std::memory_order_release);
+
+                if (block)
+                {
+                    return { ToBytePtr(block), size };
+                }
+
+                return {};
+            }
+        }
+
+        // Contended or no magazine: take the first block in a batch and
+        // push the rest back.
+
+        auto block = PopBatch();
+
+        if (!block)
+        {
+            return {};
+        }
+
+        if (block->next_)
+        {
+            PushBatch(block->next_);
+        }
+
+        return { ToBytePtr(block), size };
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void ConcurrentPoolAllocator<TAllocator>
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment) noexcept
+    {
+        if (!block.GetData())
+        {
+            return;
+        }
+
+        auto free_block = new (block.GetData()) FreeBlock{};
+
+        if (magazine_size_ > 0)
+        {
+            auto& magazine = magazines_[GetThreadIndex() % kMagazineCount];
+
+            if (!magazine.busy_.exchange(true, std::memory_order_acquire))
+            {
+                // Full magazines are handed over to the shared stack as a
+                // single batch.
+
+                if (magazine.count_ >= magazine_size_)
+                {
+                    PushBatch(magazine.head_);
+
+                    magazine.head_ = nullptr;
+                    magazine.count_ = 0;
+                }
+
+                free_block->next_ = magazine.head_;
+
+                magazine.head_ = free_block;
+                ++magazine.count_;
+
+                magazine.busy_.store(false, std::memory_order_release);
+
+                return;
+            }
+        }
+
+        PushBatch(free_block);
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void ConcurrentPoolAllocator<TAllocator>
+    ::DeallocateAll() noexcept
+    {
+        for (auto index = Int{ 0 }; index < chunk_count_; ++index)
+        {
+            auto self = chunks_[index]->self_;
+
+            allocator_.Deallocate(self, ToAlignment(chunk_size_));
+
+            chunks_[index] = nullptr;
+        }
+
+        chunk_count_ = 0;
+
+        free_batches_.store({});
+
+        for (auto&& magazine : magazines_)
+        {
+            magazine.head_ = nullptr;
+            magazine.count_ = 0;
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator>
+    ConcurrentPoolAllocator<TAllocator>
+    ::GetAllocator() noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Immutable<TAllocator>
+    ConcurrentPoolAllocator<TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Int ConcurrentPoolAllocator<TAllocator>
+    ::GetThreadIndex() noexcept
+    {
+        static auto thread_count = std::atomic<Int>{ 0 };
+
+        static thread_local auto thread_index
+            = thread_count.fetch_add(1, std::memory_order_relaxed);
+
+        return thread_index;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWPtr<typename ConcurrentPoolAllocator<TAllocator>
+                                   ::FreeBlock>
+    ConcurrentPoolAllocator<TAllocator>
+    ::PopBatch() noexcept
+    {
+        for (;;)
+        {
+            auto head = free_batches_.load(std::memory_order_acquire);
+
+            for (; head.index_ != 0;)
+            {
+                // The head may be popped and reused concurrently: in that
+                // case the link may be stale, but its tag changes and the
+                // exchange fails.
+
+                auto next = TaggedIndex{};
+
+                next.index_ = GetLink(head.index_).load(
+                    std::memory_order_relaxed);
+
+                next.tag_ = head.tag_ + 1;
+
+                if (free_batches_.compare_exchange_weak(
+                    head,
+                    next,
+                    std::memory_order_acquire,
+                    std::memory_order_acquire))
+                {
+                    return GetBlock(head.index_);
+                }
+            }
+
+            if (!Grow())
+            {
+                return nullptr;
+            }
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void ConcurrentPoolAllocator<TAllocator>
+    ::PushBatch(RWPtr<FreeBlock> batch) noexcept
+    {
+        PushBatches(batch, batch);
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void ConcurrentPoolAllocator<TAllocator>
+    ::PushBatches(RWPtr<FreeBlock> first, RWPtr<FreeBlock> last) noexcept
+    {
+        auto& link = GetLink(GetIndex(last));
+
+        auto head = free_batches_.load(std::memory_order_relaxed);
+        auto next = TaggedIndex{};
+
+        next.index_ = GetIndex(first);
+
+        do
+        {
+            link.store(head.index_, std::memory_order_relaxed);
+
+            next.tag_ = head.tag_ + 1;
+        }
+        while (!free_batches_.compare_exchange_weak(
+            head,
+            next,
+            std::memory_order_release,
+            std::memory_order_relaxed));
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bool ConcurrentPoolAllocator<TAllocator>
+    ::Grow() noexcept
+    {
+        auto lock = std::lock_guard{ mutex_ };
+
+        // Another thread may have grown the pool meanwhile.
+
+        if (free_batches_.load(std::memory_order_acquire).index_ != 0)
+        {
+            return true;
+        }
+
+        // Block indices must fit the tagged index.
+
+        auto max_block_count = std::numeric_limits<std::uint32_t>::max();
+
+        if ((chunk_count_ == kMaxChunkCount)
+            || ((chunk_count_ + 1) * block_count_ >= max_block_count))
+        {
+            return false;
+        }
+
+        auto storage = allocator_.Allocate(Bytes{ chunk_size_ },
+                                           ToAlignment(chunk_size_));
+
+        if (!storage.GetData())
+        {
+            return false;
+        }
+
+        SYNTROPY_ASSERT(IsAlignedTo(storage.GetData(),
+                                    ToAlignment(chunk_size_)));
+
+        auto chunk = new (storage.GetData()) Chunk{ chunk_count_, storage };
+
+        auto links = reinterpret_cast<RWPtr<TLink>>(chunk + 1);
+
+        for (auto index = Int{ 0 }; index < block_count_; ++index)
+        {
+            new (links + index) TLink{ 0 };
+        }
+
+        chunks_[chunk_count_] = chunk;
+
+        ++chunk_count_;
+
+        auto blocks = storage.GetData() + header_size_;
+
+        // Blocks are grouped in magazine-sized batches, so that a single
+        // pop can refill an entire magazine.
+
+        auto batch_size = Math::Max(magazine_size_, Int{ 1 });
+
+        auto first = RWPtr<FreeBlock>{ nullptr };
+        auto last = RWPtr<FreeBlock>{ nullptr };
+        auto previous = RWPtr<FreeBlock>{ nullptr };
+
+        for (auto index = Int{ 0 }; index < block_count_; ++index)
+        {
+            auto block = new (blocks + index * block_size_) FreeBlock{};
+
+            if (index % batch_size == 0)
+            {
+                if (last)
+                {
+                    GetLink(GetIndex(last)).store(GetIndex(block),
+                                                  std::memory_order_relaxed);
+                }
+                else
+                {
+                    first = block;
+                }
+
+                last = block;
+            }
+            else
+            {
+                previous->next_ = block;
+            }
+
+            previous = block;
+        }
+
+        PushBatches(first, last);
+
+        return true;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline std::uint32_t ConcurrentPoolAllocator<TAllocator>
+    ::GetIndex(RWPtr<FreeBlock> block) const noexcept
+    {
+        auto chunk = reinterpret_cast<RWPtr<Chunk>>(
+            AlignDown(ToBytePtr(block), ToAlignment(chunk_size_)));
+
+        auto offset = ToBytePtr(block) - ToBytePtr(chunk) - header_size_;
+
+        auto index = chunk->index_ * block_count_ + offset / block_size_;
+
+        return static_cast<std::uint32_t>(index + 1);
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWPtr<typename ConcurrentPoolAllocator<TAllocator>
+                                   ::FreeBlock>
+    ConcurrentPoolAllocator<TAllocator>
+    ::GetBlock(std::uint32_t index) const noexcept
+    {
+        auto position = Int{ index } - 1;
+
+        auto chunk = chunks_[position / block_count_];
+
+        auto block = ToBytePtr(chunk) + header_size_
+                   + (position % block_count_) * block_size_;
+
+        return reinterpret_cast<RWPtr<FreeBlock>>(block);
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<typename ConcurrentPoolAllocator<TAllocator>
+                                     ::TLink>
+    ConcurrentPoolAllocator<TAllocator>
+    ::GetLink(std::uint32_t index) const noexcept
+    {
+        auto position = Int{ index } - 1;
+
+        auto chunk = chunks_[position / block_count_];
+
+        auto links = reinterpret_cast<RWPtr<TLink>>(chunk + 1);
+
+        return links[position % block_count_];
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,369 @@
+/// \file frame_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <new>
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/memory/foundation/memory.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* FRAME ALLOCATOR <ALLOCATOR, COUNT, POLICY> :: CHUNK                  */
+    /************************************************************************/
+
+    /// \brief A chunk in the allocation chain of an arena.
+    ///
+    /// Each chunk is laid out as a header followed by the chunk payload.
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    struct FrameAllocator<TAllocator, TCount, TPolicy>::Chunk
+    {
+        /// \brief Next chunk.
+        RWPtr<Chunk> next_{ nullptr };
+
+        /// \brief Memory span enclosing the chunk.
+        RWByteSpan self_;
+
+        /// \brief Alignment the chunk was allocated with.
+        Alignment alignment_;
+
+        /// \brief Get a pointer to the first byte in the payload.
+        [[nodiscard]] RWBytePtr
+        GetBegin() noexcept
+        {
+            return self_.GetData() + SizeOf<Chunk>();
+        }
+
+        /// \brief Get a pointer past the last byte in the payload.
+        [[nodiscard]] RWBytePtr
+        GetEnd() noexcept
+        {
+            return self_.GetData() + self_.GetCount();
+        }
+    };
+
+    /************************************************************************/
+    /* FRAME ALLOCATOR <ALLOCATOR, COUNT, POLICY> :: ARENA                  */
+    /************************************************************************/
+
+    /// \brief The arena of a frame.
+    ///
+    /// Chunks preceding the current one are exhausted, chunks following
+    /// the current one are still empty.
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    struct FrameAllocator<TAllocator, TCount, TPolicy>::Arena
+    {
+        /// \brief First chunk.
+        RWPtr<Chunk> first_{ nullptr };
+
+        /// \brief Current chunk.
+        RWPtr<Chunk> chunk_{ nullptr };
+
+        /// \brief Pointer past the last allocated byte in the current chunk.
+        RWBytePtr head_{ nullptr };
+
+        /// \brief Pointer past the last byte in the current chunk.
+        RWBytePtr end_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* FRAME ALLOCATOR <ALLOCATOR, COUNT, POLICY>                           */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    template <typename... TArguments>
+    inline FrameAllocator<TAllocator, TCount, TPolicy>
+    ::FrameAllocator(Bytes granularity,
+                     Forwarding<TArguments>... arguments) noexcept
+        : allocator_(Forward<TArguments>(arguments)...)
+        , granularity_(granularity)
+    {
+
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    inline FrameAllocator<TAllocator, TCount, TPolicy>
+    ::~FrameAllocator() noexcept
+    {
+        DeallocateAll();
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline RWByteSpan FrameAllocator<TAllocator, TCount, TPolicy>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        auto& arena = arenas_[epoch_ % TCount];
+
+        // Allocate on the current chunk. Fast-path.
+
+        if (arena.chunk_)
+        {
+            auto block_begin = Align(arena.head_, alignment);
+            auto block_end = block_begin + size;
+
+            if ((block_begin <= arena.end_) && (block_end <= arena.end_))
+            {
+                arena.head_ = block_end;
+
+                return { block_begin, block_end };
+            }
+        }
+
+        // Allocate on the next chunk.
+
+        if (NextChunk(arena, size, alignment))
+        {
+            auto block_begin = Align(arena.head_, alignment);
+            auto block_end = block_begin + size;
+
+            arena.head_ = block_end;
+
+            return { block_begin, block_end };
+        }
+
+        // Out-of-memory.
+
+        return {};
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    inline void FrameAllocator<TAllocator, TCount, TPolicy>
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment) noexcept
+    {
+        if constexpr (TPolicy::kIsChecked)
+        {
+            // Blocks of retired frames are either out of any arena or past
+            // the head of a reset arena, unless they were allocated again
+            // since.
+
+            auto is_alive = !block.GetData();
+
+            for (auto index = 0; !is_alive && (index < TCount); ++index)
+            {
+                is_alive = IsAllocated(arenas_[index], block);
+            }
+
+            SYNTROPY_UNDEFINED_BEHAVIOR(is_alive,
+                "The provided block belongs to a retired frame.");
+        }
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    inline Int FrameAllocator<TAllocator, TCount, TPolicy>
+    ::AdvanceFrame() noexcept
+    {
+        ++epoch_;
+
+        // The arena of the new frame was used TCount frames ago.
+
+        ResetArena(arenas_[epoch_ % TCount]);
+
+        return epoch_;
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline Int FrameAllocator<TAllocator, TCount, TPolicy>
+    ::GetEpoch() const noexcept
+    {
+        return epoch_;
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline Bool FrameAllocator<TAllocator, TCount, TPolicy>
+    ::IsAlive(Int epoch) const noexcept
+    {
+        return (epoch <= epoch_) && (epoch > epoch_ - TCount);
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    inline void FrameAllocator<TAllocator, TCount, TPolicy>
+    ::DeallocateAll() noexcept
+    {
+        for (auto& arena : arenas_)
+        {
+            while (arena.first_)
+            {
+                auto next = arena.first_->next_;
+                auto self = arena.first_->self_;
+                auto alignment = arena.first_->alignment_;
+
+                allocator_.Deallocate(self, alignment);
+
+                arena.first_ = next;
+            }
+
+            arena = Arena{};
+        }
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline Bool FrameAllocator<TAllocator, TCount, TPolicy>
+    ::Owns(Immutable<ByteSpan> block) const noexcept
+    {
+        for (auto& arena : arenas_)
+        {
+            for (auto chunk = arena.first_; chunk; chunk = chunk->next_)
+            {
+                if ((block.GetData() >= chunk->GetBegin())
+                    && (block.GetData() + block.GetCount() <= chunk->GetEnd()))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline Mutable<TAllocator>
+    FrameAllocator<TAllocator, TCount, TPolicy>
+    ::GetAllocator() noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline Immutable<TAllocator>
+    FrameAllocator<TAllocator, TCount, TPolicy>
+    ::GetAllocator() const noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline Bool FrameAllocator<TAllocator, TCount, TPolicy>
+    ::NextChunk(Mutable<Arena> arena,
+                Bytes size,
+                Alignment alignment) noexcept
+    {
+        // Chunks retained from previous frames are reused when large
+        // enough, otherwise a new chunk is linked in front of them.
+
+        auto next = arena.chunk_ ? arena.chunk_->next_ : arena.first_;
+
+        if (next)
+        {
+            auto block_end = Align(next->GetBegin(), alignment) + size;
+
+            if (block_end <= next->GetEnd())
+            {
+                arena.chunk_ = next;
+                arena.head_ = next->GetBegin();
+                arena.end_ = next->GetEnd();
+
+                return true;
+            }
+        }
+
+        // Padding the payload such that the block fits even in the worst
+        // alignment scenario.
+
+        auto chunk_alignment = Math::Max(alignment, AlignmentOf<Chunk>());
+
+        auto header_size = SizeOf<Chunk>();
+
+        auto payload_size = size + ToBytes(chunk_alignment) - Bytes{ 1 };
+
+        auto chunk_size = Math::Max(granularity_, header_size + payload_size);
+
+        auto storage = allocator_.Allocate(chunk_size, chunk_alignment);
+
+        if (!storage.GetData())
+        {
+            return false;
+        }
+
+        auto chunk = new (storage.GetData()) Chunk{ next,
+                                                    storage,
+                                                    chunk_alignment };
+
+        if (arena.chunk_)
+        {
+            arena.chunk_->next_ = chunk;
+        }
+        else
+        {
+            arena.first_ = chunk;
+        }
+
+        arena.chunk_ = chunk;
+        arena.head_ = chunk->GetBegin();
+        arena.end_ = chunk->GetEnd();
+
+        return true;
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    inline void FrameAllocator<TAllocator, TCount, TPolicy>
+    ::ResetArena(Mutable<Arena> arena) noexcept
+    {
+        if constexpr (TPolicy::kIsChecked)
+        {
+            // Poison the memory of the retired frame to expose dangling
+            // references.
+
+            for (auto chunk = arena.first_; chunk && arena.chunk_;
+                 chunk = chunk->next_)
+            {
+                auto chunk_end = (chunk == arena.chunk_)
+                    ? arena.head_
+                    : chunk->GetEnd();
+
+                Set(RWByteSpan{ chunk->GetBegin(), chunk_end },
+                    TPolicy::kRetiredPattern);
+
+                if (chunk == arena.chunk_)
+                {
+                    break;
+                }
+            }
+        }
+
+        arena.chunk_ = nullptr;
+        arena.head_ = nullptr;
+        arena.end_ = nullptr;
+    }
+
+    template <Templates::Allocator TAllocator, Int TCount, typename TPolicy>
+    [[nodiscard]] inline Bool FrameAllocator<TAllocator, TCount, TPolicy>
+    ::IsAllocated(Immutable<Arena> arena,
+                  Immutable<ByteSpan> block) const noexcept
+    {
+        if (!arena.chunk_)
+        {
+            return false;
+        }
+
+        for (auto chunk = arena.first_; chunk; chunk = chunk->next_)
+        {
+            auto chunk_end = (chunk == arena.chunk_)
+                ? arena.head_
+                : chunk->GetEnd();
+
+            if ((block.GetData() >= chunk->GetBegin())
+                && (block.GetData() + block.GetCount() <= chunk_end))
+            {
+                return true;
+            }
+
+            if (chunk == arena.chunk_)
+            {
+                break;
+            }
+        }
+
+        return false;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,441 @@
+/// \file instrumenting_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include <bit>
+#include <new>
+
+#include "syntropy/math/math.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* MACROS                                                               */
+    /************************************************************************/
+
+    #undef SYNTROPY_ALLOCATION_SITE
+    #define SYNTROPY_ALLOCATION_SITE \
+        static const auto syntropy_allocation_site = SYNTROPY_HERE; \
+        const auto syntropy_allocation_site_scope \
+            = Syntropy::Memory::AllocationSite{ syntropy_allocation_site }
+
+    /************************************************************************/
+    /* ALLOCATION SITE                                                      */
+    /************************************************************************/
+
+    [[nodiscard]] inline Ptr<Diagnostics::SourceLocation> AllocationSite
+    ::GetCurrent() noexcept
+    {
+        return GetSite();
+    }
+
+    inline AllocationSite
+    ::AllocationSite(Immutable<Diagnostics::SourceLocation> site) noexcept
+        : previous_site_(GetSite())
+    {
+        GetSite() = PtrOf(site);
+    }
+
+    inline AllocationSite
+    ::~AllocationSite() noexcept
+    {
+        GetSite() = previous_site_;
+    }
+
+    [[nodiscard]] inline Mutable<Ptr<Diagnostics::SourceLocation>>
+    AllocationSite
+    ::GetSite() noexcept
+    {
+        static thread_local auto site = Ptr<Diagnostics::SourceLocation>{};
+
+        return site;
+    }
+
+    /************************************************************************/
+    /* INSTRUMENTING ALLOCATOR <ALLOCATOR> :: HEADER                        */
+    /************************************************************************/
+
+    /// \brief Header preceding each allocated block.
+    ///
+    /// The header is placed right before the block, at the end of a prefix
+    /// whose size preserves the block alignment.
+    template <Templates::Allocator TAllocator>
+    struct InstrumentingAllocator<TAllocator>::Header
+    {
+        /// \brief Site the block was allocated from.
+        Ptr<Diagnostics::SourceLocation> site_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* INSTRUMENTING ALLOCATOR <ALLOCATOR> :: TABLE                         */
+    /************************************************************************/
+
+    /// \brief A table of per-site statistics.
+    ///
+    /// Sites are indexed by their address via open addressing.
+    template <Templates::Allocator TAllocator>
+    struct InstrumentingAllocator<TAllocator>::Table
+    {
+        /// \brief Statistics for each known site.
+        TSiteStatistics sites_[kSiteCount];
+
+        /// \brief Statistics for the unknown site.
+        TSiteStatistics unknown_;
+
+        /// \brief Find the statistics of a site, adding a new entry if
+        ///        needed.
+        [[nodiscard]] Mutable<TSiteStatistics>
+        Find(Ptr<Diagnostics::SourceLocation> site) noexcept
+        {
+            if (!site)
+            {
+                return unknown_;
+            }
+
+            // Fibonacci hashing, discarding low bits which are always zero.
+
+            auto address = reinterpret_cast<std::uintptr_t>(site) >> 4;
+
+            auto hash = static_cast<std::uint64_t>(address)
+                      * 0x9E3779B97F4A7C15ull;
+
+            auto index = static_cast<Int>(
+                hash >> (64 - std::countr_zero(
+                    static_cast<std::uint64_t>(kSiteCount))));
+
+            for (auto probe = Int{ 0 }; probe < kSiteCount; ++probe)
+            {
+                auto& entry = sites_[(index + probe) % kSiteCount];
+
+                if (entry.site_ == site)
+                {
+                    return entry;
+                }
+
+                if (!entry.site_)
+                {
+                    entry.site_ = site;
+
+                    return entry;
+                }
+            }
+
+            return unknown_;
+        }
+    };
+
+    /************************************************************************/
+    /* INSTRUMENTING ALLOCATOR <ALLOCATOR> :: RECORD                        */
+    /************************************************************************/
+
+    /// \brief Statistics recorded by threads mapped to the same slot.
+    template <Templates::Allocator TAllocator>
+    struct InstrumentingAllocator<TAllocator>::Record
+    {
+        /// \brief Whether the record is currently acquired by a thread.
+        std::atomic<Bool> busy_{ false };
+
+        /// \brief Per-site statistics.
+        Table table_;
+    };
+
+    /************************************************************************/
+    /* INSTRUMENTING ALLOCATOR <ALLOCATOR>                                  */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator>
+    template <typename... TArguments>
+    inline InstrumentingAllocator<TAllocator>
+    ::InstrumentingAllocator(Forwarding<TArguments>... arguments) noexcept
+        : allocator_(Forward<TArguments>(arguments)...)
+    {
+
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline InstrumentingAllocator<TAllocator>
+    ::~InstrumentingAllocator() noexcept
+    {
+        for (auto&& record : records_)
+        {
+            if (auto pointer = record.load())
+            {
+                allocator_.Deallocate({ ToBytePtr(pointer), SizeOf<Record>() },
+                                      AlignmentOf<Record>());
+            }
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan InstrumentingAllocator<TAllocator>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        return Allocate(size, alignment, AllocationSite::GetCurrent());
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan InstrumentingAllocator<TAllocator>
+    ::Allocate(Bytes size,
+               Alignment alignment,
+               Immutable<Diagnostics::SourceLocation> site) noexcept
+    {
+        return Allocate(size, alignment, PtrOf(site));
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void InstrumentingAllocator<TAllocator>
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        if (!block.GetData())
+        {
+            return;
+        }
+
+        auto prefix_size = GetPrefixSize(alignment);
+
+        auto header = FromBytePtr<Header>(block.GetData()
+                                          - ToInt(SizeOf<Header>()));
+
+        if (auto record = AcquireRecord())
+        {
+            auto& statistics = record->table_.Find(header->site_);
+
+            ++statistics.deallocation_count_;
+
+            statistics.deallocated_size_ += block.GetCount();
+            statistics.live_size_ -= block.GetCount();
+
+            ReleaseRecord(*record);
+        }
+
+        auto storage = RWByteSpan{ block.GetData() - prefix_size,
+                                   block.GetCount() + Bytes{ prefix_size } };
+
+        allocator_.Deallocate(storage,
+                              Math::Max(alignment, AlignmentOf<Header>()));
+    }
+
+    template <Templates::Allocator TAllocator>
+    template <typename TFunction>
+    inline void InstrumentingAllocator<TAllocator>
+    ::Snapshot(Forwarding<TFunction> function) noexcept
+    {
+        // The merging table is not allocated on the instrumented path to
+        // avoid recording the snapshot itself.
+
+        auto storage = allocator_.Allocate(SizeOf<Table>(),
+                                           AlignmentOf<Table>());
+
+        if (!storage.GetData())
+        {
+            return;
+        }
+
+        auto merged = new (storage.GetData()) Table{};
+
+        auto merge = [](Mutable<TSiteStatistics> lhs,
+                        Immutable<TSiteStatistics> rhs)
+        {
+            lhs.allocation_count_ += rhs.allocation_count_;
+            lhs.deallocation_count_ += rhs.deallocation_count_;
+            lhs.allocated_size_ += rhs.allocated_size_;
+            lhs.deallocated_size_ += rhs.deallocated_size_;
+            lhs.live_size_ += rhs.live_size_;
+            lhs.peak_size_ = Math::Max(lhs.peak_size_, rhs.peak_size_);
+
+            for (auto index = Int{ 0 };
+                 index < TSiteStatistics::kHistogramCount;
+                 ++index)
+            {
+                lhs.histogram_[index] += rhs.histogram_[index];
+            }
+        };
+
+        for (auto&& slot : records_)
+        {
+            if (auto record = slot.load(std::memory_order_acquire))
+            {
+                for (; record->busy_.exchange(true,
+                                              std::memory_order_acquire);)
+                {
+
+                }
+
+                for (auto&& site : record->table_.sites_)
+                {
+                    if (site.site_)
+                    {
+                        merge(merged->Find(site.site_), site);
+                    }
+                }
+
+                merge(merged->unknown_, record->table_.unknown_);
+
+                ReleaseRecord(*record);
+            }
+        }
+
+        auto report = [&function](Mutable<TSiteStatistics> statistics)
+        {
+            if (statistics.allocation_count_ > 0)
+            {
+                // Blocks deallocated on a different thread make per-thread
+                // peaks unreliable: the current usage is a lower bound.
+
+                statistics.peak_size_ = Math::Max(statistics.peak_size_,
+                                                  statistics.live_size_);
+
+                function(Immutable<TSiteStatistics>(statistics));
+            }
+        };
+
+        report(merged->unknown_);
+
+        for (auto&& site : merged->sites_)
+        {
+            report(site);
+        }
+
+        allocator_.Deallocate(storage, AlignmentOf<Table>());
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator>
+    InstrumentingAllocator<TAllocator>
+    ::GetAllocator() noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Immutable<TAllocator>
+    InstrumentingAllocator<TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan InstrumentingAllocator<TAllocator>
+    ::Allocate(Bytes size,
+               Alignment alignment,
+               Ptr<Diagnostics::SourceLocation> site) noexcept
+    {
+        auto prefix_size = GetPrefixSize(alignment);
+
+        auto storage = allocator_.Allocate(
+            size + Bytes{ prefix_size },
+            Math::Max(alignment, AlignmentOf<Header>()));
+
+        if (!storage.GetData())
+        {
+            return {};
+        }
+
+        auto block = storage.GetData() + prefix_size;
+
+        new (block - ToInt(SizeOf<Header>())) Header{ site };
+
+        if (auto record = AcquireRecord())
+        {
+            auto& statistics = record->table_.Find(site);
+
+            auto bucket = Math::Min(
+                static_cast<Int>(
+                    std::bit_width(static_cast<std::uint64_t>(ToInt(size)))),
+                TSiteStatistics::kHistogramCount - 1);
+
+            ++statistics.allocation_count_;
+            ++statistics.histogram_[bucket];
+
+            statistics.allocated_size_ += size;
+            statistics.live_size_ += size;
+            statistics.peak_size_ = Math::Max(statistics.peak_size_,
+                                              statistics.live_size_);
+
+            ReleaseRecord(*record);
+        }
+
+        return { block, size };
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Int InstrumentingAllocator<TAllocator>
+    ::GetThreadIndex() noexcept
+    {
+        static auto thread_count = std::atomic<Int>{ 0 };
+
+        static thread_local auto thread_index
+            = thread_count.fetch_add(1, std::memory_order_relaxed);
+
+        return thread_index;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Int InstrumentingAllocator<TAllocator>
+    ::GetPrefixSize(Alignment alignment) noexcept
+    {
+        return Math::Ceil(ToInt(SizeOf<Header>()), ToInt(alignment));
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWPtr<typename InstrumentingAllocator<TAllocator>
+                                   ::Record>
+    InstrumentingAllocator<TAllocator>
+    ::AcquireRecord() noexcept
+    {
+        auto& slot = records_[GetThreadIndex() % kRecordCount];
+
+        auto record = slot.load(std::memory_order_acquire);
+
+        if (!record)
+        {
+            // Records are allocated lazily: the first thread to publish
+            // its record wins.
+
+            auto storage = allocator_.Allocate(SizeOf<Record>(),
+                                               AlignmentOf<Record>());
+
+            if (!storage.GetData())
+            {
+                return nullptr;
+            }
+
+            auto candidate = new (storage.GetData()) Record{};
+
+            if (slot.compare_exchange_strong(record,
+                                             candidate,
+                                             std::memory_order_acq_rel))
+            {
+                record = candidate;
+            }
+            else
+            {
+                allocator_.Deallocate(storage, AlignmentOf<Record>());
+            }
+        }
+
+        // Records are contended only by threads mapped to the same slot.
+
+        for (; record->busy_.exchange(true, std::memory_order_acquire);)
+        {
+
+        }
+
+        return record;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void InstrumentingAllocator<TAllocator>
+    ::ReleaseRecord(Mutable<Record> record) noexcept
+    {
+        record.busy_.store(false, std::memory_order_release);
+    }
+
+}
+
+// ===========================================================================
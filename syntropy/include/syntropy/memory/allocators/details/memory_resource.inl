@@ -0,0 +1,146 @@
+/// \file memory_resource.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <new>
+
+#include "syntropy/math/math.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* MEMORY RESOURCE <ALLOCATOR>                                          */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator>
+    inline MemoryResource<TAllocator>
+    ::MemoryResource() noexcept
+        requires Templates::IsSame<TAllocator, BaseAllocator>
+        : allocator_(PtrOf(GetScopeAllocator()))
+    {
+
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline MemoryResource<TAllocator>
+    ::MemoryResource(Mutable<TAllocator> allocator) noexcept
+        : allocator_(PtrOf(allocator))
+    {
+
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator> MemoryResource<TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return *allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWTypelessPtr MemoryResource<TAllocator>
+    ::do_allocate(std::size_t size, std::size_t alignment)
+    {
+        // Zero-sized requests must yield a distinct non-null pointer.
+
+        auto block_size = Math::Max(static_cast<Int>(size), Int{ 1 });
+        auto block_alignment = ToAlignment(static_cast<Int>(alignment));
+
+        auto block = allocator_->Allocate(Bytes{ block_size }, block_alignment);
+
+        if (!block)
+        {
+            throw std::bad_alloc{};
+        }
+
+        return block.GetData();
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void MemoryResource<TAllocator>
+    ::do_deallocate(RWTypelessPtr storage,
+                    std::size_t size,
+                    std::size_t alignment)
+    {
+        auto block_size = Math::Max(static_cast<Int>(size), Int{ 1 });
+        auto block_alignment = ToAlignment(static_cast<Int>(alignment));
+
+        auto block = MakeByteSpan(ToBytePtr(storage), Bytes{ block_size });
+
+        allocator_->Deallocate(block, block_alignment);
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline bool MemoryResource<TAllocator>
+    ::do_is_equal(Immutable<std::pmr::memory_resource> rhs) const noexcept
+    {
+        if (auto resource = dynamic_cast<Ptr<MemoryResource>>(PtrOf(rhs)))
+        {
+            return allocator_ == resource->allocator_;
+        }
+
+        return false;
+    }
+
+    /************************************************************************/
+    /* MEMORY RESOURCE ALLOCATOR                                            */
+    /************************************************************************/
+
+    inline MemoryResourceAllocator
+    ::MemoryResourceAllocator() noexcept
+        : memory_resource_(std::pmr::get_default_resource())
+    {
+
+    }
+
+    inline MemoryResourceAllocator
+    ::MemoryResourceAllocator(
+        Mutable<std::pmr::memory_resource> memory_resource) noexcept
+        : memory_resource_(PtrOf(memory_resource))
+    {
+
+    }
+
+    [[nodiscard]] inline RWByteSpan MemoryResourceAllocator
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        auto size_value = static_cast<std::size_t>(ToInt(size));
+        auto alignment_value = static_cast<std::size_t>(ToInt(alignment));
+
+        try
+        {
+            auto block = memory_resource_->allocate(size_value,
+                                                    alignment_value);
+
+            return MakeByteSpan(ToBytePtr(block), size);
+        }
+        catch (Immutable<std::bad_alloc>)
+        {
+            return {};
+        }
+    }
+
+    inline void MemoryResourceAllocator
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        auto size_value = static_cast<std::size_t>(ToInt(block.GetCount()));
+        auto alignment_value = static_cast<std::size_t>(ToInt(alignment));
+
+        memory_resource_->deallocate(block.GetData(),
+                                     size_value,
+                                     alignment_value);
+    }
+
+    [[nodiscard]] inline Mutable<std::pmr::memory_resource>
+    MemoryResourceAllocator
+    ::GetMemoryResource() const noexcept
+    {
+        return *memory_resource_;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,247 @@
+/// \file numa_arena_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <new>
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* NUMA ARENA ALLOCATOR :: CHUNK                                        */
+    /************************************************************************/
+
+    /// \brief A chunk in the allocation chain of a sub-arena.
+    ///
+    /// Each chunk is laid out as a header followed by the chunk payload.
+    struct NumaArenaAllocator::Chunk
+    {
+        /// \brief Previous chunk.
+        RWPtr<Chunk> previous_{ nullptr };
+
+        /// \brief Memory span enclosing the chunk.
+        RWByteSpan self_;
+    };
+
+    /************************************************************************/
+    /* NUMA ARENA ALLOCATOR :: ARENA                                        */
+    /************************************************************************/
+
+    /// \brief A sub-arena serving a NUMA node.
+    ///
+    /// Sub-arenas are aligned to cache lines to prevent false sharing
+    /// among threads running on different nodes.
+    struct alignas(64) NumaArenaAllocator::Arena
+    {
+        /// \brief Mutex guarding the sub-arena.
+        std::mutex mutex_;
+
+        /// \brief Current chunk.
+        RWPtr<Chunk> chunk_{ nullptr };
+
+        /// \brief Pointer past the last allocated byte in the current chunk.
+        RWBytePtr head_{ nullptr };
+
+        /// \brief Pointer past the last byte in the current chunk.
+        RWBytePtr end_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* NUMA ARENA ALLOCATOR                                                 */
+    /************************************************************************/
+
+    inline NumaArenaAllocator
+    ::NumaArenaAllocator(Bytes granularity) noexcept
+        : granularity_(VirtualMemory::Ceil(granularity))
+        , arena_count_(Math::Min(VirtualMemory::GetNodeCount(), kArenaCount))
+    {
+        // Sub-arenas are allocated on their own pages.
+
+        auto storage_size
+            = VirtualMemory::Ceil(SizeOf<Arena>() * arena_count_);
+
+        auto storage = VirtualMemory::Allocate(storage_size);
+
+        if (!storage.GetData())
+        {
+            arena_count_ = 0;
+            return;
+        }
+
+        arenas_ = FromBytePtr<Arena>(storage.GetData());
+
+        for (auto index = 0; index < arena_count_; ++index)
+        {
+            new (arenas_ + index) Arena{};
+        }
+    }
+
+    inline NumaArenaAllocator
+    ::~NumaArenaAllocator() noexcept
+    {
+        if (arenas_)
+        {
+            DeallocateAll();
+
+            for (auto index = 0; index < arena_count_; ++index)
+            {
+                arenas_[index].~Arena();
+            }
+
+            auto storage_size
+                = VirtualMemory::Ceil(SizeOf<Arena>() * arena_count_);
+
+            VirtualMemory::Release({ ToBytePtr(arenas_), storage_size });
+        }
+    }
+
+    [[nodiscard]] inline RWByteSpan NumaArenaAllocator
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        // Querying the node is pointless when there's only one sub-arena.
+
+        auto node = (arena_count_ > 1) ? VirtualMemory::GetCurrentNode() : 0;
+
+        return Allocate(size, alignment, node);
+    }
+
+    [[nodiscard]] inline RWByteSpan NumaArenaAllocator
+    ::Allocate(Bytes size, Alignment alignment, Int node) noexcept
+    {
+        if (!arenas_)
+        {
+            return {};
+        }
+
+        auto& arena = arenas_[node % arena_count_];
+
+        auto lock = std::lock_guard{ arena.mutex_ };
+
+        auto block_begin = Align(arena.head_, alignment);
+        auto block_end = block_begin + size;
+
+        if (!arena.chunk_ || (block_end > arena.end_))
+        {
+            if (!AllocateChunk(arena, node, size, alignment))
+            {
+                return {};
+            }
+
+            block_begin = Align(arena.head_, alignment);
+            block_end = block_begin + size;
+        }
+
+        arena.head_ = block_end;
+
+        return { block_begin, block_end };
+    }
+
+    inline void NumaArenaAllocator
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment) noexcept
+    {
+        SYNTROPY_UNDEFINED_BEHAVIOR(Owns(block),
+            "The provided block doesn't belong to this allocator instance.");
+    }
+
+    inline void NumaArenaAllocator
+    ::DeallocateAll() noexcept
+    {
+        for (auto index = 0; index < arena_count_; ++index)
+        {
+            auto& arena = arenas_[index];
+
+            while (arena.chunk_)
+            {
+                auto previous = arena.chunk_->previous_;
+
+                VirtualMemory::Release(arena.chunk_->self_);
+
+                arena.chunk_ = previous;
+            }
+
+            arena.head_ = nullptr;
+            arena.end_ = nullptr;
+        }
+    }
+
+    [[nodiscard]] inline Bool NumaArenaAllocator
+    ::Owns(Immutable<ByteSpan> block) const noexcept
+    {
+        for (auto index = 0; index < arena_count_; ++index)
+        {
+            auto& arena = arenas_[index];
+
+            auto lock = std::lock_guard{ arena.mutex_ };
+
+            for (auto chunk = arena.chunk_; chunk; chunk = chunk->previous_)
+            {
+                auto chunk_begin = chunk->self_.GetData();
+                auto chunk_end = chunk_begin + chunk->self_.GetCount();
+
+                if ((block.GetData() >= chunk_begin)
+                    && (block.GetData() + block.GetCount() <= chunk_end))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] inline Int NumaArenaAllocator
+    ::GetArenaCount() const noexcept
+    {
+        return arena_count_;
+    }
+
+    [[nodiscard]] inline Bool NumaArenaAllocator
+    ::AllocateChunk(Mutable<Arena> arena,
+                    Int node,
+                    Bytes size,
+                    Alignment alignment) noexcept
+    {
+        // Padding the payload such that the block fits even in the worst
+        // alignment scenario.
+
+        auto header_size = SizeOf<Chunk>();
+
+        auto payload_size = size + ToBytes(alignment) - Bytes{ 1 };
+
+        auto chunk_size = VirtualMemory::Ceil(
+            Math::Max(granularity_, header_size + payload_size));
+
+        auto storage = VirtualMemory::Allocate(chunk_size);
+
+        if (!storage.GetData())
+        {
+            return false;
+        }
+
+        // Pages are not accessed yet: binding them before writing the
+        // header ensures every page is acquired from the preferred node.
+        // Placement is a hint, the chunk is usable regardless.
+
+        if (arena_count_ > 1)
+        {
+            VirtualMemory::Bind(storage, node);
+        }
+
+        arena.chunk_ = new (storage.GetData()) Chunk{ arena.chunk_, storage };
+
+        arena.head_ = storage.GetData() + header_size;
+        arena.end_ = storage.GetData() + storage.GetCount();
+
+        return true;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,50 @@
+/// \file page_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* PAGE ALLOCATOR                                                       */
+    /************************************************************************/
+
+    [[nodiscard]] inline RWByteSpan PageAllocator
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        if ((size <= Bytes{ 0 })
+            || (alignment > VirtualMemory::GetPageAlignment()))
+        {
+            return {};
+        }
+
+        if (auto block = VirtualMemory::Allocate(size))
+        {
+            return MakeByteSpan(block.GetData(), size);
+        }
+
+        return {};
+    }
+
+    [[nodiscard]] inline RWByteSpan PageAllocator
+    ::AllocateZeroed(Bytes size, Alignment alignment) noexcept
+    {
+        // Freshly mapped pages are zero-filled by the system.
+
+        return Allocate(size, alignment);
+    }
+
+    inline void PageAllocator
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        VirtualMemory::Release(block);
+    }
+
+}
+
+// ===========================================================================
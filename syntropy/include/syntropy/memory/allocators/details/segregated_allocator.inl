@@ -0,0 +1,402 @@
+/// \file segregated_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2016
+
+#pragma once
+
+#include <bit>
+#include <new>
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/memory/foundation/memory.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* SEGREGATED ALLOCATOR <ALLOCATOR> :: SLAB                             */
+    /************************************************************************/
+
+    /// \brief A slab of same-sized blocks.
+    ///
+    /// Each slab is laid out as a header, followed by a sequence of blocks.
+    /// The header is never decommitted, as it links released slabs too.
+    template <Templates::Allocator TAllocator>
+    struct SegregatedAllocator<TAllocator>::Slab
+    {
+        /// \brief Number of words in the occupancy bitmap.
+        static constexpr Int
+        kWordCount = kSlabSize / kMaxClassAlignment / 64;
+
+        /// \brief Next slab in the same list.
+        RWPtr<Slab> next_{ nullptr };
+
+        /// \brief Previous slab in the same list.
+        RWPtr<Slab> previous_{ nullptr };
+
+        /// \brief Class of the blocks in this slab.
+        Int size_class_{ 0 };
+
+        /// \brief Size of each block, in bytes.
+        Int block_size_{ 0 };
+
+        /// \brief Number of blocks in this slab.
+        Int block_count_{ 0 };
+
+        /// \brief Number of free blocks in this slab.
+        Int free_count_{ 0 };
+
+        /// \brief Index of the first bitmap word which may have free blocks.
+        Int hint_{ 0 };
+
+        /// \brief Occupancy bitmap. Bits are set for busy blocks.
+        std::uint64_t bitmap_[kWordCount] = {};
+
+        /// \brief Get the offset of the first block from the slab start.
+        [[nodiscard]] static constexpr Int
+        GetBlocksOffset() noexcept
+        {
+            return Math::Ceil(ToInt(SizeOf<Slab>()), kMaxClassAlignment);
+        }
+
+        /// \brief Get a pointer to the first block.
+        [[nodiscard]] RWBytePtr
+        GetBlocks() noexcept
+        {
+            return ToBytePtr(this) + Bytes{ GetBlocksOffset() };
+        }
+    };
+
+    /************************************************************************/
+    /* SEGREGATED ALLOCATOR <ALLOCATOR>                                     */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator>
+    template <typename... TArguments>
+    inline SegregatedAllocator<TAllocator>
+    ::SegregatedAllocator(Bytes capacity,
+                          Forwarding<TArguments>... arguments) noexcept
+        : allocator_(Forward<TArguments>(arguments)...)
+        , buffer_(VirtualMemory::Ceil(capacity) + Bytes{ kSlabSize })
+    {
+        // Virtual memory is page-aligned: the extra slab is reserved to
+        // align the first slab to the slab size.
+
+        if (buffer_.GetData())
+        {
+            auto buffer_end = buffer_.GetData() + buffer_.GetCount();
+
+            head_ = Align(buffer_.GetData(), ToAlignment(Bytes{ kSlabSize }));
+
+            end_ = AlignDown(buffer_end, ToAlignment(Bytes{ kSlabSize }));
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] RWByteSpan SegregatedAllocator<TAllocator>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        if (size <= Bytes{ 0 })
+        {
+            return {};
+        }
+
+        if (!IsSegregated(size, alignment))
+        {
+            return allocator_.Allocate(size, alignment);
+        }
+
+        auto size_class = GetClass(size);
+
+        auto slab = partial_slabs_[size_class];
+
+        if (!slab)
+        {
+            slab = AcquireSlab(size_class);
+        }
+
+        if (!slab)
+        {
+            return {};                                  // Out of memory.
+        }
+
+        // Partial slabs always have at least one free block.
+
+        auto word = slab->hint_;
+
+        while (!~slab->bitmap_[word])
+        {
+            word = (word + 1) % Slab::kWordCount;
+        }
+
+        auto bit = std::countr_zero(~slab->bitmap_[word]);
+
+        slab->bitmap_[word] |= (std::uint64_t{ 1 } << bit);
+        slab->hint_ = word;
+
+        if (--slab->free_count_ == 0)
+        {
+            UnlinkSlab(*slab);
+        }
+
+        auto index = word * 64 + bit;
+
+        return { slab->GetBlocks() + Bytes{ index * slab->block_size_ }, size };
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] RWByteSpan SegregatedAllocator<TAllocator>
+    ::AllocateZeroed(Bytes size, Alignment alignment) noexcept
+    {
+        if ((size > Bytes{ 0 }) && !IsSegregated(size, alignment))
+        {
+            return Memory::AllocateZeroed(allocator_, size, alignment);
+        }
+
+        auto block = Allocate(size, alignment);
+
+        Zero(block);
+
+        return block;
+    }
+
+    template <Templates::Allocator TAllocator>
+    void SegregatedAllocator<TAllocator>
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        if (!block.GetData())
+        {
+            return;
+        }
+
+        if (!IsSegregated(block.GetCount(), alignment))
+        {
+            allocator_.Deallocate(block, alignment);
+            return;
+        }
+
+        SYNTROPY_UNDEFINED_BEHAVIOR(
+            (block.GetData() >= buffer_.GetData())
+                && (block.GetData() < buffer_.GetData() + buffer_.GetCount()),
+            "The provided block doesn't belong to this allocator instance.");
+
+        auto slab = FromBytePtr<Slab>(
+            AlignDown(block.GetData(), ToAlignment(Bytes{ kSlabSize })));
+
+        auto offset = Int{ block.GetData() - slab->GetBlocks() };
+
+        auto index = offset / slab->block_size_;
+
+        auto word = index / 64;
+        auto bit = std::uint64_t{ 1 } << (index % 64);
+
+        SYNTROPY_UNDEFINED_BEHAVIOR((slab->bitmap_[word] & bit) != 0,
+            "The provided block was already deallocated.");
+
+        slab->bitmap_[word] &= ~bit;
+        slab->hint_ = Math::Min(slab->hint_, word);
+
+        // Full slabs are not linked to any list.
+
+        if (slab->free_count_++ == 0)
+        {
+            LinkSlab(*slab);
+        }
+
+        // Empty slabs are returned to the system, unless they are the only
+        // slab of their class with free blocks: this prevents a single
+        // allocation from repeatedly acquiring and releasing the same slab.
+
+        if ((slab->free_count_ == slab->block_count_)
+            && (slab->previous_ || slab->next_))
+        {
+            ReleaseSlab(*slab);
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bool SegregatedAllocator<TAllocator>
+    ::IsSegregated(Bytes size, Alignment alignment) noexcept
+    {
+        return (ToInt(size) <= kMaxClassSize)
+            && (ToInt(alignment) <= kMaxClassAlignment);
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator> SegregatedAllocator<TAllocator>
+    ::GetAllocator() noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Immutable<TAllocator>
+    SegregatedAllocator<TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Int SegregatedAllocator<TAllocator>
+    ::GetClass(Bytes size) noexcept
+    {
+        // Classes up to 128 bytes are spaced linearly by 16 bytes. Larger
+        // classes split each power of two range in four classes.
+
+        auto block_size = ToInt(size);
+
+        if (block_size <= 128)
+        {
+            return (block_size + 15) / 16 - 1;
+        }
+
+        auto range = static_cast<Int>(std::bit_width(
+            static_cast<std::uint64_t>(block_size - 1))) - 1;
+
+        auto step = Int{ 1 } << (range - 2);
+
+        auto offset = block_size - (Int{ 1 } << range);
+
+        return 8 + (range - 7) * 4 + (offset + step - 1) / step - 1;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bytes SegregatedAllocator<TAllocator>
+    ::GetClassSize(Int size_class) noexcept
+    {
+        if (size_class < 8)
+        {
+            return Bytes{ (size_class + 1) * 16 };
+        }
+
+        auto range = 7 + (size_class - 8) / 4;
+
+        auto step = Int{ 1 } << (range - 2);
+
+        return Bytes{ (Int{ 1 } << range) + ((size_class - 8) % 4 + 1) * step };
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] auto SegregatedAllocator<TAllocator>
+    ::AcquireSlab(Int size_class) noexcept -> RWPtr<Slab>
+    {
+        // Released slabs are recycled first.
+
+        auto storage = RWByteSpan{};
+
+        if (free_slabs_)
+        {
+            storage = { ToBytePtr(free_slabs_), Bytes{ kSlabSize } };
+
+            free_slabs_ = free_slabs_->next_;
+        }
+        else if (head_ + Bytes{ kSlabSize } <= end_)
+        {
+            storage = { head_, Bytes{ kSlabSize } };
+
+            head_ = head_ + Bytes{ kSlabSize };
+        }
+        else
+        {
+            return nullptr;
+        }
+
+        if (!VirtualMemory::Commit(storage))
+        {
+            return nullptr;
+        }
+
+        auto slab = new (storage.GetData()) Slab{};
+
+        auto block_size = ToInt(GetClassSize(size_class));
+
+        slab->size_class_ = size_class;
+        slab->block_size_ = block_size;
+        slab->block_count_ = (kSlabSize - Slab::GetBlocksOffset()) / block_size;
+        slab->free_count_ = slab->block_count_;
+
+        // Bits past the last block are permanently busy.
+
+        for (auto index = slab->block_count_;
+             index < Slab::kWordCount * 64;
+             ++index)
+        {
+            slab->bitmap_[index / 64] |= (std::uint64_t{ 1 } << (index % 64));
+        }
+
+        LinkSlab(*slab);
+
+        return slab;
+    }
+
+    template <Templates::Allocator TAllocator>
+    void SegregatedAllocator<TAllocator>
+    ::ReleaseSlab(Mutable<Slab> slab) noexcept
+    {
+        UnlinkSlab(slab);
+
+        // The first page holds the header and is kept committed.
+
+        auto page_size = VirtualMemory::GetPageSize();
+
+        if (page_size < Bytes{ kSlabSize })
+        {
+            auto slab_begin = ToBytePtr(&slab);
+
+            VirtualMemory::Decommit({ slab_begin + page_size,
+                                      slab_begin + Bytes{ kSlabSize } });
+        }
+
+        slab.next_ = free_slabs_;
+        slab.previous_ = nullptr;
+
+        free_slabs_ = &slab;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void SegregatedAllocator<TAllocator>
+    ::LinkSlab(Mutable<Slab> slab) noexcept
+    {
+        auto& head = partial_slabs_[slab.size_class_];
+
+        slab.next_ = head;
+        slab.previous_ = nullptr;
+
+        if (head)
+        {
+            head->previous_ = &slab;
+        }
+
+        head = &slab;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void SegregatedAllocator<TAllocator>
+    ::UnlinkSlab(Mutable<Slab> slab) noexcept
+    {
+        if (slab.previous_)
+        {
+            slab.previous_->next_ = slab.next_;
+        }
+        else
+        {
+            partial_slabs_[slab.size_class_] = slab.next_;
+        }
+
+        if (slab.next_)
+        {
+            slab.next_->previous_ = slab.previous_;
+        }
+
+        slab.next_ = nullptr;
+        slab.previous_ = nullptr;
+    }
+
+}
+
+// ===========================================================================
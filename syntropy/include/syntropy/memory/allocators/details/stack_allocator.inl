@@ -0,0 +1,281 @@
+/// \file stack_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2017
+
+#pragma once
+
+#include <new>
+
+#include "syntropy/core/algorithms/swap.h"
+
+#include "syntropy/math/math.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* STACK ALLOCATOR <ALLOCATOR> :: CHUNK                                 */
+    /************************************************************************/
+
+    /// \brief A chunk in the allocation chain.
+    ///
+    /// Each chunk is laid out as a header followed by the chunk payload.
+    template <Templates::Allocator TAllocator>
+    struct StackAllocator<TAllocator>::Chunk
+    {
+        /// \brief Previous chunk.
+        RWPtr<Chunk> previous_{ nullptr };
+
+        /// \brief Memory span enclosing the chunk.
+        RWByteSpan self_;
+
+        /// \brief Alignment the chunk was allocated with.
+        Alignment alignment_;
+    };
+
+    /************************************************************************/
+    /* STACK ALLOCATOR <ALLOCATOR>                                          */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator>
+    template <typename... TArguments>
+    inline StackAllocator<TAllocator>
+    ::StackAllocator(Bytes granularity,
+                     Forwarding<TArguments>... arguments) noexcept
+        : allocator_(Forward<TArguments>(arguments)...)
+        , granularity_(granularity)
+    {
+
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline StackAllocator<TAllocator>
+    ::StackAllocator(Movable<StackAllocator> rhs) noexcept
+        : allocator_(Move(rhs.allocator_))
+        , granularity_(rhs.granularity_)
+    {
+        Algorithms::Swap(chunk_, rhs.chunk_);
+        Algorithms::Swap(head_, rhs.head_);
+        Algorithms::Swap(end_, rhs.end_);
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline StackAllocator<TAllocator>
+    ::~StackAllocator() noexcept
+    {
+        DeallocateAll();
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline Mutable<StackAllocator<TAllocator>> StackAllocator<TAllocator>
+    ::operator=(StackAllocator rhs) noexcept
+    {
+        Swap(rhs);
+
+        return *this;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan StackAllocator<TAllocator>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        // Allocate on the current chunk. Fast-path.
+
+        if (chunk_)
+        {
+            auto block_begin = Align(head_, alignment);
+            auto block_end = block_begin + size;
+
+            if ((block_begin <= end_) && (block_end <= end_))
+            {
+                head_ = block_end;
+
+                return { block_begin, block_end };
+            }
+        }
+
+        // Allocate on a new chunk.
+
+        if (AllocateChunk(size, alignment))
+        {
+            auto block_begin = Align(head_, alignment);
+            auto block_end = block_begin + size;
+
+            head_ = block_end;
+
+            return { block_begin, block_end };
+        }
+
+        // Out-of-memory.
+
+        return {};
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void StackAllocator<TAllocator>
+    ::Deallocate(Immutable<RWByteSpan>, Alignment) noexcept
+    {
+
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bool StackAllocator<TAllocator>
+    ::Reallocate(Immutable<RWByteSpan> block,
+                 Bytes size,
+                 Alignment) noexcept
+    {
+        auto block_end = block.GetData() + block.GetCount();
+
+        if (!chunk_ || (block_end != head_))
+        {
+            return false;
+        }
+
+        if (auto new_end = block.GetData() + size; new_end <= end_)
+        {
+            head_ = new_end;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void StackAllocator<TAllocator>
+    ::DeallocateAll() noexcept
+    {
+        Rewind(TCheckpoint{});
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bool StackAllocator<TAllocator>
+    ::Owns(Immutable<ByteSpan> block) const noexcept
+    {
+        for (auto chunk = chunk_; chunk; chunk = chunk->previous_)
+        {
+            auto chunk_begin = chunk->self_.GetData();
+            auto chunk_end = chunk_begin + chunk->self_.GetCount();
+
+            if ((block.GetData() >= chunk_begin)
+                && (block.GetData() + block.GetCount() <= chunk_end))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline typename StackAllocator<TAllocator>::TCheckpoint
+    StackAllocator<TAllocator>
+    ::Checkpoint() const noexcept
+    {
+        auto checkpoint = TCheckpoint{};
+
+        checkpoint.chunk_ = chunk_;
+        checkpoint.head_ = head_;
+
+        return checkpoint;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void StackAllocator<TAllocator>
+    ::Rewind(Immutable<TCheckpoint> checkpoint) noexcept
+    {
+        // Deallocate chunks until the checkpoint chunk becomes the current
+        // one.
+
+        for (; chunk_ != checkpoint.chunk_;)
+        {
+            DeallocateChunk();
+        }
+
+        head_ = checkpoint.head_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator> StackAllocator<TAllocator>
+    ::GetAllocator() noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Immutable<TAllocator> StackAllocator<TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void StackAllocator<TAllocator>
+    ::Swap(Mutable<StackAllocator> rhs) noexcept
+    {
+        Algorithms::Swap(allocator_, rhs.allocator_);
+        Algorithms::Swap(granularity_, rhs.granularity_);
+        Algorithms::Swap(chunk_, rhs.chunk_);
+        Algorithms::Swap(head_, rhs.head_);
+        Algorithms::Swap(end_, rhs.end_);
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bool StackAllocator<TAllocator>
+    ::AllocateChunk(Bytes size, Alignment alignment) noexcept
+    {
+        // Padding the payload such that the block fits even in the worst
+        // alignment scenario.
+
+        auto chunk_alignment = Math::Max(alignment, AlignmentOf<Chunk>());
+
+        auto header_size = SizeOf<Chunk>();
+
+        auto payload_size = size + ToBytes(chunk_alignment) - Bytes{ 1 };
+
+        auto chunk_size = Math::Max(granularity_, header_size + payload_size);
+
+        auto storage = allocator_.Allocate(chunk_size, chunk_alignment);
+
+        if (!storage.GetData())
+        {
+            return false;
+        }
+
+        chunk_ = new (storage.GetData()) Chunk{ chunk_,
+                                                storage,
+                                                chunk_alignment };
+
+        head_ = storage.GetData() + header_size;
+        end_ = storage.GetData() + storage.GetCount();
+
+        return true;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void StackAllocator<TAllocator>
+    ::DeallocateChunk() noexcept
+    {
+        auto previous = chunk_->previous_;
+        auto self = chunk_->self_;
+        auto alignment = chunk_->alignment_;
+
+        allocator_.Deallocate(self, alignment);
+
+        chunk_ = previous;
+
+        if (chunk_)
+        {
+            end_ = chunk_->self_.GetData() + chunk_->self_.GetCount();
+        }
+        else
+        {
+            head_ = nullptr;
+            end_ = nullptr;
+        }
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,501 @@
+/// \file thread_caching_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include <bit>
+#include <new>
+
+#include "syntropy/math/math.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR :: CHUNK                                    */
+    /************************************************************************/
+
+    /// \brief Header of a chunk acquired from the backing allocator.
+    ///
+    /// Each chunk is laid out as a header followed by blocks of the same
+    /// size class.
+    struct ThreadCachingAllocator::Chunk
+    {
+        /// \brief Next chunk.
+        RWPtr<Chunk> next_{ nullptr };
+
+        /// \brief Memory span enclosing the chunk.
+        RWByteSpan self_;
+    };
+
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR :: CACHE TABLE                              */
+    /************************************************************************/
+
+    /// \brief Caches of a thread, for each allocator.
+    ///
+    /// A thread can bind a limited number of caches at once: allocators
+    /// exceeding this limit are served directly from shared free lists.
+    class ThreadCachingAllocator::CacheTable
+    {
+    public:
+
+        /// \brief Get the table of the calling thread.
+        [[nodiscard]] static Mutable<CacheTable>
+        GetInstance() noexcept
+        {
+            static thread_local auto cache_table = CacheTable{};
+
+            return cache_table;
+        }
+
+        /// \brief Get the mutex guarding the binding between caches and
+        ///        allocators of every thread.
+        [[nodiscard]] static Mutable<std::mutex>
+        GetMutex() noexcept
+        {
+            static auto mutex = std::mutex{};
+
+            return mutex;
+        }
+
+        /// \brief Default constructor.
+        CacheTable() noexcept = default;
+
+        /// \brief Return all blocks to their allocators.
+        ~CacheTable() noexcept
+        {
+            auto lock = std::lock_guard{ GetMutex() };
+
+            for (auto&& cache : caches_)
+            {
+                if (auto owner = cache.owner_.load())
+                {
+                    owner->Release(cache);
+
+                    Unbind(*owner, cache);
+                }
+            }
+        }
+
+        /// \brief Find the cache bound to an allocator.
+        /// If no such cache exists, returns nullptr.
+        [[nodiscard]] RWPtr<Cache>
+        Find(Immutable<ThreadCachingAllocator> owner) noexcept
+        {
+            for (auto&& cache : caches_)
+            {
+                if (cache.owner_.load(std::memory_order_relaxed)
+                    == PtrOf(owner))
+                {
+                    return PtrOf(cache);
+                }
+            }
+
+            return nullptr;
+        }
+
+        /// \brief Bind an unbound cache to an allocator.
+        /// If no cache is available, returns nullptr.
+        [[nodiscard]] RWPtr<Cache>
+        Bind(Mutable<ThreadCachingAllocator> owner) noexcept
+        {
+            auto lock = std::lock_guard{ GetMutex() };
+
+            for (auto&& cache : caches_)
+            {
+                if (!cache.owner_.load())
+                {
+                    // Free lists may still refer to blocks of a destroyed
+                    // allocator.
+
+                    for (auto&& free_list : cache.free_lists_)
+                    {
+                        free_list = {};
+                    }
+
+                    cache.previous_ = nullptr;
+                    cache.next_ = owner.caches_;
+
+                    if (owner.caches_)
+                    {
+                        owner.caches_->previous_ = PtrOf(cache);
+                    }
+
+                    owner.caches_ = PtrOf(cache);
+
+                    cache.owner_.store(PtrOf(owner));
+
+                    return PtrOf(cache);
+                }
+            }
+
+            return nullptr;
+        }
+
+        /// \brief Unbind a cache from its allocator.
+        ///
+        /// \remarks Must be called while holding the mutex returned by
+        ///          ::GetMutex().
+        static void
+        Unbind(Mutable<ThreadCachingAllocator> owner,
+               Mutable<Cache> cache) noexcept
+        {
+            if (cache.previous_)
+            {
+                cache.previous_->next_ = cache.next_;
+            }
+            else
+            {
+                owner.caches_ = cache.next_;
+            }
+
+            if (cache.next_)
+            {
+                cache.next_->previous_ = cache.previous_;
+            }
+
+            cache.next_ = nullptr;
+            cache.previous_ = nullptr;
+
+            cache.owner_.store(nullptr);
+        }
+
+    private:
+
+        /// \brief Maximum number of caches per thread.
+        static constexpr Int
+        kCacheCount = 8;
+
+        /// \brief Thread caches.
+        Cache caches_[kCacheCount];
+
+    };
+
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR                                             */
+    /************************************************************************/
+
+    inline ThreadCachingAllocator
+    ::ThreadCachingAllocator(Mutable<BaseAllocator> allocator) noexcept
+        : allocator_(PtrOf(allocator))
+    {
+
+    }
+
+    inline ThreadCachingAllocator
+    ::~ThreadCachingAllocator() noexcept
+    {
+        // Blocks cached by other threads are discarded along with their
+        // chunks.
+
+        {
+            auto lock = std::lock_guard{ CacheTable::GetMutex() };
+
+            for (; caches_;)
+            {
+                CacheTable::Unbind(*this, *caches_);
+            }
+        }
+
+        for (; chunks_;)
+        {
+            auto next = chunks_->next_;
+            auto self = chunks_->self_;
+
+            allocator_->Deallocate(self, ToAlignment(kCachedAlignment));
+
+            chunks_ = next;
+        }
+    }
+
+    [[nodiscard]] inline RWByteSpan ThreadCachingAllocator
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        auto size_value = ToInt(size);
+
+        if (size_value <= 0)
+        {
+            return {};
+        }
+
+        if ((size_value > kMaxCachedSize)
+            || (ToInt(alignment) > kCachedAlignment))
+        {
+            auto lock = std::lock_guard{ mutex_ };
+
+            return allocator_->Allocate(size, alignment);
+        }
+
+        auto size_class = ClassOf(size_value);
+
+        auto block = RWPtr<FreeBlock>{ nullptr };
+
+        if (auto cache = GetCache())
+        {
+            auto& free_list = cache->free_lists_[size_class];
+
+            if (!free_list.head_ && !Refill(free_list, size_class))
+            {
+                return {};
+            }
+
+            block = free_list.head_;
+
+            free_list.head_ = block->next_;
+            --free_list.count_;
+        }
+        else
+        {
+            auto lock = std::lock_guard{ mutex_ };
+
+            if (!free_lists_[size_class] && !Grow(size_class))
+            {
+                return {};
+            }
+
+            block = free_lists_[size_class];
+
+            free_lists_[size_class] = block->next_;
+        }
+
+        return { ToBytePtr(block), size };
+    }
+
+    inline void ThreadCachingAllocator
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        auto size_value = ToInt(block.GetCount());
+
+        if (!block.GetData())
+        {
+            return;
+        }
+
+        if ((size_value > kMaxCachedSize)
+            || (ToInt(alignment) > kCachedAlignment))
+        {
+            auto lock = std::lock_guard{ mutex_ };
+
+            allocator_->Deallocate(block, alignment);
+
+            return;
+        }
+
+        auto size_class = ClassOf(size_value);
+
+        auto free_block = new (block.GetData()) FreeBlock{};
+
+        if (auto cache = GetCache())
+        {
+            auto& free_list = cache->free_lists_[size_class];
+
+            free_block->next_ = free_list.head_;
+
+            free_list.head_ = free_block;
+            ++free_list.count_;
+
+            // Keeping a batch in the cache to avoid bouncing blocks between
+            // the cache and shared free lists.
+
+            auto batch = BatchOf(size_class);
+
+            if (free_list.count_ >= 2 * batch)
+            {
+                Release(free_list, size_class, batch);
+            }
+        }
+        else
+        {
+            auto lock = std::lock_guard{ mutex_ };
+
+            free_block->next_ = free_lists_[size_class];
+
+            free_lists_[size_class] = free_block;
+        }
+    }
+
+    inline void ThreadCachingAllocator
+    ::Flush() noexcept
+    {
+        if (auto cache = CacheTable::GetInstance().Find(*this))
+        {
+            Release(*cache);
+        }
+    }
+
+    [[nodiscard]] inline Mutable<BaseAllocator> ThreadCachingAllocator
+    ::GetAllocator() noexcept
+    {
+        return *allocator_;
+    }
+
+    [[nodiscard]] inline Int ThreadCachingAllocator
+    ::ClassOf(Int size) noexcept
+    {
+        // Classes are spaced by 16 bytes up to 128 bytes, then each power
+        // of two is divided in 4 classes.
+
+        if (size <= 128)
+        {
+            return (size - 1) / 16;
+        }
+
+        auto msb = static_cast<Int>(
+            std::bit_width(static_cast<std::uint64_t>(size - 1))) - 1;
+
+        return 8 + (msb - 7) * 4 + ((size - 1) >> (msb - 2)) - 4;
+    }
+
+    [[nodiscard]] inline Int ThreadCachingAllocator
+    ::ClassSize(Int size_class) noexcept
+    {
+        if (size_class < 8)
+        {
+            return (size_class + 1) * 16;
+        }
+
+        auto msb = 7 + (size_class - 8) / 4;
+        auto step = (size_class - 8) % 4;
+
+        return (5 + step) << (msb - 2);
+    }
+
+    [[nodiscard]] inline Int ThreadCachingAllocator
+    ::BatchOf(Int size_class) noexcept
+    {
+        auto batch = kBatchSize / ClassSize(size_class);
+
+        return Math::Min(Math::Max(batch, Int{ 2 }), Int{ 64 });
+    }
+
+    [[nodiscard]] inline RWPtr<ThreadCachingAllocator::Cache>
+    ThreadCachingAllocator
+    ::GetCache() noexcept
+    {
+        auto& cache_table = CacheTable::GetInstance();
+
+        if (auto cache = cache_table.Find(*this))
+        {
+            return cache;
+        }
+
+        return cache_table.Bind(*this);
+    }
+
+    [[nodiscard]] inline Bool ThreadCachingAllocator
+    ::Refill(Mutable<FreeList> free_list, Int size_class) noexcept
+    {
+        auto lock = std::lock_guard{ mutex_ };
+
+        if (!free_lists_[size_class] && !Grow(size_class))
+        {
+            return false;
+        }
+
+        auto batch = BatchOf(size_class);
+
+        for (; free_lists_[size_class] && (free_list.count_ < batch);)
+        {
+            auto block = free_lists_[size_class];
+
+            free_lists_[size_class] = block->next_;
+
+            block->next_ = free_list.head_;
+
+            free_list.head_ = block;
+            ++free_list.count_;
+        }
+
+        return true;
+    }
+
+    inline void ThreadCachingAllocator
+    ::Release(Mutable<FreeList> free_list,
+              Int size_class,
+              Int count) noexcept
+    {
+        if ((count <= 0) || !free_list.head_)
+        {
+            return;
+        }
+
+        // Detach the batch before locking.
+
+        auto head = free_list.head_;
+        auto tail = head;
+
+        for (auto index = Int{ 1 }; (index < count) && tail->next_; ++index)
+        {
+            tail = tail->next_;
+            --free_list.count_;
+        }
+
+        --free_list.count_;
+
+        free_list.head_ = tail->next_;
+
+        auto lock = std::lock_guard{ mutex_ };
+
+        tail->next_ = free_lists_[size_class];
+
+        free_lists_[size_class] = head;
+    }
+
+    inline void ThreadCachingAllocator
+    ::Release(Mutable<Cache> cache) noexcept
+    {
+        for (auto index = Int{ 0 }; index < kClassCount; ++index)
+        {
+            auto& free_list = cache.free_lists_[index];
+
+            Release(free_list, index, free_list.count_);
+        }
+    }
+
+    [[nodiscard]] inline Bool ThreadCachingAllocator
+    ::Grow(Int size_class) noexcept
+    {
+        auto header_size = Math::Ceil(ToInt(SizeOf<Chunk>()),
+                                      kCachedAlignment);
+
+        auto block_size = ClassSize(size_class);
+
+        auto chunk_size = header_size
+                        + Math::Max(kChunkSize,
+                                    BatchOf(size_class) * block_size);
+
+        auto storage = allocator_->Allocate(Bytes{ chunk_size },
+                                            ToAlignment(kCachedAlignment));
+
+        if (!storage.GetData())
+        {
+            return false;
+        }
+
+        chunks_ = new (storage.GetData()) Chunk{ chunks_, storage };
+
+        // Blocks are pushed in reverse order so that they are handed out
+        // in address order.
+
+        auto block_count = (chunk_size - header_size) / block_size;
+
+        auto blocks = storage.GetData() + header_size;
+
+        for (auto index = block_count - 1; index >= 0; --index)
+        {
+            auto block = new (blocks + index * block_size) FreeBlock{};
+
+            block->next_ = free_lists_[size_class];
+
+            free_lists_[size_class] = block;
+        }
+
+        return true;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,753 @@
+/// \file tlsf_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2016
+
+#pragma once
+
+#include <bit>
+#include <new>
+
+#include "syntropy/core/algorithms/swap.h"
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* TLSF ALLOCATOR <ALLOCATOR> :: BLOCK                                  */
+    /************************************************************************/
+
+    /// \brief Header of a memory block.
+    ///
+    /// Free-list links overlay the block payload and are meaningful only
+    /// while the block is free.
+    template <Templates::Allocator TAllocator>
+    struct TLSFAllocator<TAllocator>::Block
+    {
+        /// \brief Flag set on free blocks.
+        static constexpr Int
+        kFreeFlag = 1;
+
+        /// \brief Previous physical block in the same pool.
+        RWPtr<Block> previous_{ nullptr };
+
+        /// \brief Payload size, in bytes, combined with status flags.
+        Int size_{ 0 };
+
+        /// \brief Next block in the same free list.
+        RWPtr<Block> next_free_{ nullptr };
+
+        /// \brief Previous block in the same free list.
+        RWPtr<Block> previous_free_{ nullptr };
+
+        /// \brief Get the payload size, in bytes.
+        [[nodiscard]] Int
+        GetSize() const noexcept
+        {
+            return size_ & ~kFreeFlag;
+        }
+
+        /// \brief Set the payload size, in bytes, preserving status flags.
+        void
+        SetSize(Int size) noexcept
+        {
+            size_ = size | (size_ & kFreeFlag);
+        }
+
+        /// \brief Check whether the block is free.
+        [[nodiscard]] Bool
+        IsFree() const noexcept
+        {
+            return (size_ & kFreeFlag) != 0;
+        }
+
+        /// \brief Mark the block as either free or busy.
+        void
+        SetFree(Bool is_free) noexcept
+        {
+            size_ = is_free ? (size_ | kFreeFlag) : (size_ & ~kFreeFlag);
+        }
+    };
+
+    /************************************************************************/
+    /* TLSF ALLOCATOR <ALLOCATOR> :: POOL                                   */
+    /************************************************************************/
+
+    /// \brief Header of a memory pool.
+    ///
+    /// Each pool is laid out as a header, followed by a sequence of
+    /// physically-contiguous blocks, terminated by a zero-sized busy
+    /// sentinel block.
+    template <Templates::Allocator TAllocator>
+    struct TLSFAllocator<TAllocator>::Pool
+    {
+        /// \brief Next pool.
+        RWPtr<Pool> next_{ nullptr };
+
+        /// \brief Memory span enclosing the pool.
+        RWByteSpan self_;
+    };
+
+    /************************************************************************/
+    /* TLSF ALLOCATOR <ALLOCATOR> :: INDEX                                  */
+    /************************************************************************/
+
+    /// \brief Index of a free list.
+    template <Templates::Allocator TAllocator>
+    struct TLSFAllocator<TAllocator>::Index
+    {
+        /// \brief First-level index.
+        Int first_{ 0 };
+
+        /// \brief Second-level index.
+        Int second_{ 0 };
+    };
+
+    /************************************************************************/
+    /* TLSF ALLOCATOR <ALLOCATOR>                                           */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator>
+    template <typename... TArguments>
+    inline TLSFAllocator<TAllocator>
+    ::TLSFAllocator(Bytes pool_size,
+                    Forwarding<TArguments>... arguments) noexcept
+        : allocator_(Forward<TArguments>(arguments)...)
+        , pool_size_(pool_size)
+    {
+
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline TLSFAllocator<TAllocator>
+    ::TLSFAllocator(Movable<TLSFAllocator> rhs) noexcept
+        : allocator_(Move(rhs.allocator_))
+        , pool_size_(rhs.pool_size_)
+    {
+        // Blocks never refer to the allocator itself, therefore moving free
+        // lists heads is enough to transfer the ownership of each pool.
+
+        Algorithms::Swap(pools_, rhs.pools_);
+        Algorithms::Swap(first_bitmap_, rhs.first_bitmap_);
+        Algorithms::Swap(reserved_size_, rhs.reserved_size_);
+        Algorithms::Swap(allocated_size_, rhs.allocated_size_);
+        Algorithms::Swap(free_size_, rhs.free_size_);
+        Algorithms::Swap(free_count_, rhs.free_count_);
+
+        for (auto first = Int{ 0 }; first < kFirstLevelCount; ++first)
+        {
+            Algorithms::Swap(second_bitmaps_[first],
+                             rhs.second_bitmaps_[first]);
+
+            for (auto second = Int{ 0 }; second < kSecondLevelCount; ++second)
+            {
+                Algorithms::Swap(free_lists_[first][second],
+                                 rhs.free_lists_[first][second]);
+            }
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline TLSFAllocator<TAllocator>
+    ::~TLSFAllocator() noexcept
+    {
+        DeallocateAll();
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline Mutable<TLSFAllocator<TAllocator>> TLSFAllocator<TAllocator>
+    ::operator=(TLSFAllocator rhs) noexcept
+    {
+        Swap(rhs);
+
+        return *this;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] RWByteSpan TLSFAllocator<TAllocator>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        if (size <= Bytes{ 0 })
+        {
+            return {};
+        }
+
+        auto payload_size = Math::Max(Math::Ceil(ToInt(size), kGranularity),
+                                      kMinBlockSize);
+
+        auto payload_alignment = ToInt(alignment);
+
+        // Over-aligned blocks are searched with enough room to split a
+        // leading free block, whatever the alignment of the payload.
+
+        auto search_size = (payload_alignment > kGranularity)
+            ? (payload_size + payload_alignment + kBlockOverhead
+               + kMinBlockSize)
+            : payload_size;
+
+        if (search_size > kMaxBlockSize)
+        {
+            return {};                                  // Out of range.
+        }
+
+        auto block = SearchBlock(search_size);
+
+        if (!block && AllocatePool(search_size))
+        {
+            block = SearchBlock(search_size);
+        }
+
+        if (!block)
+        {
+            return {};                                  // Out of memory.
+        }
+
+        if (payload_alignment > kGranularity)
+        {
+            block = AlignBlock(block, payload_alignment);
+        }
+
+        SplitBlock(block, payload_size);
+
+        block->SetFree(false);
+
+        allocated_size_ += block->GetSize();
+
+        return { PayloadOf(block), size };
+    }
+
+    template <Templates::Allocator TAllocator>
+    void TLSFAllocator<TAllocator>
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment) noexcept
+    {
+        if (!block.GetData())
+        {
+            return;
+        }
+
+        auto free_block = BlockOf(block.GetData());
+
+        allocated_size_ -= free_block->GetSize();
+
+        // Coalesce with the previous physical block.
+
+        if (auto previous = free_block->previous_;
+            previous && previous->IsFree())
+        {
+            RemoveBlock(previous);
+
+            previous->SetSize(previous->GetSize()
+                              + kBlockOverhead
+                              + free_block->GetSize());
+
+            free_block = previous;
+
+            NextOf(free_block)->previous_ = free_block;
+        }
+
+        // Coalesce with the next physical block. The pool sentinel is
+        // always busy.
+
+        if (auto next = NextOf(free_block); next->IsFree())
+        {
+            RemoveBlock(next);
+
+            free_block->SetSize(free_block->GetSize()
+                                + kBlockOverhead
+                                + next->GetSize());
+
+            NextOf(free_block)->previous_ = free_block;
+        }
+
+        free_block->SetFree(true);
+
+        InsertBlock(free_block);
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] Bool TLSFAllocator<TAllocator>
+    ::Reallocate(Immutable<RWByteSpan> block,
+                 Bytes size,
+                 Alignment) noexcept
+    {
+        if (!block.GetData() || (size <= Bytes{ 0 }))
+        {
+            return false;
+        }
+
+        auto payload_size = Math::Max(Math::Ceil(ToInt(size), kGranularity),
+                                      kMinBlockSize);
+
+        auto busy_block = BlockOf(block.GetData());
+
+        auto busy_size = busy_block->GetSize();
+
+        // Absorb the next physical block, if free: the exceeding part is
+        // split back afterwards. This also prevents a trailing remainder
+        // from being adjacent to another free block.
+
+        if (auto next = NextOf(busy_block); next->IsFree())
+        {
+            RemoveBlock(next);
+
+            busy_block->SetSize(busy_size + kBlockOverhead + next->GetSize());
+
+            NextOf(busy_block)->previous_ = busy_block;
+        }
+
+        auto fits = (busy_block->GetSize() >= payload_size);
+
+        SplitBlock(busy_block, fits ? payload_size : busy_size);
+
+        allocated_size_ += busy_block->GetSize() - busy_size;
+
+        return fits;
+    }
+
+    template <Templates::Allocator TAllocator>
+    void TLSFAllocator<TAllocator>
+    ::DeallocateAll() noexcept
+    {
+        for (; pools_;)
+        {
+            auto next = pools_->next_;
+            auto self = pools_->self_;
+
+            allocator_.Deallocate(self, ToAlignment(kGranularity));
+
+            pools_ = next;
+        }
+
+        first_bitmap_ = 0;
+
+        for (auto first = Int{ 0 }; first < kFirstLevelCount; ++first)
+        {
+            second_bitmaps_[first] = 0;
+
+            for (auto second = Int{ 0 }; second < kSecondLevelCount; ++second)
+            {
+                free_lists_[first][second] = nullptr;
+            }
+        }
+
+        reserved_size_ = 0;
+        allocated_size_ = 0;
+        free_size_ = 0;
+        free_count_ = 0;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] Bool TLSFAllocator<TAllocator>
+    ::Owns(Immutable<ByteSpan> block) const noexcept
+    {
+        for (auto pool = pools_; pool; pool = pool->next_)
+        {
+            auto begin = pool->self_.GetData();
+            auto end = begin + pool->self_.GetCount();
+
+            if ((block.GetData() >= begin) &&
+                (block.GetData() + block.GetCount() <= end))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] typename TLSFAllocator<TAllocator>::TStatistics
+    TLSFAllocator<TAllocator>
+    ::GetStatistics() const noexcept
+    {
+        auto statistics = TStatistics{};
+
+        statistics.reserved_size_ = Bytes{ reserved_size_ };
+        statistics.allocated_size_ = Bytes{ allocated_size_ };
+        statistics.free_size_ = Bytes{ free_size_ };
+        statistics.free_count_ = free_count_;
+
+        // The largest free block belongs to the largest non-empty list.
+
+        if (first_bitmap_)
+        {
+            auto first_bitmap = static_cast<std::uint64_t>(first_bitmap_);
+
+            auto first = static_cast<Int>(std::bit_width(first_bitmap)) - 1;
+
+            auto second_bitmap
+                = static_cast<std::uint64_t>(second_bitmaps_[first]);
+
+            auto second = static_cast<Int>(std::bit_width(second_bitmap)) - 1;
+
+            auto largest_size = Int{ 0 };
+
+            for (auto block = free_lists_[first][second];
+                 block;
+                 block = block->next_free_)
+            {
+                largest_size = Math::Max(largest_size, block->GetSize());
+            }
+
+            statistics.largest_free_size_ = Bytes{ largest_size };
+
+            statistics.fragmentation_
+                = 1.0f - ToFloat(largest_size) / ToFloat(free_size_);
+        }
+
+        return statistics;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator> TLSFAllocator<TAllocator>
+    ::GetAllocator() noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Immutable<TAllocator> TLSFAllocator<TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void TLSFAllocator<TAllocator>
+    ::Swap(Mutable<TLSFAllocator> rhs) noexcept
+    {
+        Algorithms::Swap(allocator_, rhs.allocator_);
+        Algorithms::Swap(pool_size_, rhs.pool_size_);
+        Algorithms::Swap(pools_, rhs.pools_);
+        Algorithms::Swap(first_bitmap_, rhs.first_bitmap_);
+        Algorithms::Swap(reserved_size_, rhs.reserved_size_);
+        Algorithms::Swap(allocated_size_, rhs.allocated_size_);
+        Algorithms::Swap(free_size_, rhs.free_size_);
+        Algorithms::Swap(free_count_, rhs.free_count_);
+
+        for (auto first = Int{ 0 }; first < kFirstLevelCount; ++first)
+        {
+            Algorithms::Swap(second_bitmaps_[first],
+                             rhs.second_bitmaps_[first]);
+
+            for (auto second = Int{ 0 }; second < kSecondLevelCount; ++second)
+            {
+                Algorithms::Swap(free_lists_[first][second],
+                                 rhs.free_lists_[first][second]);
+            }
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline typename TLSFAllocator<TAllocator>::Index
+    TLSFAllocator<TAllocator>
+    ::MapInsert(Int size) noexcept
+    {
+        // Small blocks are indexed linearly, larger blocks are indexed by
+        // their most-significant bit first and linearly afterwards.
+
+        if (size < kSmallBlockSize)
+        {
+            return { 0, size >> kGranularityBits };
+        }
+
+        auto msb = static_cast<Int>(
+            std::bit_width(static_cast<std::uint64_t>(size))) - 1;
+
+        auto first = msb - (kSecondLevelBits + kGranularityBits) + 1;
+        auto second = (size >> (msb - kSecondLevelBits)) - kSecondLevelCount;
+
+        return { first, second };
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Int TLSFAllocator<TAllocator>
+    ::MapRound(Int size) noexcept
+    {
+        if (size < kSmallBlockSize)
+        {
+            return size;
+        }
+
+        auto msb = static_cast<Int>(
+            std::bit_width(static_cast<std::uint64_t>(size))) - 1;
+
+        return Math::Ceil(size, Int{ 1 } << (msb - kSecondLevelBits));
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWBytePtr TLSFAllocator<TAllocator>
+    ::PayloadOf(RWPtr<Block> block) noexcept
+    {
+        return ToBytePtr(block) + kBlockOverhead;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWPtr<typename TLSFAllocator<TAllocator>::Block>
+    TLSFAllocator<TAllocator>
+    ::BlockOf(RWBytePtr payload) noexcept
+    {
+        return FromBytePtr<Block>(payload - kBlockOverhead);
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWPtr<typename TLSFAllocator<TAllocator>::Block>
+    TLSFAllocator<TAllocator>
+    ::NextOf(RWPtr<Block> block) noexcept
+    {
+        return FromBytePtr<Block>(PayloadOf(block) + block->GetSize());
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWPtr<typename TLSFAllocator<TAllocator>::Block>
+    TLSFAllocator<TAllocator>
+    ::MakeBlock(RWBytePtr address, RWPtr<Block> previous, Int size) noexcept
+    {
+        // Free-list links are not initialized, since they may exceed the
+        // storage available to zero-sized sentinel blocks.
+
+        auto block = FromBytePtr<Block>(address);
+
+        block->previous_ = previous;
+        block->size_ = size;
+
+        return block;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] RWPtr<typename TLSFAllocator<TAllocator>::Block>
+    TLSFAllocator<TAllocator>
+    ::SearchBlock(Int size) noexcept
+    {
+        // Rounding up guarantees that any block in the list fits, hence
+        // the head can be taken without walking the list.
+
+        auto [first, second] = MapInsert(MapRound(size));
+
+        if (first >= kFirstLevelCount)
+        {
+            return nullptr;
+        }
+
+        auto second_bitmap = second_bitmaps_[first] & (~Int{ 0 } << second);
+
+        if (!second_bitmap)
+        {
+            // Search the next non-empty first-level list.
+
+            auto first_bitmap = (first + 1 < kFirstLevelCount)
+                ? (first_bitmap_ & (~Int{ 0 } << (first + 1)))
+                : Int{ 0 };
+
+            if (!first_bitmap)
+            {
+                return nullptr;
+            }
+
+            first = std::countr_zero(
+                static_cast<std::uint64_t>(first_bitmap));
+
+            second_bitmap = second_bitmaps_[first];
+        }
+
+        second = std::countr_zero(static_cast<std::uint64_t>(second_bitmap));
+
+        auto block = free_lists_[first][second];
+
+        RemoveBlock(block);
+
+        return block;
+    }
+
+    template <Templates::Allocator TAllocator>
+    void TLSFAllocator<TAllocator>
+    ::InsertBlock(RWPtr<Block> block) noexcept
+    {
+        auto [first, second] = MapInsert(block->GetSize());
+
+        SYNTROPY_ASSERT(first < kFirstLevelCount);
+
+        auto& head = free_lists_[first][second];
+
+        block->next_free_ = head;
+        block->previous_free_ = nullptr;
+
+        if (head)
+        {
+            head->previous_free_ = block;
+        }
+
+        head = block;
+
+        first_bitmap_ |= (Int{ 1 } << first);
+        second_bitmaps_[first] |= (Int{ 1 } << second);
+
+        free_size_ += block->GetSize();
+        ++free_count_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    void TLSFAllocator<TAllocator>
+    ::RemoveBlock(RWPtr<Block> block) noexcept
+    {
+        auto [first, second] = MapInsert(block->GetSize());
+
+        auto& head = free_lists_[first][second];
+
+        if (block->previous_free_)
+        {
+            block->previous_free_->next_free_ = block->next_free_;
+        }
+
+        if (block->next_free_)
+        {
+            block->next_free_->previous_free_ = block->previous_free_;
+        }
+
+        if (head == block)
+        {
+            head = block->next_free_;
+        }
+
+        if (!head)
+        {
+            second_bitmaps_[first] &= ~(Int{ 1 } << second);
+
+            if (!second_bitmaps_[first])
+            {
+                first_bitmap_ &= ~(Int{ 1 } << first);
+            }
+        }
+
+        block->next_free_ = nullptr;
+        block->previous_free_ = nullptr;
+
+        free_size_ -= block->GetSize();
+        --free_count_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    void TLSFAllocator<TAllocator>
+    ::SplitBlock(RWPtr<Block> block, Int size) noexcept
+    {
+        // The remainder is split only if it is large enough to be a block
+        // on its own. Physical neighbors of a free block are never free,
+        // therefore the remainder needs no coalescing.
+
+        auto remainder_size = block->GetSize() - size - kBlockOverhead;
+
+        if (remainder_size >= kMinBlockSize)
+        {
+            auto next = NextOf(block);
+
+            block->SetSize(size);
+
+            auto remainder = MakeBlock(PayloadOf(block) + size,
+                                       block,
+                                       remainder_size);
+
+            next->previous_ = remainder;
+
+            remainder->SetFree(true);
+
+            InsertBlock(remainder);
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] RWPtr<typename TLSFAllocator<TAllocator>::Block>
+    TLSFAllocator<TAllocator>
+    ::AlignBlock(RWPtr<Block> block, Int alignment) noexcept
+    {
+        auto payload = PayloadOf(block);
+
+        auto aligned = Align(payload, ToAlignment(alignment));
+
+        // A non-empty gap must be large enough to host a free block.
+
+        if ((aligned != payload) &&
+            (aligned - payload < kBlockOverhead + kMinBlockSize))
+        {
+            aligned = Align(payload + kBlockOverhead + kMinBlockSize,
+                            ToAlignment(alignment));
+        }
+
+        if (auto gap = Int{ aligned - payload }; gap > 0)
+        {
+            auto next = NextOf(block);
+
+            auto aligned_block = MakeBlock(aligned - kBlockOverhead,
+                                           block,
+                                           block->GetSize() - gap);
+
+            next->previous_ = aligned_block;
+
+            block->SetSize(gap - kBlockOverhead);
+            block->SetFree(true);
+
+            InsertBlock(block);
+
+            return aligned_block;
+        }
+
+        return block;
+    }
+
+    template <Templates::Allocator TAllocator>
+    Bool TLSFAllocator<TAllocator>
+    ::AllocatePool(Int size) noexcept
+    {
+        auto header_size = Math::Ceil(ToInt(SizeOf<Pool>()), kGranularity);
+
+        auto block_size = MapRound(size);
+
+        auto pool_size = Math::Max(
+            Math::Ceil(ToInt(pool_size_), kGranularity),
+            header_size + block_size + 2 * kBlockOverhead);
+
+        // Larger pools would exceed the first-level index.
+
+        pool_size = Math::Min(pool_size,
+                              header_size + kMaxBlockSize + 2 * kBlockOverhead);
+
+        auto storage = allocator_.Allocate(Bytes{ pool_size },
+                                           ToAlignment(kGranularity));
+
+        if (!storage.GetData())
+        {
+            return false;
+        }
+
+        auto pool = new (storage.GetData()) Pool{ pools_, storage };
+
+        pools_ = pool;
+
+        // Single free block spanning the entire pool, followed by a busy
+        // sentinel which prevents coalescing past the end of the pool.
+
+        auto block = MakeBlock(storage.GetData() + header_size,
+                               nullptr,
+                               pool_size - header_size - 2 * kBlockOverhead);
+
+        auto sentinel = MakeBlock(PayloadOf(block) + block->GetSize(),
+                                  block,
+                                  0);
+
+        sentinel->SetFree(false);
+
+        block->SetFree(true);
+
+        InsertBlock(block);
+
+        reserved_size_ += pool_size;
+
+        return true;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,176 @@
+/// \file tracing_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* TRACING ALLOCATOR <ALLOCATOR>                                        */
+    /************************************************************************/
+
+    template <Templates::Allocator TAllocator>
+    template <typename... TArguments>
+    inline TracingAllocator<TAllocator>
+    ::TracingAllocator(Ptr<char> path,
+                       Forwarding<TArguments>... arguments) noexcept
+        : allocator_(Forward<TArguments>(arguments)...)
+        , file_(std::fopen(path, "wb"))
+        , origin_(std::chrono::steady_clock::now())
+    {
+        auto header = AllocationTraceHeader{};
+
+        if (file_ && (std::fwrite(&header, sizeof(header), 1, file_) != 1))
+        {
+            std::fclose(file_);
+
+            file_ = nullptr;
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline TracingAllocator<TAllocator>
+    ::~TracingAllocator() noexcept
+    {
+        if (file_)
+        {
+            Write();
+
+            std::fclose(file_);
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline RWByteSpan TracingAllocator<TAllocator>
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        auto lock = std::lock_guard<std::mutex>(mutex_);
+
+        auto block = allocator_.Allocate(size, alignment);
+
+        if (block)
+        {
+            Record(AllocationEventKind::kAllocate, block, alignment);
+        }
+
+        return block;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void TracingAllocator<TAllocator>
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept
+    {
+        auto lock = std::lock_guard<std::mutex>(mutex_);
+
+        Record(AllocationEventKind::kDeallocate, block, alignment);
+
+        allocator_.Deallocate(block, alignment);
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void TracingAllocator<TAllocator>
+    ::Flush() noexcept
+    {
+        auto lock = std::lock_guard<std::mutex>(mutex_);
+
+        if (file_)
+        {
+            Write();
+
+            std::fflush(file_);
+        }
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Bool TracingAllocator<TAllocator>
+    ::IsTracing() const noexcept
+    {
+        return file_ != nullptr;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Mutable<TAllocator> TracingAllocator<TAllocator>
+    ::GetAllocator() noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Immutable<TAllocator> TracingAllocator<TAllocator>
+    ::GetAllocator() const noexcept
+    {
+        return allocator_;
+    }
+
+    template <Templates::Allocator TAllocator>
+    [[nodiscard]] inline Int TracingAllocator<TAllocator>
+    ::GetThreadIndex() noexcept
+    {
+        static auto thread_count = std::atomic<Int>{ 0 };
+
+        static thread_local auto thread_index
+            = thread_count.fetch_add(1, std::memory_order_relaxed);
+
+        return thread_index;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void TracingAllocator<TAllocator>
+    ::Record(AllocationEventKind kind,
+             Immutable<RWByteSpan> block,
+             Alignment alignment) noexcept
+    {
+        if (!file_)
+        {
+            return;
+        }
+
+        if (event_count_ == kBufferCount)
+        {
+            Write();
+        }
+
+        auto elapsed = std::chrono::steady_clock::now() - origin_;
+
+        auto alignment_value = static_cast<std::uint64_t>(ToInt(alignment));
+
+        auto& event = events_[event_count_++];
+
+        event.timestamp_ = std::chrono::duration_cast<
+            std::chrono::nanoseconds>(elapsed).count();
+
+        event.address_ = reinterpret_cast<Int>(block.GetData());
+        event.size_ = ToInt(block.GetCount());
+        event.thread_ = ToFix32(GetThreadIndex());
+        event.alignment_ = ToFix8(std::countr_zero(alignment_value));
+        event.kind_ = kind;
+    }
+
+    template <Templates::Allocator TAllocator>
+    inline void TracingAllocator<TAllocator>
+    ::Write() noexcept
+    {
+        auto count = static_cast<std::size_t>(event_count_);
+
+        if (std::fwrite(events_, sizeof(AllocationEvent), count, file_)
+            != count)
+        {
+            // Stop tracing rather than leaving a gap in the trace.
+
+            std::fclose(file_);
+
+            file_ = nullptr;
+        }
+
+        event_count_ = 0;
+    }
+
+}
+
+// ===========================================================================
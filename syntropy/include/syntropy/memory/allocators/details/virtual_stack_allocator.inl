@@ -0,0 +1,216 @@
+/// \file virtual_stack_allocator.inl
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include "syntropy/core/algorithms/swap.h"
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* VIRTUAL STACK ALLOCATOR                                              */
+    /************************************************************************/
+
+    inline VirtualStackAllocator
+    ::VirtualStackAllocator(Bytes capacity,
+                            Bytes granularity,
+                            VirtualMemory::CommitMode mode) noexcept
+        : buffer_(VirtualMemory::Ceil(capacity))
+        , head_(buffer_.GetData())
+        , commit_head_(buffer_.GetData())
+        , granularity_(VirtualMemory::Ceil(granularity))
+        , mode_(mode)
+    {
+
+    }
+
+    inline VirtualStackAllocator
+    ::VirtualStackAllocator(Movable<VirtualStackAllocator> rhs) noexcept
+        : granularity_(rhs.granularity_)
+        , mode_(rhs.mode_)
+    {
+        Algorithms::Swap(buffer_, rhs.buffer_);
+        Algorithms::Swap(head_, rhs.head_);
+        Algorithms::Swap(commit_head_, rhs.commit_head_);
+    }
+
+    inline Mutable<VirtualStackAllocator> VirtualStackAllocator
+    ::operator=(VirtualStackAllocator rhs) noexcept
+    {
+        Swap(rhs);
+
+        return *this;
+    }
+
+    [[nodiscard]] inline RWByteSpan VirtualStackAllocator
+    ::Allocate(Bytes size, Alignment alignment) noexcept
+    {
+        auto end = buffer_.GetData() + buffer_.GetCount();
+
+        auto block_begin = Align(head_, alignment);
+        auto block_end = block_begin + size;
+
+        if ((block_begin > end) || (block_end > end))
+        {
+            return {};
+        }
+
+        if (!CommitUpTo(block_end))
+        {
+            return {};
+        }
+
+        head_ = block_end;
+
+        return { block_begin, block_end };
+    }
+
+    [[nodiscard]] inline RWByteSpan VirtualStackAllocator
+    ::Reserve(Bytes size, Alignment alignment) noexcept
+    {
+        // Reserved blocks span entire pages to avoid interferences with
+        // adjacent blocks when committing\decommitting.
+
+        auto end = buffer_.GetData() + buffer_.GetCount();
+
+        auto block_begin = Align(head_, VirtualMemory::Ceil(alignment));
+        auto block_end = block_begin + VirtualMemory::Ceil(size);
+
+        if ((block_begin > end) || (block_end > end))
+        {
+            return {};
+        }
+
+        // The commit head is left untouched: reserved pages are committed
+        // by the caller, not by the allocator.
+
+        head_ = block_end;
+
+        return { block_begin, size };
+    }
+
+    inline void VirtualStackAllocator
+    ::Deallocate(Immutable<RWByteSpan> block, Alignment) noexcept
+    {
+        SYNTROPY_UNDEFINED_BEHAVIOR(Owns(block),
+            "The provided block doesn't belong to this allocator instance.");
+    }
+
+    [[nodiscard]] inline Bool VirtualStackAllocator
+    ::Reallocate(Immutable<RWByteSpan> block,
+                 Bytes size,
+                 Alignment) noexcept
+    {
+        auto end = buffer_.GetData() + buffer_.GetCount();
+
+        auto block_end = block.GetData() + block.GetCount();
+        auto new_end = block.GetData() + size;
+
+        if ((block_end != head_) || (new_end > end) || !CommitUpTo(new_end))
+        {
+            return false;
+        }
+
+        head_ = new_end;
+
+        return true;
+    }
+
+    inline void VirtualStackAllocator
+    ::DeallocateAll() noexcept
+    {
+        auto checkpoint = TCheckpoint{};
+
+        checkpoint.head_ = buffer_.GetData();
+        checkpoint.commit_head_ = buffer_.GetData();
+
+        Rewind(checkpoint);
+    }
+
+    [[nodiscard]] inline Bool VirtualStackAllocator
+    ::Owns(Immutable<ByteSpan> block) const noexcept
+    {
+        return (block.GetData() >= buffer_.GetData())
+            && (block.GetData() + block.GetCount() <= head_);
+    }
+
+    [[nodiscard]] inline VirtualStackAllocator::TCheckpoint
+    VirtualStackAllocator
+    ::Checkpoint() const noexcept
+    {
+        auto checkpoint = TCheckpoint{};
+
+        checkpoint.head_ = head_;
+        checkpoint.commit_head_ = commit_head_;
+
+        return checkpoint;
+    }
+
+    inline void VirtualStackAllocator
+    ::Rewind(Immutable<TCheckpoint> checkpoint) noexcept
+    {
+        auto decommit_span = RWByteSpan{ checkpoint.commit_head_,
+                                         commit_head_ };
+
+        VirtualMemory::Decommit(decommit_span);                 // Kernel call.
+
+        head_ = checkpoint.head_;
+        commit_head_ = checkpoint.commit_head_;
+    }
+
+    inline void VirtualStackAllocator
+    ::Swap(Mutable<VirtualStackAllocator> rhs) noexcept
+    {
+        Algorithms::Swap(buffer_, rhs.buffer_);
+        Algorithms::Swap(head_, rhs.head_);
+        Algorithms::Swap(commit_head_, rhs.commit_head_);
+        Algorithms::Swap(granularity_, rhs.granularity_);
+        Algorithms::Swap(mode_, rhs.mode_);
+    }
+
+    [[nodiscard]] inline Bool VirtualStackAllocator
+    ::CommitUpTo(RWBytePtr end) noexcept
+    {
+        if (end <= commit_head_)
+        {
+            return true;
+        }
+
+        // Pages between the commit head and the current head belong to
+        // reserved blocks and are never committed by the allocator.
+
+        auto commit_begin = Math::Max(
+            commit_head_,
+            AlignDown(head_, VirtualMemory::GetPageAlignment()));
+
+        // Committing at higher granularity to reduce kernel calls.
+
+        auto buffer_end = buffer_.GetData() + buffer_.GetCount();
+
+        auto commit_size = Math::Ceil(Bytes{ end - commit_begin },
+                                      granularity_);
+
+        auto commit_end = Math::Min(commit_begin + commit_size, buffer_end);
+
+        auto commit_span = RWByteSpan{ commit_begin, commit_end };
+
+        if (!VirtualMemory::Commit(commit_span, mode_))         // Kernel call.
+        {
+            return false;
+        }
+
+        commit_head_ = commit_end;
+
+        return true;
+    }
+
+}
+
+// ===========================================================================
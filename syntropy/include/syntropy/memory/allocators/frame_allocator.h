@@ -0,0 +1,212 @@
+/// \file frame_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for multi-buffered frame allocators.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* FRAME RELEASE POLICY                                                 */
+    /************************************************************************/
+
+    /// \brief Frame allocator policy for release builds.
+    ///
+    /// Deallocation does nothing and retired frames are left untouched.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    struct FrameReleasePolicy
+    {
+        /// \brief Whether deallocations and retired frames are checked.
+        static constexpr Bool kIsChecked = false;
+    };
+
+    /************************************************************************/
+    /* FRAME CHECKED POLICY                                                 */
+    /************************************************************************/
+
+    /// \brief Frame allocator policy for debug builds.
+    ///
+    /// Deallocating a block of a retired frame is reported as undefined
+    /// behavior and retired frames are filled with a pattern, to expose
+    /// dangling references. Both checks run in time proportional to the
+    /// memory used by each frame.
+    ///
+    /// \author Raffaele D. Facendola - May 2021.
+    struct FrameCheckedPolicy
+    {
+        /// \brief Whether deallocations and retired frames are checked.
+        static constexpr Bool kIsChecked = true;
+
+        /// \brief Pattern retired frames are filled with.
+        static constexpr Byte
+        kRetiredPattern = Byte{ static_cast<std::int8_t>(0xDD) };
+    };
+
+    /************************************************************************/
+    /* FRAME ALLOCATOR <ALLOCATOR, COUNT, POLICY>                           */
+    /************************************************************************/
+
+    /// \brief Tier 1 allocator for transient data whose lifetime spans a
+    ///        fixed number of frames.
+    ///
+    /// The allocator keeps a ring of TCount arenas: each frame allocates
+    /// sequentially on its own arena, which is reset all at once when the
+    /// frame is retired, TCount frames later. Pointer-level deallocation
+    /// is not supported.
+    ///
+    /// Arenas keep the chunks they requested to the underlying allocator
+    /// across frames: after a few frames no further chunk is requested.
+    ///
+    /// The policy determines whether deallocations and retired frames are
+    /// checked: see FrameReleasePolicy and FrameCheckedPolicy.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    template <Templates::Allocator TAllocator,
+              Int TCount = 2,
+              typename TPolicy = FrameReleasePolicy>
+    class FrameAllocator
+    {
+        static_assert(TCount > 0, "At least one frame is required.");
+
+    public:
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param granularity Minimum size of each chunk requested to the
+        ///                    underlying allocator.
+        /// \param arguments Arguments used to construct the underlying
+        ///                  allocator.
+        template <typename... TArguments>
+        FrameAllocator(Bytes granularity,
+                       Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief No copy constructor.
+        FrameAllocator(Immutable<FrameAllocator>) = delete;
+
+        /// \brief Destructor.
+        ~FrameAllocator() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<FrameAllocator>
+        operator=(Immutable<FrameAllocator>) = delete;
+
+        /// \brief Allocate a new memory block on the current frame.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// Pointer-level deallocation is not supported: this method does
+        /// nothing, unless the policy checks the block belongs to a frame
+        /// which was not retired yet.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment) during a frame which was not
+        ///          retired yet.
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Start a new frame, retiring the oldest one.
+        ///
+        /// Blocks allocated during the retired frame are reclaimed all at
+        /// once.
+        ///
+        /// \return Returns the epoch of the new frame.
+        Int
+        AdvanceFrame() noexcept;
+
+        /// \brief Get the epoch of the current frame.
+        [[nodiscard]] Int
+        GetEpoch() const noexcept;
+
+        /// \brief Check whether memory allocated during a frame is still
+        ///        valid.
+        [[nodiscard]] Bool
+        IsAlive(Int epoch) const noexcept;
+
+        /// \brief Deallocate every allocation performed on this allocator
+        ///        so far, returning all chunks to the underlying allocator.
+        void
+        DeallocateAll() noexcept;
+
+        /// \brief Check whether this allocator owns a memory block.
+        ///
+        /// \remarks This method runs in time proportional to the number of
+        ///          chunks.
+        [[nodiscard]] Bool
+        Owns(Immutable<ByteSpan> block) const noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief A chunk in the allocation chain of an arena.
+        struct Chunk;
+
+        /// \brief The arena of a frame.
+        struct Arena;
+
+        /// \brief Move to the next chunk in an arena, large enough to fit a
+        ///        block of given size and alignment.
+        [[nodiscard]] Bool
+        NextChunk(Mutable<Arena> arena,
+                  Bytes size,
+                  Alignment alignment) noexcept;
+
+        /// \brief Reset an arena, retaining its chunks.
+        ///
+        /// If the policy is checked, the memory used by the arena is
+        /// filled with the retired pattern.
+        void
+        ResetArena(Mutable<Arena> arena) noexcept;
+
+        /// \brief Check whether a block was allocated on an arena and the
+        ///        arena wasn't reset since.
+        [[nodiscard]] Bool
+        IsAllocated(Immutable<Arena> arena,
+                    Immutable<ByteSpan> block) const noexcept;
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Minimum size of each chunk.
+        Bytes granularity_;
+
+        /// \brief Epoch of the current frame.
+        Int epoch_{ 0 };
+
+        /// \brief Frame arenas, indexed by epoch modulo TCount.
+        Arena arenas_[TCount];
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/frame_allocator.inl"
+
+// ===========================================================================
@@ -0,0 +1,274 @@
+/// \file instrumenting_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for allocators gathering per-call-site
+///        statistics on other allocators.
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include <atomic>
+
+#include "syntropy/language/foundation/foundation.h"
+#include "syntropy/language/preprocessor/macro.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+#include "syntropy/diagnostics/foundation/source_location.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* MACROS                                                               */
+    /************************************************************************/
+
+    /// \brief Expands to a declaration which attributes allocations
+    ///        performed by the current thread in the current scope to the
+    ///        current line of code.
+    ///
+    /// \remarks This macro can appear at most once per scope.
+    #define SYNTROPY_ALLOCATION_SITE \
+        SYNTROPY_MACRO_DECLARATION(empty)
+
+    /************************************************************************/
+    /* ALLOCATION SITE                                                      */
+    /************************************************************************/
+
+    /// \brief Represents a RAII guard used to attribute allocations
+    ///        performed by the current thread to a source code location,
+    ///        restoring the previous one upon destruction.
+    ///
+    /// Allocation sites can be nested but overlapping results in
+    /// undefined behavior.
+    ///
+    /// \author Raffaele D. Facendola - September 2020
+    class AllocationSite
+    {
+    public:
+
+        /// \brief Get the allocation site of the current thread.
+        /// If no site is active, returns nullptr.
+        [[nodiscard]] static Ptr<Diagnostics::SourceLocation>
+        GetCurrent() noexcept;
+
+        /// \brief Set a new allocation site for the current scope.
+        ///
+        /// \remarks The provided location is identified by its address,
+        ///          therefore it must outlive every allocator recording it.
+        AllocationSite(Immutable<Diagnostics::SourceLocation> site) noexcept;
+
+        /// \brief No copy constructor.
+        AllocationSite(Immutable<AllocationSite>) = delete;
+
+        /// \brief Restore the previous allocation site.
+        ~AllocationSite() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<AllocationSite>
+        operator=(Immutable<AllocationSite>) = delete;
+
+    private:
+
+        /// \brief Access the allocation site of the current thread.
+        [[nodiscard]] static Mutable<Ptr<Diagnostics::SourceLocation>>
+        GetSite() noexcept;
+
+        /// \brief Allocation site active before this one.
+        Ptr<Diagnostics::SourceLocation> previous_site_{ nullptr };
+
+    };
+
+    /************************************************************************/
+    /* INSTRUMENTING ALLOCATOR <ALLOCATOR>                                  */
+    /************************************************************************/
+
+    /// \brief Tier Omega allocator used to gather per-call-site statistics
+    ///        on allocations performed on another allocator.
+    ///
+    /// Each allocation is attributed to the active allocation site of the
+    /// calling thread (see AllocationSite) and is prefixed by a small
+    /// header recording it, so that deallocations are attributed to the
+    /// same site regardless of the thread performing them.
+    ///
+    /// Statistics are recorded on per-thread tables without contention
+    /// and merged on demand by ::Snapshot(function).
+    ///
+    /// \author Raffaele D. Facendola - September 2020
+    template <Templates::Allocator TAllocator>
+    class InstrumentingAllocator
+    {
+    public:
+
+        /// \brief Statistics of a single allocation site.
+        struct TSiteStatistics;
+
+        /// \brief Maximum number of distinct sites tracked. Allocations
+        ///        performed on additional sites are attributed to the
+        ///        unknown site.
+        static constexpr Int
+        kSiteCount = 256;
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param arguments Arguments used to construct the underlying
+        ///                  allocator.
+        template <typename... TArguments>
+        InstrumentingAllocator(Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief No copy constructor.
+        InstrumentingAllocator(Immutable<InstrumentingAllocator>) = delete;
+
+        /// \brief Destructor.
+        ~InstrumentingAllocator() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<InstrumentingAllocator>
+        operator=(Immutable<InstrumentingAllocator>) = delete;
+
+        /// \brief Allocate a new memory block on behalf of the active
+        ///        allocation site.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Allocate a new memory block on behalf of an explicit
+        ///        allocation site.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size,
+                 Alignment alignment,
+                 Immutable<Diagnostics::SourceLocation> site) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Merge statistics recorded so far by every thread and
+        ///        invoke a function for each allocation site.
+        ///
+        /// The function is called with an Immutable<TSiteStatistics>
+        /// argument. Sites without any allocation are skipped.
+        ///
+        /// \remarks The merging table is allocated on the underlying
+        ///          allocator. If it could not be allocated, the function
+        ///          is never called.
+        template <typename TFunction>
+        void
+        Snapshot(Forwarding<TFunction> function) noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief Header preceding each allocated block.
+        struct Header;
+
+        /// \brief A table of per-site statistics.
+        struct Table;
+
+        /// \brief Statistics recorded by threads mapped to the same slot.
+        struct Record;
+
+        /// \brief Number of records.
+        static constexpr Int
+        kRecordCount = 64;
+
+        /// \brief Get the index of the calling thread.
+        [[nodiscard]] static Int
+        GetThreadIndex() noexcept;
+
+        /// \brief Allocate a new memory block on behalf of an allocation
+        ///        site, which may be nullptr.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size,
+                 Alignment alignment,
+                 Ptr<Diagnostics::SourceLocation> site) noexcept;
+
+        /// \brief Get the size of the prefix preceding a block.
+        [[nodiscard]] static Int
+        GetPrefixSize(Alignment alignment) noexcept;
+
+        /// \brief Acquire the record of the calling thread exclusively.
+        /// If the record could not be allocated, returns nullptr.
+        [[nodiscard]] RWPtr<Record>
+        AcquireRecord() noexcept;
+
+        /// \brief Release a record acquired via ::AcquireRecord().
+        static void
+        ReleaseRecord(Mutable<Record> record) noexcept;
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Per-thread records, allocated lazily.
+        std::atomic<RWPtr<Record>> records_[kRecordCount] = {};
+
+    };
+
+    /************************************************************************/
+    /* INSTRUMENTING ALLOCATOR <ALLOCATOR> :: SITE STATISTICS               */
+    /************************************************************************/
+
+    /// \brief Statistics of a single allocation site.
+    template <Templates::Allocator TAllocator>
+    struct InstrumentingAllocator<TAllocator>::TSiteStatistics
+    {
+        /// \brief Number of histogram buckets.
+        ///
+        /// Bucket n counts allocations whose size is in [2^(n-1); 2^n).
+        /// The last bucket counts all larger allocations.
+        static constexpr Int
+        kHistogramCount = 32;
+
+        /// \brief Allocation site. nullptr for the unknown site.
+        Ptr<Diagnostics::SourceLocation> site_{ nullptr };
+
+        /// \brief Number of allocations.
+        Int allocation_count_{ 0 };
+
+        /// \brief Number of deallocations.
+        Int deallocation_count_{ 0 };
+
+        /// \brief Total allocated memory.
+        Bytes allocated_size_;
+
+        /// \brief Total deallocated memory.
+        Bytes deallocated_size_;
+
+        /// \brief Memory currently allocated.
+        Bytes live_size_;
+
+        /// \brief Peak of memory allocated at once.
+        ///
+        /// \remarks Sites shared by multiple threads report a lower bound
+        ///          of the actual peak.
+        Bytes peak_size_;
+
+        /// \brief Allocation count by size.
+        Int histogram_[kHistogramCount] = {};
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/instrumenting_allocator.inl"
+
+// ===========================================================================
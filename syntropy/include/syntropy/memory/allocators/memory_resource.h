@@ -0,0 +1,161 @@
+/// \file memory_resource.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains adapters between allocators and standard memory
+///        resources.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <memory_resource>
+
+#include "syntropy/language/foundation/foundation.h"
+#include "syntropy/language/templates/concepts.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* MEMORY RESOURCE <ALLOCATOR>                                          */
+    /************************************************************************/
+
+    /// \brief Standard memory resource view of an allocator, used to let
+    ///        std::pmr containers allocate on Syntropy allocators.
+    ///
+    /// The resource doesn't own the underlying allocator, which shall
+    /// outlive the resource and any container using it.
+    ///
+    /// When TAllocator is BaseAllocator, a default-constructed resource
+    /// refers to the scope allocator active at construction time: the
+    /// resource is not affected by later calls to SetAllocator(allocator),
+    /// such that memory is always returned to the allocator it came from.
+    ///
+    /// \remarks As mandated by std::pmr::memory_resource, failing to
+    ///          allocate a block throws std::bad_alloc.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    template <Templates::Allocator TAllocator>
+    class MemoryResource : public std::pmr::memory_resource
+    {
+    public:
+
+        /// \brief Create a resource referring to the current scope
+        ///        allocator.
+        MemoryResource() noexcept
+            requires Templates::IsSame<TAllocator, BaseAllocator>;
+
+        /// \brief Create a resource referring to an allocator.
+        MemoryResource(Mutable<TAllocator> allocator) noexcept;
+
+        /// \brief Default copy constructor.
+        MemoryResource(Immutable<MemoryResource>) noexcept = default;
+
+        /// \brief Default virtual destructor.
+        virtual ~MemoryResource() = default;
+
+        /// \brief Default assignment operator.
+        Mutable<MemoryResource>
+        operator=(Immutable<MemoryResource>) noexcept = default;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief Allocate a memory block on the underlying allocator.
+        [[nodiscard]] virtual RWTypelessPtr
+        do_allocate(std::size_t size, std::size_t alignment) override;
+
+        /// \brief Deallocate a memory block on the underlying allocator.
+        virtual void
+        do_deallocate(RWTypelessPtr storage,
+                      std::size_t size,
+                      std::size_t alignment) override;
+
+        /// \brief Check whether another resource refers to the same
+        ///        allocator.
+        [[nodiscard]] virtual bool
+        do_is_equal(Immutable<std::pmr::memory_resource> rhs)
+            const noexcept override;
+
+        /// \brief Underlying allocator.
+        RWPtr<TAllocator> allocator_{ nullptr };
+
+    };
+
+    /************************************************************************/
+    /* MEMORY RESOURCE ALLOCATOR                                            */
+    /************************************************************************/
+
+    /// \brief Tier 0 allocator forwarding requests to a standard memory
+    ///        resource.
+    ///
+    /// Wrap this allocator in a PolymorphicAllocator to expose a standard
+    /// memory resource as a BaseAllocator.
+    ///
+    /// The allocator doesn't own the underlying resource, which shall
+    /// outlive the allocator and any block allocated on it.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class MemoryResourceAllocator
+    {
+    public:
+
+        /// \brief Create an allocator referring to the standard default
+        ///        memory resource.
+        MemoryResourceAllocator() noexcept;
+
+        /// \brief Create an allocator referring to a memory resource.
+        MemoryResourceAllocator(
+            Mutable<std::pmr::memory_resource> memory_resource) noexcept;
+
+        /// \brief Default copy constructor.
+        MemoryResourceAllocator(Immutable<MemoryResourceAllocator>) noexcept
+            = default;
+
+        /// \brief Default destructor.
+        ~MemoryResourceAllocator() noexcept = default;
+
+        /// \brief Default assignment operator.
+        Mutable<MemoryResourceAllocator>
+        operator=(Immutable<MemoryResourceAllocator>) noexcept = default;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        /// \remarks The behavior of this function is undefined unless
+        ///          the provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Access the underlying memory resource.
+        [[nodiscard]] Mutable<std::pmr::memory_resource>
+        GetMemoryResource() const noexcept;
+
+    private:
+
+        /// \brief Underlying memory resource.
+        RWPtr<std::pmr::memory_resource> memory_resource_{ nullptr };
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/memory_resource.inl"
+
+// ===========================================================================
@@ -0,0 +1,141 @@
+/// \file numa_arena_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for NUMA-aware arena allocators.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <mutex>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* NUMA ARENA ALLOCATOR                                                 */
+    /************************************************************************/
+
+    /// \brief Tier 0 thread-safe allocator that keeps memory local to the
+    ///        NUMA node of the allocating thread.
+    ///
+    /// The allocator keeps a sub-arena for each node. Each sub-arena
+    /// allocates sequentially over a chain of chunks, whose physical pages
+    /// are preferably acquired from the sub-arena node. Threads running on
+    /// the same node share the same sub-arena.
+    ///
+    /// Pointer-level deallocation is not supported: memory is reclaimed
+    /// all at once via ::DeallocateAll() or upon destruction.
+    ///
+    /// On systems with a single node, a single sub-arena is used and no
+    /// placement is performed.
+    ///
+    /// \author Raffaele D. Facendola - April 2021
+    class NumaArenaAllocator
+    {
+    public:
+
+        /// \brief Maximum number of sub-arenas. Nodes exceeding this
+        ///        count share sub-arenas with other nodes.
+        static constexpr Int
+        kArenaCount = 64;
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param granularity Minimum size of each chunk, rounded up to
+        ///                    the virtual memory page size.
+        NumaArenaAllocator(Bytes granularity) noexcept;
+
+        /// \brief No copy constructor.
+        NumaArenaAllocator(Immutable<NumaArenaAllocator>) = delete;
+
+        /// \brief Destructor.
+        ~NumaArenaAllocator() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<NumaArenaAllocator>
+        operator=(Immutable<NumaArenaAllocator>) = delete;
+
+        /// \brief Allocate a new memory block on the node of the calling
+        ///        thread.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Allocate a new memory block on a specific node.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment, Int node) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// Pointer-level deallocation is not supported: this method does
+        /// nothing.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Deallocate every allocation performed on this allocator
+        ///        so far.
+        ///
+        /// \remarks This method is not thread-safe.
+        void
+        DeallocateAll() noexcept;
+
+        /// \brief Check whether this allocator owns a memory block.
+        ///
+        /// \remarks This method runs in time proportional to the number of
+        ///          chunks.
+        [[nodiscard]] Bool
+        Owns(Immutable<ByteSpan> block) const noexcept;
+
+        /// \brief Get the number of sub-arenas.
+        [[nodiscard]] Int
+        GetArenaCount() const noexcept;
+
+    private:
+
+        /// \brief A chunk in the allocation chain of a sub-arena.
+        struct Chunk;
+
+        /// \brief A sub-arena serving a NUMA node.
+        struct Arena;
+
+        /// \brief Allocate a new chunk in a sub-arena, large enough to fit
+        ///        a block of given size and alignment.
+        [[nodiscard]] Bool
+        AllocateChunk(Mutable<Arena> arena,
+                      Int node,
+                      Bytes size,
+                      Alignment alignment) noexcept;
+
+        /// \brief Minimum size of each chunk.
+        Bytes granularity_;
+
+        /// \brief Number of sub-arenas in use.
+        Int arena_count_{ 1 };
+
+        /// \brief Sub-arenas.
+        RWPtr<Arena> arenas_{ nullptr };
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/numa_arena_allocator.inl"
+
+// ===========================================================================
@@ -0,0 +1,84 @@
+/// \file page_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for allocators mapping blocks to
+///        dedicated virtual memory pages.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* PAGE ALLOCATOR                                                       */
+    /************************************************************************/
+
+    /// \brief Tier 0 allocator mapping each block to dedicated virtual
+    ///        memory pages, which are returned to the system as soon as
+    ///        the block is deallocated.
+    ///
+    /// Each block is rounded up to a multiple of the page size, therefore
+    /// this allocator is meant for large blocks only.
+    ///
+    /// Fresh pages are zero-filled by the system upon first access:
+    /// zero-filled blocks are allocated without writing them, and their
+    /// physical memory is acquired lazily.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class PageAllocator
+    {
+    public:
+
+        /// \brief Default constructor.
+        PageAllocator() noexcept = default;
+
+        /// \brief Default copy constructor.
+        PageAllocator(Immutable<PageAllocator>) noexcept = default;
+
+        /// \brief Default destructor.
+        ~PageAllocator() noexcept = default;
+
+        /// \brief Default assignment operator.
+        Mutable<PageAllocator>
+        operator=(Immutable<PageAllocator>) noexcept = default;
+
+        /// \brief Allocate a new memory block.
+        ///
+        /// Alignments stricter than the page alignment are not supported.
+        ///
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Allocate a new zero-filled memory block, without writing
+        ///        it.
+        ///
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        AllocateZeroed(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        /// \remarks The behavior of this function is undefined unless
+        ///          the provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/page_allocator.inl"
+
+// ===========================================================================
@@ -0,0 +1,180 @@
+/// \file segregated_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for size-class allocators based on
+///        segregated slabs.
+///
+/// \author Raffaele D. Facendola - 2016
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+#include "syntropy/virtual_memory/foundation/virtual_buffer.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* SEGREGATED ALLOCATOR <ALLOCATOR>                                     */
+    /************************************************************************/
+
+    /// \brief Tier 1 allocator that serves small blocks from slabs
+    ///        segregated by size class and forwards larger or over-aligned
+    ///        blocks to an underlying allocator.
+    ///
+    /// Slabs are carved from a reserved virtual memory range and aligned
+    /// to their size, so that the slab of any block is found by masking
+    /// its address. Each slab tracks its blocks in an occupancy bitmap.
+    ///
+    /// Slabs that become empty return their pages to the system, unless
+    /// they are the last slab of their class with free blocks. The address
+    /// range of a returned slab is recycled by any class.
+    ///
+    /// Based on "Hoard: A Scalable Memory Allocator for Multithreaded
+    /// Applications" - Berger et al.
+    ///
+    /// \author Raffaele D. Facendola - January 2017, 2021
+    template <Templates::Allocator TAllocator>
+    class SegregatedAllocator
+    {
+    public:
+
+        /// \brief Number of size classes.
+        static constexpr Int
+        kClassCount = 32;
+
+        /// \brief Size of the largest class. Larger blocks are forwarded to
+        ///        the underlying allocator.
+        static constexpr Int
+        kMaxClassSize = 8192;
+
+        /// \brief Largest alignment served by slabs. Blocks with stricter
+        ///        alignment are forwarded to the underlying allocator.
+        static constexpr Int
+        kMaxClassAlignment = 16;
+
+        /// \brief Size of each slab.
+        static constexpr Int
+        kSlabSize = 65536;
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param capacity Maximum amount of memory reserved for slabs.
+        /// \param arguments Arguments used to construct the underlying
+        ///                  allocator.
+        template <typename... TArguments>
+        SegregatedAllocator(Bytes capacity,
+                            Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief No copy constructor.
+        SegregatedAllocator(Immutable<SegregatedAllocator>) = delete;
+
+        /// \brief Default destructor.
+        ~SegregatedAllocator() noexcept = default;
+
+        /// \brief No assignment operator.
+        Mutable<SegregatedAllocator>
+        operator=(Immutable<SegregatedAllocator>) = delete;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Allocate a new zero-filled memory block.
+        ///
+        /// Blocks served by slabs are zeroed explicitly, whereas other
+        /// blocks are zeroed by the underlying allocator.
+        ///
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        AllocateZeroed(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Check whether a block of given size and alignment is
+        ///        served by slabs.
+        [[nodiscard]] static Bool
+        IsSegregated(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief A slab of same-sized blocks.
+        struct Slab;
+
+        /// \brief Get the class of blocks of given size.
+        [[nodiscard]] static Int
+        GetClass(Bytes size) noexcept;
+
+        /// \brief Get the size of blocks in a class.
+        [[nodiscard]] static Bytes
+        GetClassSize(Int size_class) noexcept;
+
+        /// \brief Acquire a new slab for a class and make it the first one
+        ///        with free blocks.
+        /// If no slab could be acquired, returns nullptr.
+        [[nodiscard]] RWPtr<Slab>
+        AcquireSlab(Int size_class) noexcept;
+
+        /// \brief Return an empty slab pages to the system.
+        void
+        ReleaseSlab(Mutable<Slab> slab) noexcept;
+
+        /// \brief Link a slab to the list of slabs with free blocks.
+        void
+        LinkSlab(Mutable<Slab> slab) noexcept;
+
+        /// \brief Unlink a slab from the list of slabs with free blocks.
+        void
+        UnlinkSlab(Mutable<Slab> slab) noexcept;
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Virtual memory range slabs are carved from.
+        VirtualMemory::VirtualBuffer buffer_;
+
+        /// \brief Pointer to the first slab never acquired.
+        RWBytePtr head_{ nullptr };
+
+        /// \brief Pointer past the last slab.
+        RWBytePtr end_{ nullptr };
+
+        /// \brief Released slabs, whose address range can be recycled.
+        RWPtr<Slab> free_slabs_{ nullptr };
+
+        /// \brief Slabs with at least one free block, for each class.
+        RWPtr<Slab> partial_slabs_[kClassCount] = {};
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/segregated_allocator.inl"
+
+// ===========================================================================
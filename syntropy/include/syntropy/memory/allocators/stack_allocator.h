@@ -0,0 +1,198 @@
+/// \file stack_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for stack allocators (aka linear or
+///        monotonic allocators).
+///
+/// \author Raffaele D. Facendola - 2017
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* STACK ALLOCATOR <ALLOCATOR>                                          */
+    /************************************************************************/
+
+    /// \brief Tier 1 allocator that uses an underlying allocator to
+    ///        allocate over a chain of contiguous memory ranges.
+    ///
+    /// Memory is allocated sequentially and divided into chunks:
+    /// pointer-level deallocation is not supported, memory is reclaimed
+    /// all at once by rewinding the allocator to a previous checkpoint.
+    /// When the current chunk is exhausted a new chunk is requested from
+    /// the underlying allocator automatically.
+    ///
+    /// \author Raffaele D. Facendola - January 2017, August 2018
+    template <Templates::Allocator TAllocator>
+    class StackAllocator
+    {
+    public:
+
+        /// \brief A checkpoint used to restore the allocator status.
+        class TCheckpoint;
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param granularity Minimum size of each chunk requested to the
+        ///                    underlying allocator.
+        /// \param arguments Arguments used to construct the underlying
+        ///                  allocator.
+        template <typename... TArguments>
+        StackAllocator(Bytes granularity,
+                       Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief No copy constructor.
+        StackAllocator(Immutable<StackAllocator>) = delete;
+
+        /// \brief Move constructor.
+        StackAllocator(Movable<StackAllocator> rhs) noexcept;
+
+        /// \brief Destructor.
+        ~StackAllocator() noexcept;
+
+        /// \brief Unified assignment operator.
+        Mutable<StackAllocator>
+        operator=(StackAllocator rhs) noexcept;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// Pointer-level deallocation is not supported: this method does
+        /// nothing.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Attempt to resize a memory block in-place.
+        ///
+        /// If the block could be resized without moving its content,
+        /// returns true and the block shall be deallocated with the new
+        /// size, otherwise returns false and the block is left untouched.
+        ///
+        /// Only the most recent block can be resized, within the current
+        /// chunk.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        [[nodiscard]] Bool
+        Reallocate(Immutable<RWByteSpan> block,
+                   Bytes size,
+                   Alignment alignment) noexcept;
+
+        /// \brief Deallocate every allocation performed on this allocator
+        ///        so far, invalidating all outstanding checkpoints.
+        void
+        DeallocateAll() noexcept;
+
+        /// \brief Check whether this allocator owns a memory block.
+        ///
+        /// \remarks This method runs in time proportional to the number of
+        ///          chunks.
+        [[nodiscard]] Bool
+        Owns(Immutable<ByteSpan> block) const noexcept;
+
+        /// \brief Get the current state of the allocator.
+        [[nodiscard]] TCheckpoint
+        Checkpoint() const noexcept;
+
+        /// \brief Restore the allocator to a previous state.
+        ///
+        /// This method invalidates all checkpoints obtained after the
+        /// provided one. Chunks allocated after the checkpoint are returned
+        /// to the underlying allocator.
+        ///
+        /// \remarks If the provided checkpoint wasn't obtained by means of
+        ///          ::Checkpoint() or it was invalidated, the behavior of
+        ///          this method is undefined.
+        void
+        Rewind(Immutable<TCheckpoint> checkpoint) noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+        /// \brief Swap this allocator with another one.
+        void
+        Swap(Mutable<StackAllocator> rhs) noexcept;
+
+    private:
+
+        /// \brief A chunk in the allocation chain.
+        struct Chunk;
+
+        /// \brief Allocate a new chunk large enough to fit a block of given
+        ///        size and alignment and make it the current one.
+        [[nodiscard]] Bool
+        AllocateChunk(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate the current chunk and make the previous one
+        ///        the current one.
+        void
+        DeallocateChunk() noexcept;
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Minimum size of each chunk.
+        Bytes granularity_;
+
+        /// \brief Current chunk.
+        RWPtr<Chunk> chunk_{ nullptr };
+
+        /// \brief Pointer past the last allocated byte in the current chunk.
+        RWBytePtr head_{ nullptr };
+
+        /// \brief Pointer past the last byte in the current chunk.
+        RWBytePtr end_{ nullptr };
+
+    };
+
+    /************************************************************************/
+    /* STACK ALLOCATOR <ALLOCATOR> :: CHECKPOINT                            */
+    /************************************************************************/
+
+    /// \brief Represents a checkpoint used to rewind a stack allocator back
+    ///        to a previous state.
+    template <Templates::Allocator TAllocator>
+    class StackAllocator<TAllocator>::TCheckpoint
+    {
+        friend class StackAllocator<TAllocator>;
+
+        /// \brief Current chunk when the checkpoint was taken.
+        RWPtr<Chunk> chunk_{ nullptr };
+
+        /// \brief Pointer past the last allocated byte when the checkpoint
+        ///        was taken.
+        RWBytePtr head_{ nullptr };
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/stack_allocator.inl"
+
+// ===========================================================================
@@ -0,0 +1,246 @@
+/// \file thread_caching_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for allocators caching small blocks on a
+///        per-thread basis.
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR                                             */
+    /************************************************************************/
+
+    /// \brief Tier 1 allocator front-end which serves small blocks from
+    ///        per-thread caches.
+    ///
+    /// Small blocks are rounded up to a size class and served from a
+    /// thread-local free list, without synchronization. Thread caches are
+    /// refilled from and flushed to shared free lists in batches, which are
+    /// in turn refilled with chunks acquired from a backing allocator.
+    ///
+    /// Blocks are not bound to the thread that allocated them: a block
+    /// deallocated on a different thread is pushed to that thread's cache
+    /// and eventually returned to shared free lists along with other
+    /// blocks in the same batch.
+    ///
+    /// Large or over-aligned blocks are forwarded to the backing allocator.
+    /// Chunks are never returned to the backing allocator, except when the
+    /// allocator is destroyed.
+    ///
+    /// This allocator is thread-safe. Thread caches are flushed when their
+    /// thread exits.
+    ///
+    /// \remarks The behavior of this allocator is undefined if it is
+    ///          destroyed while other threads are using it.
+    ///
+    /// \author Raffaele D. Facendola - August 2020
+    class ThreadCachingAllocator
+    {
+    public:
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param allocator Backing allocator shared by all threads. Must
+        ///                  outlive this allocator.
+        ThreadCachingAllocator(Mutable<BaseAllocator> allocator
+                                   = GetSystemAllocator()) noexcept;
+
+        /// \brief No copy constructor.
+        ThreadCachingAllocator(Immutable<ThreadCachingAllocator>) = delete;
+
+        /// \brief Destructor.
+        ~ThreadCachingAllocator() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<ThreadCachingAllocator>
+        operator=(Immutable<ThreadCachingAllocator>) = delete;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment), on any thread.
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Return every block cached by the calling thread to the
+        ///        shared free lists.
+        void
+        Flush() noexcept;
+
+        /// \brief Access the backing allocator.
+        [[nodiscard]] Mutable<BaseAllocator>
+        GetAllocator() noexcept;
+
+    private:
+
+        /// \brief A free block, linked to the next free block in its list.
+        struct FreeBlock;
+
+        /// \brief A singly-linked list of free blocks.
+        struct FreeList;
+
+        /// \brief Header of a chunk acquired from the backing allocator.
+        struct Chunk;
+
+        /// \brief Free lists of a thread, for each size class.
+        struct Cache;
+
+        /// \brief Caches of a thread, for each allocator.
+        class CacheTable;
+
+        /// \brief Maximum size of blocks served by thread caches.
+        static constexpr Int
+        kMaxCachedSize = 32768;
+
+        /// \brief Maximum alignment of blocks served by thread caches.
+        static constexpr Int
+        kCachedAlignment = 16;
+
+        /// \brief Number of size classes.
+        static constexpr Int
+        kClassCount = 40;
+
+        /// \brief Amount of memory transferred in a single batch between
+        ///        thread caches and shared free lists.
+        static constexpr Int
+        kBatchSize = 8192;
+
+        /// \brief Size of chunks acquired from the backing allocator.
+        static constexpr Int
+        kChunkSize = 65536;
+
+        /// \brief Get the size class of a block.
+        [[nodiscard]] static Int
+        ClassOf(Int size) noexcept;
+
+        /// \brief Get the size of blocks in a size class.
+        [[nodiscard]] static Int
+        ClassSize(Int size_class) noexcept;
+
+        /// \brief Get the number of blocks in a batch of a size class.
+        [[nodiscard]] static Int
+        BatchOf(Int size_class) noexcept;
+
+        /// \brief Get the calling thread's cache, registering a new one if
+        ///        necessary. Returns nullptr if no cache is available.
+        [[nodiscard]] RWPtr<Cache>
+        GetCache() noexcept;
+
+        /// \brief Move a batch of blocks from the shared free lists to a
+        ///        thread cache.
+        [[nodiscard]] Bool
+        Refill(Mutable<FreeList> free_list, Int size_class) noexcept;
+
+        /// \brief Move a number of blocks from a thread cache to the shared
+        ///        free lists.
+        void
+        Release(Mutable<FreeList> free_list,
+                Int size_class,
+                Int count) noexcept;
+
+        /// \brief Move all blocks from a thread cache to the shared free
+        ///        lists.
+        void
+        Release(Mutable<Cache> cache) noexcept;
+
+        /// \brief Carve new blocks for a size class out of a new chunk.
+        ///
+        /// \remarks Must be called while holding mutex_.
+        [[nodiscard]] Bool
+        Grow(Int size_class) noexcept;
+
+        /// \brief Backing allocator.
+        RWPtr<BaseAllocator> allocator_{ nullptr };
+
+        /// \brief Guards shared free lists, chunks and the backing
+        ///        allocator.
+        std::mutex mutex_;
+
+        /// \brief Shared free lists, for each size class.
+        RWPtr<FreeBlock> free_lists_[kClassCount] = {};
+
+        /// \brief Chunks acquired so far.
+        RWPtr<Chunk> chunks_{ nullptr };
+
+        /// \brief Thread caches bound to this allocator.
+        ///
+        /// \remarks Guarded by a mutex shared by all instances.
+        RWPtr<Cache> caches_{ nullptr };
+
+    };
+
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR :: FREE BLOCK                               */
+    /************************************************************************/
+
+    /// \brief A free block, linked to the next free block in its list.
+    struct ThreadCachingAllocator::FreeBlock
+    {
+        /// \brief Next free block.
+        RWPtr<FreeBlock> next_{ nullptr };
+    };
+
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR :: FREE LIST                                */
+    /************************************************************************/
+
+    /// \brief A singly-linked list of free blocks.
+    struct ThreadCachingAllocator::FreeList
+    {
+        /// \brief First free block.
+        RWPtr<FreeBlock> head_{ nullptr };
+
+        /// \brief Number of free blocks.
+        Int count_{ 0 };
+    };
+
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR :: CACHE                                    */
+    /************************************************************************/
+
+    /// \brief Free lists of a thread, for each size class.
+    struct ThreadCachingAllocator::Cache
+    {
+        /// \brief Allocator this cache is bound to. nullptr if unbound.
+        std::atomic<RWPtr<ThreadCachingAllocator>> owner_{ nullptr };
+
+        /// \brief Next cache bound to the same allocator.
+        RWPtr<Cache> next_{ nullptr };
+
+        /// \brief Previous cache bound to the same allocator.
+        RWPtr<Cache> previous_{ nullptr };
+
+        /// \brief Free lists, for each size class.
+        FreeList free_lists_[kClassCount] = {};
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/thread_caching_allocator.inl"
+
+// ===========================================================================
@@ -0,0 +1,307 @@
+/// \file tlsf_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for two-level segregated-fit allocators.
+///
+/// \author Raffaele D. Facendola - 2016
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* TLSF ALLOCATOR <ALLOCATOR>                                           */
+    /************************************************************************/
+
+    /// \brief Tier 1 general-purpose allocator based on a two-level
+    ///        segregated-fit scheme.
+    ///
+    /// Memory is acquired from an underlying allocator in pools and
+    /// divided into blocks of arbitrary size. Free blocks are indexed by a
+    /// two-level bitmap, therefore both allocation and deallocation run in
+    /// constant time. Adjacent free blocks are coalesced immediately upon
+    /// deallocation.
+    ///
+    /// Pools are never returned to the underlying allocator, except when
+    /// the allocator is destroyed or via ::DeallocateAll().
+    ///
+    /// Based on: http://www.gii.upv.es/tlsf/files/jrts2008.pdf
+    ///
+    /// \author Raffaele D. Facendola - January 2017
+    template <Templates::Allocator TAllocator>
+    class TLSFAllocator
+    {
+    public:
+
+        /// \brief Allocator statistics.
+        struct TStatistics;
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param pool_size Minimum size of each pool requested to the
+        ///                  underlying allocator.
+        /// \param arguments Arguments used to construct the underlying
+        ///                  allocator.
+        template <typename... TArguments>
+        TLSFAllocator(Bytes pool_size,
+                      Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief No copy constructor.
+        TLSFAllocator(Immutable<TLSFAllocator>) = delete;
+
+        /// \brief Move constructor.
+        TLSFAllocator(Movable<TLSFAllocator> rhs) noexcept;
+
+        /// \brief Destructor.
+        ~TLSFAllocator() noexcept;
+
+        /// \brief Unified assignment operator.
+        Mutable<TLSFAllocator>
+        operator=(TLSFAllocator rhs) noexcept;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        /// Blocks larger than about 1 TiB are never allocated.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Attempt to resize a memory block in-place.
+        ///
+        /// If the block could be resized without moving its content,
+        /// returns true and the block shall be deallocated with the new
+        /// size, otherwise returns false and the block is left untouched.
+        ///
+        /// Blocks grow by absorbing the physically following block, if
+        /// free.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        [[nodiscard]] Bool
+        Reallocate(Immutable<RWByteSpan> block,
+                   Bytes size,
+                   Alignment alignment) noexcept;
+
+        /// \brief Deallocate every allocation performed on this allocator
+        ///        so far, returning all pools to the underlying allocator.
+        void
+        DeallocateAll() noexcept;
+
+        /// \brief Check whether this allocator owns a memory block.
+        [[nodiscard]] Bool
+        Owns(Immutable<ByteSpan> block) const noexcept;
+
+        /// \brief Get allocator statistics.
+        ///
+        /// \remarks This method runs in time proportional to the number of
+        ///          free blocks in the largest non-empty size class.
+        [[nodiscard]] TStatistics
+        GetStatistics() const noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+        /// \brief Swap this allocator with another one.
+        void
+        Swap(Mutable<TLSFAllocator> rhs) noexcept;
+
+    private:
+
+        /// \brief Header of a memory block, either free or busy.
+        struct Block;
+
+        /// \brief Header of a memory pool.
+        struct Pool;
+
+        /// \brief Index of a free list.
+        struct Index;
+
+        /// \brief Number of bits used to encode second-level indexes.
+        static constexpr Int
+        kSecondLevelBits = 5;
+
+        /// \brief Number of second-level free lists per first-level.
+        static constexpr Int
+        kSecondLevelCount = Int{ 1 } << kSecondLevelBits;
+
+        /// \brief Number of bits used to encode block granularity.
+        static constexpr Int
+        kGranularityBits = 4;
+
+        /// \brief Block size granularity. Blocks payloads are always aligned
+        ///        to this value.
+        static constexpr Int
+        kGranularity = Int{ 1 } << kGranularityBits;
+
+        /// \brief Blocks smaller than this value are linearly indexed by
+        ///        the first first-level.
+        static constexpr Int
+        kSmallBlockSize = kSecondLevelCount * kGranularity;
+
+        /// \brief Number of first-level free lists.
+        static constexpr Int
+        kFirstLevelCount = 32;
+
+        /// \brief Size of the largest block which can be indexed by the
+        ///        last first-level, once rounded (about 1 TiB).
+        static constexpr Int
+        kMaxBlockSize = (2 * kSecondLevelCount - 1)
+            << (kFirstLevelCount + kGranularityBits - 2);
+
+        /// \brief Size of a block header, not including free-list links.
+        static constexpr Int
+        kBlockOverhead = 2 * sizeof(RWTypelessPtr);
+
+        /// \brief Minimum block payload size, large enough to contain
+        ///        free-list links.
+        static constexpr Int
+        kMinBlockSize = 2 * sizeof(RWTypelessPtr);
+
+        /// \brief Get the free list index a free block belongs to.
+        [[nodiscard]] static Index
+        MapInsert(Int size) noexcept;
+
+        /// \brief Round a requested size up to the size class all of whose
+        ///        blocks are guaranteed to fit.
+        [[nodiscard]] static Int
+        MapRound(Int size) noexcept;
+
+        /// \brief Get the payload of a block.
+        [[nodiscard]] static RWBytePtr
+        PayloadOf(RWPtr<Block> block) noexcept;
+
+        /// \brief Get a block from its payload.
+        [[nodiscard]] static RWPtr<Block>
+        BlockOf(RWBytePtr payload) noexcept;
+
+        /// \brief Get the block physically following another one.
+        [[nodiscard]] static RWPtr<Block>
+        NextOf(RWPtr<Block> block) noexcept;
+
+        /// \brief Create a new block header at a given address.
+        [[nodiscard]] static RWPtr<Block>
+        MakeBlock(RWBytePtr address,
+                  RWPtr<Block> previous,
+                  Int size) noexcept;
+
+        /// \brief Find a free block whose size is at least size and remove
+        ///        it from its free list.
+        [[nodiscard]] RWPtr<Block>
+        SearchBlock(Int size) noexcept;
+
+        /// \brief Insert a free block into the relevant free list.
+        void
+        InsertBlock(RWPtr<Block> block) noexcept;
+
+        /// \brief Remove a free block from its free list.
+        void
+        RemoveBlock(RWPtr<Block> block) noexcept;
+
+        /// \brief Split the trailing part of a block exceeding size into a
+        ///        new free block.
+        void
+        SplitBlock(RWPtr<Block> block, Int size) noexcept;
+
+        /// \brief Split the leading part of a block such that the payload
+        ///        of the remaining part is aligned to alignment.
+        [[nodiscard]] RWPtr<Block>
+        AlignBlock(RWPtr<Block> block, Int alignment) noexcept;
+
+        /// \brief Acquire a new pool from the underlying allocator, large
+        ///        enough to contain a block of a given size.
+        Bool
+        AllocatePool(Int size) noexcept;
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Minimum size of each pool.
+        Bytes pool_size_;
+
+        /// \brief Pools acquired so far.
+        RWPtr<Pool> pools_{ nullptr };
+
+        /// \brief Bitmap of non-empty first-level free lists.
+        Int first_bitmap_{ 0 };
+
+        /// \brief Bitmaps of non-empty second-level free lists, one for each
+        ///        first-level.
+        Int second_bitmaps_[kFirstLevelCount] = {};
+
+        /// \brief Free lists heads.
+        RWPtr<Block> free_lists_[kFirstLevelCount][kSecondLevelCount] = {};
+
+        /// \brief Total memory acquired from the underlying allocator.
+        Int reserved_size_{ 0 };
+
+        /// \brief Total payload size of busy blocks.
+        Int allocated_size_{ 0 };
+
+        /// \brief Total payload size of free blocks.
+        Int free_size_{ 0 };
+
+        /// \brief Number of free blocks.
+        Int free_count_{ 0 };
+
+    };
+
+    /************************************************************************/
+    /* TLSF ALLOCATOR <ALLOCATOR> :: STATISTICS                             */
+    /************************************************************************/
+
+    /// \brief Statistics of a two-level segregated-fit allocator.
+    template <Templates::Allocator TAllocator>
+    struct TLSFAllocator<TAllocator>::TStatistics
+    {
+        /// \brief Total memory acquired from the underlying allocator.
+        Bytes reserved_size_;
+
+        /// \brief Total memory in busy blocks, including padding.
+        Bytes allocated_size_;
+
+        /// \brief Total memory in free blocks.
+        Bytes free_size_;
+
+        /// \brief Size of the largest free block.
+        Bytes largest_free_size_;
+
+        /// \brief Number of free blocks.
+        Int free_count_{ 0 };
+
+        /// \brief External fragmentation, in the range [0; 1].
+        ///
+        /// Defined as the fraction of free memory that cannot be served by
+        /// a single allocation of the largest free block size.
+        Float fragmentation_{ 0.0f };
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/tlsf_allocator.inl"
+
+// ===========================================================================
@@ -0,0 +1,227 @@
+/// \file tracing_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains definitions for allocators recording allocation
+///        traces of other allocators.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* ALLOCATION EVENT KIND                                                */
+    /************************************************************************/
+
+    /// \brief Kind of a traced allocator call.
+    enum class AllocationEventKind : Enum8
+    {
+        /// \brief A block was allocated.
+        kAllocate = 0,
+
+        /// \brief A block was deallocated.
+        kDeallocate = 1,
+    };
+
+    /************************************************************************/
+    /* ALLOCATION EVENT                                                     */
+    /************************************************************************/
+
+    /// \brief A traced allocator call, as stored in a trace file.
+    ///
+    /// Blocks are identified by their address: the same address may
+    /// identify different blocks over time, but never two live blocks.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    struct AllocationEvent
+    {
+        /// \brief Nanoseconds elapsed since the trace began.
+        Int timestamp_{ 0 };
+
+        /// \brief Address of the block.
+        Int address_{ 0 };
+
+        /// \brief Size of the block, in bytes.
+        Int size_{ 0 };
+
+        /// \brief Index of the calling thread, in order of first
+        ///        appearance.
+        Fix32 thread_{};
+
+        /// \brief Base-2 logarithm of the block alignment.
+        Fix8 alignment_{};
+
+        /// \brief Event kind.
+        AllocationEventKind kind_{};
+
+        /// \brief Padding, reserved.
+        Fix16 reserved_{};
+    };
+
+    static_assert(sizeof(AllocationEvent) == 32,
+                  "Trace file layout changed.");
+
+    /************************************************************************/
+    /* ALLOCATION TRACE HEADER                                              */
+    /************************************************************************/
+
+    /// \brief Header at the beginning of a trace file, followed by a
+    ///        sequence of AllocationEvent in the order they were recorded.
+    ///
+    /// Trace files are stored with the byte order of the recording
+    /// machine.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    struct AllocationTraceHeader
+    {
+        /// \brief Magic number identifying trace files ("SYNTRACE").
+        static constexpr Int
+        kMagic = 0x45434152544E5953;
+
+        /// \brief Current trace file version.
+        static constexpr Int
+        kVersion = 1;
+
+        /// \brief Magic number.
+        Int magic_{ kMagic };
+
+        /// \brief Trace file version.
+        Int version_{ kVersion };
+    };
+
+    /************************************************************************/
+    /* TRACING ALLOCATOR <ALLOCATOR>                                        */
+    /************************************************************************/
+
+    /// \brief Tier Omega allocator used to record every call performed on
+    ///        another allocator to a trace file, to be replayed offline.
+    ///
+    /// Events are buffered and written to file in batches. Calls are
+    /// serialized by a lock, such that the trace order is consistent
+    /// with the order blocks are handed out and returned.
+    ///
+    /// Failed allocations are not recorded.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    template <Templates::Allocator TAllocator>
+    class TracingAllocator
+    {
+    public:
+
+        /// \brief Number of events buffered before being written to file.
+        static constexpr Int
+        kBufferCount = 1024;
+
+        /// \brief Create a new allocator.
+        ///
+        /// If the trace file could not be opened, the allocator forwards
+        /// calls without recording them.
+        ///
+        /// \param path Path of the trace file, which is overwritten.
+        /// \param arguments Arguments used to construct the underlying
+        ///                  allocator.
+        template <typename... TArguments>
+        TracingAllocator(Ptr<char> path,
+                         Forwarding<TArguments>... arguments) noexcept;
+
+        /// \brief No copy constructor.
+        TracingAllocator(Immutable<TracingAllocator>) = delete;
+
+        /// \brief Flush pending events and close the trace file.
+        ~TracingAllocator() noexcept;
+
+        /// \brief No assignment operator.
+        Mutable<TracingAllocator>
+        operator=(Immutable<TracingAllocator>) = delete;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Write pending events to the trace file.
+        void
+        Flush() noexcept;
+
+        /// \brief Check whether calls are being recorded.
+        [[nodiscard]] Bool
+        IsTracing() const noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Mutable<TAllocator>
+        GetAllocator() noexcept;
+
+        /// \brief Access the underlying allocator.
+        [[nodiscard]] Immutable<TAllocator>
+        GetAllocator() const noexcept;
+
+    private:
+
+        /// \brief Get the index of the calling thread.
+        [[nodiscard]] static Int
+        GetThreadIndex() noexcept;
+
+        /// \brief Record an event.
+        ///
+        /// \remarks The caller must hold the lock.
+        void
+        Record(AllocationEventKind kind,
+               Immutable<RWByteSpan> block,
+               Alignment alignment) noexcept;
+
+        /// \brief Write buffered events to the trace file.
+        ///
+        /// \remarks The caller must hold the lock.
+        void
+        Write() noexcept;
+
+        /// \brief Underlying allocator.
+        TAllocator allocator_;
+
+        /// \brief Trace file. Null if the file could not be opened.
+        RWPtr<std::FILE> file_{ nullptr };
+
+        /// \brief Time the trace began.
+        std::chrono::steady_clock::time_point origin_;
+
+        /// \brief Lock serializing calls.
+        std::mutex mutex_;
+
+        /// \brief Number of buffered events.
+        Int event_count_{ 0 };
+
+        /// \brief Buffered events.
+        AllocationEvent events_[kBufferCount];
+
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/tracing_allocator.inl"
+
+// ===========================================================================
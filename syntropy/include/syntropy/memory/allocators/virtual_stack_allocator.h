@@ -0,0 +1,187 @@
+/// \file virtual_stack_allocator.h
+///
+/// \brief This header is part of the Syntropy allocators module.
+///        It contains stack allocators growing in a contiguous virtual
+///        memory space.
+///
+/// \author Raffaele D. Facendola - 2020
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+#include "syntropy/virtual_memory/foundation/virtual_buffer.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* VIRTUAL STACK ALLOCATOR                                              */
+    /************************************************************************/
+
+    /// \brief Tier 0 allocator that grows in a contiguous virtual memory
+    ///        space.
+    ///
+    /// The entire address space is reserved upfront and committed lazily,
+    /// as allocations grow. Memory is allocated sequentially:
+    /// pointer-level deallocation is not supported.
+    ///
+    /// \author Raffaele D. Facendola - May 2020
+    class VirtualStackAllocator
+    {
+    public:
+
+        /// \brief A checkpoint used to restore the allocator status.
+        class TCheckpoint;
+
+        /// \brief Create a new allocator.
+        ///
+        /// \param capacity Virtual memory capacity to reserve. This amount
+        ///                 is not committed initially, therefore it can be
+        ///                 much higher than system physical memory size.
+        /// \param granularity Granularity size when committing new virtual
+        ///                    memory pages.
+        /// \param mode Policy used to commit new virtual memory pages.
+        VirtualStackAllocator(Bytes capacity,
+                              Bytes granularity,
+                              VirtualMemory::CommitMode mode
+                                  = VirtualMemory::CommitMode::kDefault)
+            noexcept;
+
+        /// \brief No copy constructor.
+        VirtualStackAllocator(Immutable<VirtualStackAllocator>) = delete;
+
+        /// \brief Move constructor.
+        VirtualStackAllocator(Movable<VirtualStackAllocator> rhs) noexcept;
+
+        /// \brief Default destructor.
+        ~VirtualStackAllocator() noexcept = default;
+
+        /// \brief Unified assignment operator.
+        Mutable<VirtualStackAllocator>
+        operator=(VirtualStackAllocator rhs) noexcept;
+
+        /// \brief Allocate a new memory block.
+        /// If a memory block could not be allocated, returns an empty block.
+        [[nodiscard]] RWByteSpan
+        Allocate(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Reserve a new memory block.
+        ///
+        /// Reserved blocks are aligned to virtual memory page boundaries
+        /// and must be committed via VirtualMemory::Commit before accessing
+        /// them. If a memory block could not be reserved, returns an empty
+        /// block.
+        [[nodiscard]] RWByteSpan
+        Reserve(Bytes size, Alignment alignment) noexcept;
+
+        /// \brief Deallocate a memory block.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        void
+        Deallocate(Immutable<RWByteSpan> block, Alignment alignment) noexcept;
+
+        /// \brief Attempt to resize a memory block in-place.
+        ///
+        /// If the block could be resized without moving its content,
+        /// returns true and the block shall be deallocated with the new
+        /// size, otherwise returns false and the block is left untouched.
+        ///
+        /// Only the most recent block can be resized, committing new
+        /// pages as needed.
+        ///
+        /// \remarks The behavior of this function is undefined unless the
+        ///          provided block was returned by a previous call to
+        ///          ::Allocate(size, alignment).
+        [[nodiscard]] Bool
+        Reallocate(Immutable<RWByteSpan> block,
+                   Bytes size,
+                   Alignment alignment) noexcept;
+
+        /// \brief Deallocate every allocation performed on this allocator
+        ///        so far, invalidating all outstanding checkpoints.
+        void
+        DeallocateAll() noexcept;
+
+        /// \brief Check whether this allocator owns a memory block.
+        [[nodiscard]] Bool
+        Owns(Immutable<ByteSpan> block) const noexcept;
+
+        /// \brief Get the current state of the allocator.
+        [[nodiscard]] TCheckpoint
+        Checkpoint() const noexcept;
+
+        /// \brief Restore the allocator to a previous state.
+        ///
+        /// This method invalidates all checkpoints obtained after the
+        /// provided one.
+        ///
+        /// \remarks If the provided checkpoint wasn't obtained by means of
+        ///          ::Checkpoint() or it was invalidated, the behavior of
+        ///          this method is undefined.
+        void
+        Rewind(Immutable<TCheckpoint> checkpoint) noexcept;
+
+        /// \brief Swap this allocator with another one.
+        void
+        Swap(Mutable<VirtualStackAllocator> rhs) noexcept;
+
+    private:
+
+        /// \brief Ensure that memory from the current head up to a given
+        ///        address is committed.
+        [[nodiscard]] Bool
+        CommitUpTo(RWBytePtr end) noexcept;
+
+        /// \brief Virtual memory reserved for this allocator.
+        VirtualMemory::VirtualBuffer buffer_;
+
+        /// \brief Pointer past the last allocated byte.
+        RWBytePtr head_{ nullptr };
+
+        /// \brief Pointer past the last committed byte.
+        RWBytePtr commit_head_{ nullptr };
+
+        /// \brief Commit granularity. This is always a multiple of the
+        ///        virtual memory's page size.
+        Bytes granularity_;
+
+        /// \brief Policy used to commit virtual memory pages.
+        VirtualMemory::CommitMode mode_{ VirtualMemory::CommitMode::kDefault };
+
+    };
+
+    /************************************************************************/
+    /* VIRTUAL STACK ALLOCATOR :: CHECKPOINT                                */
+    /************************************************************************/
+
+    /// \brief Represents a checkpoint used to rewind a virtual stack
+    ///        allocator back to a previous state.
+    class VirtualStackAllocator::TCheckpoint
+    {
+        friend class VirtualStackAllocator;
+
+        /// \brief Pointer past the last allocated byte when the checkpoint
+        ///        was taken.
+        RWBytePtr head_{ nullptr };
+
+        /// \brief Pointer past the last committed byte when the checkpoint
+        ///        was taken.
+        RWBytePtr commit_head_{ nullptr };
+    };
+
+}
+
+// ===========================================================================
+
+#include "details/virtual_stack_allocator.inl"
+
+// ===========================================================================
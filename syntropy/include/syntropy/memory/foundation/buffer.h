@@ -31,6 +31,9 @@ namespace Syntropy::Memory
     /// destruction.  BaseAllocator is set upon construction an is never
     /// propagated.
     ///
+    /// Buffers can grow: storage is reallocated geometrically and, if the
+    /// allocator supports it, extended in-place without copying.
+    ///
     /// \author Raffaele D. Facendola - February 2017
     class Buffer
     {
@@ -48,6 +51,9 @@ namespace Syntropy::Memory
 
         /// \brief Create a new aligned zero-initialized buffer on the current
         ///        allocator.
+        ///
+        /// Allocators which know fresh memory to be zero, such as the
+        /// PageAllocator, don't write the buffer.
         Buffer(Bytes size,
                Alignment alignment,
                Mutable<BaseAllocator> allocator
@@ -110,6 +116,11 @@ namespace Syntropy::Memory
         [[nodiscard]] Bytes
         GetCount() const noexcept;
 
+        /// \brief Get the number of bytes the buffer can hold without
+        ///        reallocating.
+        [[nodiscard]] Bytes
+        GetCapacity() const noexcept;
+
         /// \brief Get buffer alignment.
         [[nodiscard]] Immutable<Alignment>
         GetAlignment() const noexcept;
@@ -118,6 +129,34 @@ namespace Syntropy::Memory
         [[nodiscard]] Mutable<BaseAllocator>
         GetAllocator() const noexcept;
 
+        /// \brief Increase buffer capacity to at least the provided value.
+        ///
+        /// If the new capacity is not greater than the current one, this
+        /// method does nothing. The buffer content is preserved.
+        ///
+        /// \remarks This method invalidates spans to the buffer unless the
+        ///          allocator could grow the storage in-place.
+        void
+        Reserve(Bytes capacity) noexcept;
+
+        /// \brief Change the number of bytes in the buffer.
+        ///
+        /// Exceeding bytes are discarded, whereas new bytes are
+        /// zero-initialized. When the capacity is exceeded, the buffer
+        /// grows geometrically.
+        ///
+        /// \remarks This method invalidates spans to the buffer unless the
+        ///          allocator could grow the storage in-place.
+        void
+        Resize(Bytes size) noexcept;
+
+        /// \brief Release unused capacity.
+        ///
+        /// \remarks This method invalidates spans to the buffer unless the
+        ///          allocator could shrink the storage in-place.
+        void
+        ShrinkToFit() noexcept;
+
         /// \brief Swap the content of two buffers.
         ///
         /// \remarks If the buffers don't share a common allocaor, the behavior
@@ -127,12 +166,20 @@ namespace Syntropy::Memory
 
     private:
 
+        /// \brief Reallocate buffer storage with a new capacity, which
+        ///        shall not be lower than the buffer size.
+        void
+        Reallocate(Bytes capacity) noexcept;
+
         /// \brief Owning allocator.
         RWPtr<BaseAllocator> allocator_{ nullptr };
 
         /// \brief Buffer data.
         RWByteSpan data_;
 
+        /// \brief Buffer capacity.
+        Bytes capacity_;
+
         /// \brief Buffer alignment.
         Alignment alignment_ = MaxAlignment();
 
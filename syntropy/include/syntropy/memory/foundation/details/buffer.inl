@@ -9,6 +9,8 @@
 
 #include "syntropy/core/algorithms/swap.h"
 
+#include "syntropy/math/math.h"
+
 #include "syntropy/diagnostics/foundation/assert.h"
 
 // ===========================================================================
@@ -38,7 +40,8 @@ namespace Syntropy::Memory
              Alignment alignment,
              Mutable<BaseAllocator> allocator) noexcept
         : allocator_(&allocator)
-        , data_(allocator.Allocate(size, alignment))
+        , data_(allocator.AllocateZeroed(size, alignment))
+        , capacity_(data_.GetCount())
         , alignment_(alignment)
     {
         SYNTROPY_ASSERT(data_.GetCount() == size);       // Out of memory?
@@ -54,8 +57,13 @@ namespace Syntropy::Memory
     inline Buffer
     ::Buffer(Immutable<Buffer> rhs,
              Mutable<BaseAllocator> allocator) noexcept
-        : Buffer(rhs.GetCount(), rhs.GetAlignment(), allocator)
+        : allocator_(&allocator)
+        , data_(allocator.Allocate(rhs.GetCount(), rhs.GetAlignment()))
+        , capacity_(data_.GetCount())
+        , alignment_(rhs.GetAlignment())
     {
+        SYNTROPY_ASSERT(data_.GetCount() == rhs.GetCount());  // OOM?
+
         Copy(data_, rhs.data_);
     }
 
@@ -65,6 +73,7 @@ namespace Syntropy::Memory
         , alignment_(rhs.alignment_)
     {
         Algorithms::Swap(data_, rhs.data_);
+        Algorithms::Swap(capacity_, rhs.capacity_);
     }
 
     inline Mutable<Buffer> Buffer
@@ -72,10 +81,25 @@ namespace Syntropy::Memory
     {
         if (this != &rhs)
         {
-            if (GetCount() != rhs.GetCount())
+            if ((capacity_ >= rhs.GetCount()) &&
+                (alignment_ >= rhs.GetAlignment()))
             {
+                // Reuse current storage.
+
+                data_ = { data_.GetData(), rhs.GetCount() };
+            }
+            else
+            {
+                allocator_->Deallocate({ data_.GetData(), capacity_ },
+                                       alignment_);
+
                 data_ = allocator_->Allocate(rhs.GetCount(),
                                              rhs.GetAlignment());
+
+                capacity_ = data_.GetCount();
+                alignment_ = rhs.GetAlignment();
+
+                SYNTROPY_ASSERT(capacity_ == rhs.GetCount());    // OOM?
             }
 
             Copy(data_, rhs.data_);
@@ -90,6 +114,7 @@ namespace Syntropy::Memory
         if (allocator_ == rhs.allocator_)
         {
             Algorithms::Swap(data_, rhs.data_);
+            Algorithms::Swap(capacity_, rhs.capacity_);
             Algorithms::Swap(alignment_, rhs.alignment_);
         }
         else
@@ -105,7 +130,8 @@ namespace Syntropy::Memory
     {
         if(allocator_)
         {
-            allocator_->Deallocate(data_, alignment_);
+            allocator_->Deallocate({ data_.GetData(), capacity_ },
+                                   alignment_);
         }
     }
 
@@ -151,6 +177,12 @@ namespace Syntropy::Memory
         return data_.GetCount();
     }
 
+    [[nodiscard]] inline Bytes Buffer
+    ::GetCapacity() const noexcept
+    {
+        return capacity_;
+    }
+
     [[nodiscard]] inline Immutable<Alignment> Buffer
     ::GetAlignment() const noexcept
     {
@@ -170,9 +202,79 @@ namespace Syntropy::Memory
             "Both this and rhs must share the same allocator.");
 
         Algorithms::Swap(data_, rhs.data_);
+        Algorithms::Swap(capacity_, rhs.capacity_);
         Algorithms::Swap(alignment_, rhs.alignment_);
     }
 
+    inline void Buffer
+    ::Reserve(Bytes capacity) noexcept
+    {
+        if (capacity > capacity_)
+        {
+            Reallocate(capacity);
+        }
+    }
+
+    inline void Buffer
+    ::Resize(Bytes size) noexcept
+    {
+        if (size > capacity_)
+        {
+            Reserve(Math::Max(size, capacity_ * 2));
+        }
+
+        if (size > capacity_)
+        {
+            return;                                     // Out of memory.
+        }
+
+        auto count = data_.GetCount();
+
+        data_ = { data_.GetData(), size };
+
+        if (size > count)
+        {
+            Zero({ data_.GetData() + count, size - count });
+        }
+    }
+
+    inline void Buffer
+    ::ShrinkToFit() noexcept
+    {
+        if (capacity_ > data_.GetCount())
+        {
+            Reallocate(data_.GetCount());
+        }
+    }
+
+    inline void Buffer
+    ::Reallocate(Bytes capacity) noexcept
+    {
+        auto block = RWByteSpan{ data_.GetData(), capacity_ };
+
+        // Attempt to resize the storage in-place first.
+
+        if (allocator_->Reallocate(block, capacity, alignment_))
+        {
+            capacity_ = capacity;
+            return;
+        }
+
+        auto storage = allocator_->Allocate(capacity, alignment_);
+
+        SYNTROPY_ASSERT(storage.GetCount() == capacity);  // Out of memory?
+
+        if (storage.GetCount() == capacity)
+        {
+            Copy(storage, data_);
+
+            allocator_->Deallocate(block, alignment_);
+
+            data_ = { storage.GetData(), data_.GetCount() };
+            capacity_ = capacity;
+        }
+    }
+
     /************************************************************************/
     /* NON-MEMBER FUNCTIONS                                                 */
     /************************************************************************/
@@ -0,0 +1,400 @@
+/// \file inline_buffer.inl
+///
+/// \author Raffaele D. Facendola - February 2021.
+
+#pragma once
+
+#include "syntropy/memory/foundation/memory.h"
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* INLINE BUFFER <COUNT>                                                */
+    /************************************************************************/
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::InlineBuffer(Mutable<BaseAllocator> allocator) noexcept
+        : InlineBuffer(ToBytes(0), MaxAlignment(), allocator)
+    {
+
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::InlineBuffer(Bytes size, Mutable<BaseAllocator> allocator) noexcept
+        : InlineBuffer(size, MaxAlignment(), allocator)
+    {
+
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::InlineBuffer(Bytes size,
+                   Alignment alignment,
+                   Mutable<BaseAllocator> allocator) noexcept
+        : allocator_(&allocator)
+        , data_(storage_, size)
+        , capacity_(ToBytes(kCount))
+        , alignment_(alignment)
+    {
+        if (!FitsInline(size))
+        {
+            data_ = allocator.AllocateZeroed(size, alignment);
+            capacity_ = data_.GetCount();
+
+            SYNTROPY_ASSERT(data_.GetCount() == size);   // Out of memory?
+        }
+        else
+        {
+            Zero(data_);
+        }
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::InlineBuffer(Immutable<InlineBuffer> rhs) noexcept
+        : InlineBuffer(rhs, rhs.GetAllocator())
+    {
+
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::InlineBuffer(Immutable<InlineBuffer> rhs,
+                   Mutable<BaseAllocator> allocator) noexcept
+        : allocator_(&allocator)
+        , data_(storage_, rhs.GetCount())
+        , capacity_(ToBytes(kCount))
+        , alignment_(rhs.GetAlignment())
+    {
+        // The content is copied over, hence it needs not be zeroed first.
+
+        if (!FitsInline(rhs.GetCount()))
+        {
+            data_ = allocator.Allocate(rhs.GetCount(), alignment_);
+            capacity_ = data_.GetCount();
+
+            SYNTROPY_ASSERT(capacity_ == rhs.GetCount());   // Out of memory?
+        }
+
+        Copy(data_, rhs.data_);
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::InlineBuffer(Movable<InlineBuffer> rhs) noexcept
+        : allocator_(rhs.allocator_)
+        , data_(rhs.data_)
+        , capacity_(rhs.capacity_)
+        , alignment_(rhs.alignment_)
+    {
+        if (rhs.IsInline())
+        {
+            data_ = { storage_, rhs.GetCount() };
+
+            Copy(data_, rhs.data_);
+        }
+
+        rhs.data_ = { rhs.storage_, ToBytes(0) };
+        rhs.capacity_ = rhs.GetInlineCapacity();
+    }
+
+    template <Int kCount>
+    inline Mutable<InlineBuffer<kCount>> InlineBuffer<kCount>
+    ::operator=(Immutable<InlineBuffer> rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            if ((capacity_ >= rhs.GetCount()) &&
+                (alignment_ >= rhs.GetAlignment()))
+            {
+                // Reuse current storage.
+
+                data_ = { data_.GetData(), rhs.GetCount() };
+            }
+            else
+            {
+                Release();
+
+                alignment_ = rhs.GetAlignment();
+
+                if (FitsInline(rhs.GetCount()))
+                {
+                    data_ = { storage_, rhs.GetCount() };
+                    capacity_ = ToBytes(kCount);
+                }
+                else
+                {
+                    data_ = allocator_->Allocate(rhs.GetCount(),
+                                                 rhs.GetAlignment());
+
+                    capacity_ = data_.GetCount();
+
+                    SYNTROPY_ASSERT(capacity_ == rhs.GetCount());  // OOM?
+                }
+            }
+
+            Copy(data_, rhs.data_);
+        }
+
+        return *this;
+    }
+
+    template <Int kCount>
+    inline Mutable<InlineBuffer<kCount>> InlineBuffer<kCount>
+    ::operator=(Movable<InlineBuffer> rhs) noexcept
+    {
+        if ((allocator_ == rhs.allocator_) && !rhs.IsInline())
+        {
+            Release();
+
+            data_ = rhs.data_;
+            capacity_ = rhs.capacity_;
+            alignment_ = rhs.alignment_;
+
+            rhs.data_ = { rhs.storage_, ToBytes(0) };
+            rhs.capacity_ = rhs.GetInlineCapacity();
+        }
+        else
+        {
+            *this = rhs;
+        }
+
+        return *this;
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::~InlineBuffer() noexcept
+    {
+        Release();
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::operator ByteSpan() const noexcept
+    {
+        return data_;
+    }
+
+    template <Int kCount>
+    inline InlineBuffer<kCount>
+    ::operator RWByteSpan() noexcept
+    {
+        return data_;
+    }
+
+    template <Int kCount>
+    [[nodiscard]] constexpr Mutable<Byte> InlineBuffer<kCount>
+    ::operator[](Bytes offset) noexcept
+    {
+        return data_[offset];
+    }
+
+    template <Int kCount>
+    [[nodiscard]] constexpr Immutable<Byte> InlineBuffer<kCount>
+    ::operator[](Bytes offset) const noexcept
+    {
+        return data_[offset];
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline BytePtr InlineBuffer<kCount>
+    ::GetData() const noexcept
+    {
+        return data_.GetData();
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline RWBytePtr InlineBuffer<kCount>
+    ::GetData() noexcept
+    {
+        return data_.GetData();
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline Bytes InlineBuffer<kCount>
+    ::GetCount() const noexcept
+    {
+        return data_.GetCount();
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline Bytes InlineBuffer<kCount>
+    ::GetCapacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline Immutable<Alignment> InlineBuffer<kCount>
+    ::GetAlignment() const noexcept
+    {
+        return alignment_;
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline Mutable<BaseAllocator> InlineBuffer<kCount>
+    ::GetAllocator() const noexcept
+    {
+        return *allocator_;
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline Bool InlineBuffer<kCount>
+    ::IsInline() const noexcept
+    {
+        return data_.GetData() == storage_;
+    }
+
+    template <Int kCount>
+    inline void InlineBuffer<kCount>
+    ::Reserve(Bytes capacity) noexcept
+    {
+        if (capacity > capacity_)
+        {
+            Reallocate(capacity);
+        }
+    }
+
+    template <Int kCount>
+    inline void InlineBuffer<kCount>
+    ::Resize(Bytes size) noexcept
+    {
+        if (size > capacity_)
+        {
+            Reserve(Math::Max(size, capacity_ * 2));
+        }
+
+        if (size > capacity_)
+        {
+            return;                                     // Out of memory.
+        }
+
+        auto count = data_.GetCount();
+
+        data_ = { data_.GetData(), size };
+
+        if (size > count)
+        {
+            Zero({ data_.GetData() + count, size - count });
+        }
+    }
+
+    template <Int kCount>
+    inline void InlineBuffer<kCount>
+    ::ShrinkToFit() noexcept
+    {
+        if (capacity_ > data_.GetCount())
+        {
+            Reallocate(data_.GetCount());
+        }
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline Bool InlineBuffer<kCount>
+    ::FitsInline(Bytes size) const noexcept
+    {
+        return (size <= ToBytes(kCount)) && (alignment_ <= MaxAlignment());
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline Bytes InlineBuffer<kCount>
+    ::GetInlineCapacity() const noexcept
+    {
+        return FitsInline(ToBytes(kCount)) ? ToBytes(kCount) : ToBytes(0);
+    }
+
+    template <Int kCount>
+    inline void InlineBuffer<kCount>
+    ::Reallocate(Bytes capacity) noexcept
+    {
+        auto block = RWByteSpan{ data_.GetData(), capacity_ };
+
+        if (FitsInline(capacity))
+        {
+            // Move the content back to the inline storage.
+
+            if (!IsInline())
+            {
+                data_ = { storage_, data_.GetCount() };
+                capacity_ = ToBytes(kCount);
+
+                Copy(data_, block);
+
+                allocator_->Deallocate(block, alignment_);
+            }
+
+            return;
+        }
+
+        // Attempt to resize the storage in-place first.
+
+        if (!IsInline() && allocator_->Reallocate(block, capacity, alignment_))
+        {
+            capacity_ = capacity;
+            return;
+        }
+
+        auto storage = allocator_->Allocate(capacity, alignment_);
+
+        SYNTROPY_ASSERT(storage.GetCount() == capacity);  // Out of memory?
+
+        if (storage.GetCount() == capacity)
+        {
+            auto count = data_.GetCount();
+
+            Copy(storage, data_);
+
+            Release();
+
+            data_ = { storage.GetData(), count };
+            capacity_ = capacity;
+        }
+    }
+
+    template <Int kCount>
+    inline void InlineBuffer<kCount>
+    ::Release() noexcept
+    {
+        if (!IsInline())
+        {
+            allocator_->Deallocate({ data_.GetData(), capacity_ },
+                                   alignment_);
+        }
+
+        data_ = { storage_, ToBytes(0) };
+        capacity_ = GetInlineCapacity();
+    }
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Ranges.
+    // =======
+
+    template <Int kCount>
+    [[nodiscard]] inline ByteSpan
+    ViewOf(Immutable<InlineBuffer<kCount>> buffer) noexcept
+    {
+        return buffer;
+    }
+
+    template <Int kCount>
+    [[nodiscard]] inline RWByteSpan
+    ViewOf(Mutable<InlineBuffer<kCount>> buffer) noexcept
+    {
+        return buffer;
+    }
+
+}
+
+// ===========================================================================
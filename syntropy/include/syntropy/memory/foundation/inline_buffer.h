@@ -0,0 +1,234 @@
+/// \file inline_buffer.h
+///
+/// \brief This header is part of the Syntropy memory module.
+///        It contains definitions for memory buffers with inline storage.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include <cstddef>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+// ===========================================================================
+
+namespace Syntropy::Memory
+{
+    /************************************************************************/
+    /* INLINE BUFFER <COUNT>                                                */
+    /************************************************************************/
+
+    /// \brief A contiguous sequence of bytes, stored inline up to kCount
+    ///        bytes.
+    ///
+    /// Memory is acquired from the allocator only when the buffer exceeds
+    /// its inline storage or requires an alignment stricter than
+    /// MaxAlignment(). BaseAllocator is set upon construction and is never
+    /// propagated.
+    ///
+    /// \author Raffaele D. Facendola - February 2021
+    template <Int kCount>
+    class InlineBuffer
+    {
+        static_assert(kCount > 0, "Inline storage cannot be empty.");
+
+    public:
+
+        /// \brief Create a new empty buffer on the current allocator.
+        InlineBuffer(Mutable<BaseAllocator> allocator
+                         = GetScopeAllocator()) noexcept;
+
+        /// \brief Create a new zero-initialized buffer on the current
+        ///        allocator.
+        InlineBuffer(Bytes size,
+                     Mutable<BaseAllocator> allocator
+                         = GetScopeAllocator()) noexcept;
+
+        /// \brief Create a new aligned zero-initialized buffer on the current
+        ///        allocator.
+        InlineBuffer(Bytes size,
+                     Alignment alignment,
+                     Mutable<BaseAllocator> allocator
+                         = GetScopeAllocator()) noexcept;
+
+        /// \brief Create a buffer which is a copy of rhs.
+        InlineBuffer(Immutable<InlineBuffer> rhs) noexcept;
+
+        /// \brief Create a buffer which is a copy of rhs with a different
+        ///        allocator.
+        InlineBuffer(Immutable<InlineBuffer> rhs,
+                     Mutable<BaseAllocator> allocator) noexcept;
+
+        /// \brief Create a buffer by acquiring the ownership of another
+        ///        buffer.
+        ///
+        /// Inline content is copied. After this method rhs is guaranteed
+        /// to be empty.
+        InlineBuffer(Movable<InlineBuffer> rhs) noexcept;
+
+        /// \brief Copy-assignment operator.
+        ///
+        /// The allocator is not propagated.
+        Mutable<InlineBuffer>
+        operator=(Immutable<InlineBuffer> rhs) noexcept;
+
+        /// \brief Move-assignment operator.
+        ///
+        /// The allocator is not propagated, therefore if rhs allocator is
+        /// different that this one's or rhs content is inline, this method
+        /// behaves as a copy-assignment.
+        Mutable<InlineBuffer>
+        operator=(Movable<InlineBuffer> rhs) noexcept;
+
+        /// \brief Destructor.
+        ~InlineBuffer() noexcept;
+
+        /// \brief Implicit conversion to ByteSpan.
+        operator ByteSpan() const noexcept;
+
+        /// \brief Implicit conversion to RWByteSpan.
+        operator RWByteSpan() noexcept;
+
+        /// \brief Access a byte by offset.
+        [[nodiscard]] constexpr Mutable<Byte>
+        operator[](Bytes offset) noexcept;
+
+        /// \brief Access a byte by offset.
+        [[nodiscard]] constexpr Immutable<Byte>
+        operator[](Bytes offset) const noexcept;
+
+        /// \brief Access buffer data.
+        [[nodiscard]] BytePtr
+        GetData() const noexcept;
+
+        /// \brief Access buffer data.
+        [[nodiscard]] RWBytePtr
+        GetData() noexcept;
+
+        /// \brief Get the number of bytes in the buffer.
+        [[nodiscard]] Bytes
+        GetCount() const noexcept;
+
+        /// \brief Get the number of bytes the buffer can hold without
+        ///        reallocating.
+        [[nodiscard]] Bytes
+        GetCapacity() const noexcept;
+
+        /// \brief Get buffer alignment.
+        [[nodiscard]] Immutable<Alignment>
+        GetAlignment() const noexcept;
+
+        /// \brief Get buffer allocator.
+        [[nodiscard]] Mutable<BaseAllocator>
+        GetAllocator() const noexcept;
+
+        /// \brief Check whether buffer content is stored inline.
+        [[nodiscard]] Bool
+        IsInline() const noexcept;
+
+        /// \brief Increase buffer capacity to at least the provided value.
+        ///
+        /// If the new capacity is not greater than the current one, this
+        /// method does nothing. The buffer content is preserved.
+        ///
+        /// \remarks This method invalidates spans to the buffer unless the
+        ///          allocator could grow the storage in-place.
+        void
+        Reserve(Bytes capacity) noexcept;
+
+        /// \brief Change the number of bytes in the buffer.
+        ///
+        /// Exceeding bytes are discarded, whereas new bytes are
+        /// zero-initialized. When the capacity is exceeded, the buffer
+        /// grows geometrically.
+        ///
+        /// \remarks This method invalidates spans to the buffer unless the
+        ///          allocator could grow the storage in-place.
+        void
+        Resize(Bytes size) noexcept;
+
+        /// \brief Release unused capacity, moving the content back to the
+        ///        inline storage if possible.
+        ///
+        /// \remarks This method invalidates spans to the buffer unless the
+        ///          allocator could shrink the storage in-place.
+        void
+        ShrinkToFit() noexcept;
+
+    private:
+
+        /// \brief Check whether a block of given size can be stored inline.
+        [[nodiscard]] Bool
+        FitsInline(Bytes size) const noexcept;
+
+        /// \brief Get the number of bytes the inline storage can hold.
+        ///
+        /// The inline storage can't hold any byte if the buffer alignment
+        /// is stricter than MaxAlignment().
+        [[nodiscard]] Bytes
+        GetInlineCapacity() const noexcept;
+
+        /// \brief Reallocate buffer storage with a new capacity, which
+        ///        shall not be lower than the buffer size.
+        void
+        Reallocate(Bytes capacity) noexcept;
+
+        /// \brief Return the allocated storage, if any, to the allocator
+        ///        and switch back to the inline storage.
+        void
+        Release() noexcept;
+
+        /// \brief Owning allocator.
+        RWPtr<BaseAllocator> allocator_{ nullptr };
+
+        /// \brief Buffer data.
+        RWByteSpan data_;
+
+        /// \brief Buffer capacity.
+        Bytes capacity_;
+
+        /// \brief Buffer alignment.
+        Alignment alignment_ = MaxAlignment();
+
+        /// \brief Inline storage.
+        alignas(std::max_align_t) Byte storage_[kCount];
+
+    };
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Ranges.
+    // =======
+
+    /// \brief Get a read-only view to a buffer.
+    template <Int kCount>
+    [[nodiscard]] ByteSpan
+    ViewOf(Immutable<InlineBuffer<kCount>> buffer) noexcept;
+
+    /// \brief Get a read-write view to a buffer.
+    template <Int kCount>
+    [[nodiscard]] RWByteSpan
+    ViewOf(Mutable<InlineBuffer<kCount>> buffer) noexcept;
+
+    /// \brief Prevent from getting a view to a temporary buffer.
+    template <Int kCount>
+    void
+    ViewOf(Immovable<InlineBuffer<kCount>> buffer) noexcept = delete;
+
+}
+
+// ===========================================================================
+
+#include "details/inline_buffer.inl"
+
+// ===========================================================================
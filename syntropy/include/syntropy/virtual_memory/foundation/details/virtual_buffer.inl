@@ -0,0 +1,123 @@
+/// \file virtual_buffer.inl
+///
+/// \author Raffaele D. Facendola - 2018
+
+#pragma once
+
+#include "syntropy/core/algorithms/swap.h"
+
+// ===========================================================================
+
+namespace Syntropy::VirtualMemory
+{
+    /************************************************************************/
+    /* VIRTUAL BUFFER                                                       */
+    /************************************************************************/
+
+    inline VirtualBuffer
+    ::VirtualBuffer(Memory::Bytes size) noexcept
+        : data_(Reserve(size))
+    {
+
+    }
+
+    inline VirtualBuffer
+    ::VirtualBuffer(Immutable<Memory::RWByteSpan> block) noexcept
+        : data_(block)
+    {
+
+    }
+
+    inline VirtualBuffer
+    ::VirtualBuffer(Movable<VirtualBuffer> rhs) noexcept
+    {
+        Algorithms::Swap(data_, rhs.data_);
+    }
+
+    inline VirtualBuffer
+    ::~VirtualBuffer() noexcept
+    {
+        Release(data_);
+    }
+
+    inline Mutable<VirtualBuffer> VirtualBuffer
+    ::operator=(VirtualBuffer rhs) noexcept
+    {
+        Swap(rhs);
+
+        return *this;
+    }
+
+    inline VirtualBuffer
+    ::operator Memory::ByteSpan() const noexcept
+    {
+        return data_;
+    }
+
+    inline VirtualBuffer
+    ::operator Memory::RWByteSpan() noexcept
+    {
+        return data_;
+    }
+
+    [[nodiscard]] inline Memory::BytePtr VirtualBuffer
+    ::GetData() const noexcept
+    {
+        return data_.GetData();
+    }
+
+    [[nodiscard]] inline Memory::RWBytePtr VirtualBuffer
+    ::GetData() noexcept
+    {
+        return data_.GetData();
+    }
+
+    [[nodiscard]] inline Memory::Bytes VirtualBuffer
+    ::GetCount() const noexcept
+    {
+        return data_.GetCount();
+    }
+
+    inline void VirtualBuffer
+    ::Swap(Mutable<VirtualBuffer> rhs) noexcept
+    {
+        Algorithms::Swap(data_, rhs.data_);
+    }
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Ranges.
+    // =======
+
+    [[nodiscard]] inline Memory::ByteSpan
+    ViewOf(Immutable<VirtualBuffer> buffer) noexcept
+    {
+        return buffer;
+    }
+
+    [[nodiscard]] inline Memory::RWByteSpan
+    ViewOf(Mutable<VirtualBuffer> buffer) noexcept
+    {
+        return buffer;
+    }
+
+    // Virtual memory.
+    // ===============
+
+    inline Bool
+    Commit(Mutable<VirtualBuffer> buffer, CommitMode mode) noexcept
+    {
+        return Commit(ViewOf(buffer), mode);
+    }
+
+    inline Bool
+    Decommit(Mutable<VirtualBuffer> buffer) noexcept
+    {
+        return Decommit(ViewOf(buffer));
+    }
+
+}
+
+// ===========================================================================
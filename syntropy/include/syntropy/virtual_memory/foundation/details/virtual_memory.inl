@@ -0,0 +1,43 @@
+/// \file virtual_memory.inl
+///
+/// \author Raffaele D. Facendola - 2017
+
+#pragma once
+
+#include "syntropy/math/math.h"
+
+// ===========================================================================
+
+namespace Syntropy::VirtualMemory
+{
+    /************************************************************************/
+    /* VIRTUAL MEMORY                                                       */
+    /************************************************************************/
+
+    [[nodiscard]] inline Memory::Bytes
+    Floor(Memory::Bytes rhs) noexcept
+    {
+        return Math::Floor(rhs, GetPageSize());
+    }
+
+    [[nodiscard]] inline Memory::Alignment
+    Floor(Memory::Alignment rhs) noexcept
+    {
+        return Math::Min(rhs, GetPageAlignment());
+    }
+
+    [[nodiscard]] inline Memory::Bytes
+    Ceil(Memory::Bytes rhs) noexcept
+    {
+        return Math::Ceil(rhs, GetPageSize());
+    }
+
+    [[nodiscard]] inline Memory::Alignment
+    Ceil(Memory::Alignment rhs) noexcept
+    {
+        return Math::Max(rhs, GetPageAlignment());
+    }
+
+}
+
+// ===========================================================================
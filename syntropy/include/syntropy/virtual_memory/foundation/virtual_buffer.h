@@ -0,0 +1,142 @@
+/// \file virtual_buffer.h
+///
+/// \brief This header is part of the Syntropy virtual memory module.
+///        It contains classes and functionalities for automatic virtual
+///        memory management.
+///
+/// \author Raffaele D. Facendola - 2018
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+
+// ===========================================================================
+
+namespace Syntropy::VirtualMemory
+{
+    /************************************************************************/
+    /* VIRTUAL BUFFER                                                       */
+    /************************************************************************/
+
+    /// \brief A raw buffer mapped to virtual memory which is reserved
+    ///        during construction and released upon destruction.
+    ///
+    /// Buffer ownership is exclusive and can only be moved to other virtual
+    /// memory buffers. The buffer is aligned to system virtual memory page
+    /// boundary.
+    ///
+    /// \author Raffaele D. Facendola - August 2018
+    class VirtualBuffer
+    {
+    public:
+
+        /// \brief Create a new empty virtual memory buffer.
+        VirtualBuffer() noexcept = default;
+
+        /// \brief Reserve a virtual memory buffer.
+        ///
+        /// \remarks The buffer starts uncommitted.
+        explicit
+        VirtualBuffer(Memory::Bytes size) noexcept;
+
+        /// \brief Take ownership of a virtual memory block.
+        ///
+        /// \remarks If the provided block wasn't allocated from system
+        ///          virtual memory, the behavior of this method is undefined.
+        explicit
+        VirtualBuffer(Immutable<Memory::RWByteSpan> block) noexcept;
+
+        /// \brief No copy constructor.
+        VirtualBuffer(Immutable<VirtualBuffer>) = delete;
+
+        /// \brief Create a buffer by acquiring the ownership of another
+        ///        buffer.
+        ///
+        /// After this method rhs is guaranteed to be empty.
+        VirtualBuffer(Movable<VirtualBuffer> rhs) noexcept;
+
+        /// \brief Release reserved virtual memory.
+        ~VirtualBuffer() noexcept;
+
+        /// \brief Unified assignment operator.
+        Mutable<VirtualBuffer>
+        operator=(VirtualBuffer rhs) noexcept;
+
+        /// \brief Implicit conversion to ByteSpan.
+        operator Memory::ByteSpan() const noexcept;
+
+        /// \brief Implicit conversion to RWByteSpan.
+        operator Memory::RWByteSpan() noexcept;
+
+        /// \brief Access buffer data.
+        [[nodiscard]] Memory::BytePtr
+        GetData() const noexcept;
+
+        /// \brief Access buffer data.
+        [[nodiscard]] Memory::RWBytePtr
+        GetData() noexcept;
+
+        /// \brief Get the number of bytes in the buffer.
+        [[nodiscard]] Memory::Bytes
+        GetCount() const noexcept;
+
+        /// \brief Swap the content of two buffers.
+        void
+        Swap(Mutable<VirtualBuffer> rhs) noexcept;
+
+    private:
+
+        /// \brief Underlying virtual memory block.
+        Memory::RWByteSpan data_;
+
+    };
+
+    /************************************************************************/
+    /* NON-MEMBER FUNCTIONS                                                 */
+    /************************************************************************/
+
+    // Ranges.
+    // =======
+
+    /// \brief Get a read-only view to a virtual buffer.
+    [[nodiscard]] Memory::ByteSpan
+    ViewOf(Immutable<VirtualBuffer> buffer) noexcept;
+
+    /// \brief Get a read-write view to a virtual buffer.
+    [[nodiscard]] Memory::RWByteSpan
+    ViewOf(Mutable<VirtualBuffer> buffer) noexcept;
+
+    /// \brief Prevent from getting a view to a temporary virtual buffer.
+    void
+    ViewOf(Immovable<VirtualBuffer> buffer) noexcept = delete;
+
+    // Virtual memory.
+    // ===============
+
+    /// \brief Commit a virtual memory buffer.
+    ///
+    /// \return Returns true if the memory could be committed, returns false
+    ///         otherwise.
+    Bool
+    Commit(Mutable<VirtualBuffer> buffer,
+           CommitMode mode = CommitMode::kDefault) noexcept;
+
+    /// \brief Decommit a virtual memory buffer.
+    ///
+    /// \return Returns true if the memory could be decommitted, returns
+    ///         false otherwise.
+    Bool
+    Decommit(Mutable<VirtualBuffer> buffer) noexcept;
+
+}
+
+// ===========================================================================
+
+#include "details/virtual_buffer.inl"
+
+// ===========================================================================
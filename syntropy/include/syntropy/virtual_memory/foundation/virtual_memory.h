@@ -0,0 +1,160 @@
+/// \file virtual_memory.h
+///
+/// \brief This header is part of the Syntropy virtual memory module.
+///        It contains functionalities used to manage virtual memory.
+///
+/// \author Raffaele D. Facendola - 2017
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+// ===========================================================================
+
+namespace Syntropy::VirtualMemory
+{
+    /************************************************************************/
+    /* COMMIT MODE                                                          */
+    /************************************************************************/
+
+    /// \brief Policy used to back committed virtual memory pages.
+    enum class CommitMode : Enum8
+    {
+        /// \brief Pages are backed by system's default page size.
+        kDefault = 0,
+
+        /// \brief Pages are backed by huge pages, where supported.
+        ///
+        /// \remarks This mode is a hint: platforms that don't support
+        ///          transparent huge pages fall back to kDefault.
+        ///          Huge pages are effective only on ranges aligned
+        ///          to the system huge page size.
+        kHugePages = 1,
+    };
+
+    /************************************************************************/
+    /* VIRTUAL MEMORY                                                       */
+    /************************************************************************/
+
+    /// \brief Get the virtual memory page size.
+    [[nodiscard]] Memory::Bytes
+    GetPageSize() noexcept;
+
+    /// \brief Get the virtual memory page alignment.
+    [[nodiscard]] Memory::Alignment
+    GetPageAlignment() noexcept;
+
+    /// \brief Reserve a range of virtual memory addresses.
+    ///
+    /// Reserved memory region must be committed via Commit() before
+    /// accessing it. Reserving memory doesn't consume physical memory.
+    ///
+    /// \return Returns the reserved memory range. If the method fails
+    ///         returns an empty range.
+    [[nodiscard]] Memory::RWByteSpan
+    Reserve(Memory::Bytes size) noexcept;
+
+    /// \brief Allocate a range of virtual memory addresses.
+    ///
+    /// This method has the same effect as a Reserve() followed by a Commit().
+    ///
+    /// \return Returns the allocated memory range. If the method fails
+    ///         returns an empty range.
+    [[nodiscard]] Memory::RWByteSpan
+    Allocate(Memory::Bytes size) noexcept;
+
+    /// \brief Release a range of virtual memory addresses.
+    ///
+    /// \return Returns true if the range could be released, returns false
+    ///         otherwise.
+    /// \remarks The provided block must match a value returned by a
+    ///          previous call to Reserve() or Allocate(), otherwise the
+    ///          behavior of this method is undefined.
+    Bool
+    Release(Immutable<Memory::RWByteSpan> block) noexcept;
+
+    /// \brief Commit a reserved virtual memory block.
+    ///
+    /// This method commits all the pages containing at least one byte in
+    /// the provided range and makes them accessible by the application.
+    /// Physical memory is acquired lazily, upon first access to each page.
+    ///
+    /// \return Returns true if the memory could be committed, returns false
+    ///         otherwise.
+    /// \remarks The provided block must refer to a memory region that was
+    ///          previously reserved via Reserve().
+    Bool
+    Commit(Immutable<Memory::RWByteSpan> block,
+           CommitMode mode = CommitMode::kDefault) noexcept;
+
+    /// \brief Decommit a virtual memory block.
+    ///
+    /// This method decommits all the pages containing at least one byte in
+    /// the provided range, returning the physical memory to the system.
+    /// Address space is preserved and can be committed again.
+    ///
+    /// \return Returns true if the memory could be decommitted, returns
+    ///         false otherwise.
+    Bool
+    Decommit(Immutable<Memory::RWByteSpan> block) noexcept;
+
+    /// \brief Get the number of NUMA nodes available to the process.
+    ///
+    /// Nodes are identified by an index in [0; GetNodeCount()). On
+    /// systems without NUMA support this method returns 1.
+    [[nodiscard]] Int
+    GetNodeCount() noexcept;
+
+    /// \brief Get the NUMA node of the processor running the calling
+    ///        thread.
+    ///
+    /// \remarks Threads may migrate between processors at any time,
+    ///          therefore the returned value is a hint.
+    [[nodiscard]] Int
+    GetCurrentNode() noexcept;
+
+    /// \brief Set the NUMA node physical pages backing a virtual memory
+    ///        block are preferably acquired from.
+    ///
+    /// This method affects all the pages containing at least one byte in
+    /// the provided range which were not accessed yet. If the preferred
+    /// node is exhausted, pages are acquired from other nodes.
+    ///
+    /// \return Returns true if the preferred node could be set, returns
+    ///         false otherwise.
+    /// \remarks The provided block must refer to a committed memory
+    ///          region.
+    Bool
+    Bind(Immutable<Memory::RWByteSpan> block, Int node) noexcept;
+
+    /// \brief Get the greatest size equal-to or smaller-than rhs which is
+    ///        also a multiple of the virtual memory page size.
+    [[nodiscard]] Memory::Bytes
+    Floor(Memory::Bytes rhs) noexcept;
+
+    /// \brief Get the greatest alignment equal-to or smaller-than rhs which
+    ///        also satisfies virtual memory page alignment.
+    [[nodiscard]] Memory::Alignment
+    Floor(Memory::Alignment rhs) noexcept;
+
+    /// \brief Get the smallest size equal-to or greater-than rhs which is
+    ///        also a multiple of the virtual memory page size.
+    [[nodiscard]] Memory::Bytes
+    Ceil(Memory::Bytes rhs) noexcept;
+
+    /// \brief Get the smallest alignment equal-to or greater-than rhs which
+    ///        also satisfies virtual memory page alignment.
+    [[nodiscard]] Memory::Alignment
+    Ceil(Memory::Alignment rhs) noexcept;
+
+}
+
+// ===========================================================================
+
+#include "details/virtual_memory.inl"
+
+// ===========================================================================
@@ -0,0 +1,345 @@
+/// \file label.cpp
+///
+/// \author Raffaele D. Facendola - 2021
+
+#include "syntropy/core/strings/label.h"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+#include "syntropy/memory/foundation/memory.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/allocators/virtual_stack_allocator.h"
+
+#include "syntropy/diagnostics/foundation/assert.h"
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* LABEL :: REGISTRY                                                    */
+    /************************************************************************/
+
+    /// \brief Process-wide registry of interned labels.
+    ///
+    /// The registry is split in shards, selected by label hash. Each shard
+    /// is an open-addressing table of entries, whose code-units are stored
+    /// on a virtual stack owned by the shard.
+    ///
+    /// Lookups are lock-free. Insertions lock the shard and publish new
+    /// entries and tables atomically, such that concurrent lookups always
+    /// observe a consistent table. Tables outgrown by their shard are
+    /// never deallocated, since lookups may still be reading them.
+    ///
+    /// \author Raffaele D. Facendola - May 2021
+    class Label::Registry
+    {
+    public:
+
+        /// \brief Get the singleton instance.
+        [[nodiscard]] static Mutable<Registry>
+        GetSingleton() noexcept;
+
+        /// \brief Intern a sequence of code-units, given its hash.
+        ///
+        /// \return Returns the interned entry. If the shard ran out of
+        ///         storage, returns nullptr.
+        [[nodiscard]] Ptr<Entry>
+        Insert(Immutable<Memory::ByteSpan> code_units, Int hash) noexcept;
+
+    private:
+
+        /// \brief An open-addressing table of entries.
+        struct Table
+        {
+            /// \brief Number of slots. Always a power of two.
+            Int slot_count_;
+
+            /// \brief Slots, either empty or pointing to an entry.
+            RWPtr<std::atomic<Ptr<Entry>>> slots_;
+        };
+
+        /// \brief A fraction of the registry.
+        struct alignas(64) Shard
+        {
+            /// \brief Create an empty shard.
+            Shard() noexcept;
+
+            /// \brief Lock guarding insertions.
+            std::mutex mutex_;
+
+            /// \brief Storage for entries and tables.
+            Memory::VirtualStackAllocator storage_;
+
+            /// \brief Current table. Allocated on first insertion.
+            std::atomic<RWPtr<Table>> table_{ nullptr };
+
+            /// \brief Number of entries in the shard.
+            Int count_{ 0 };
+        };
+
+        /// \brief Number of shards.
+        static constexpr Int
+        kShardCount = 16;
+
+        /// \brief Virtual memory reserved by each shard.
+        static constexpr Int
+        kShardCapacity = Int{ 1 } << 26;
+
+        /// \brief Commit granularity of each shard.
+        static constexpr Int
+        kShardGranularity = Int{ 1 } << 16;
+
+        /// \brief Number of slots in the first table of each shard.
+        static constexpr Int
+        kSlotCount = 256;
+
+        /// \brief Private constructor.
+        Registry() noexcept = default;
+
+        /// \brief Find an entry in a table.
+        ///
+        /// \return Returns the entry matching the provided code-units, if
+        ///         any, otherwise returns nullptr.
+        [[nodiscard]] static Ptr<Entry>
+        Find(Immutable<Table> table,
+             Int hash,
+             Immutable<Memory::ByteSpan> code_units) noexcept;
+
+        /// \brief Store an entry in the first free slot of a table.
+        static void
+        Store(Immutable<Table> table, Ptr<Entry> entry) noexcept;
+
+        /// \brief Allocate a new empty table on a shard.
+        ///
+        /// \return Returns the new table. If the shard ran out of storage,
+        ///         returns nullptr.
+        [[nodiscard]] static RWPtr<Table>
+        AllocateTable(Mutable<Shard> shard, Int slot_count) noexcept;
+
+        /// \brief Replace the table of a shard with a larger one.
+        ///
+        /// \return Returns true if the table could be replaced, returns
+        ///         false if the shard ran out of storage.
+        ///
+        /// \remarks The caller must hold the shard lock.
+        [[nodiscard]] static Bool
+        Grow(Mutable<Shard> shard) noexcept;
+
+        /// \brief Registry shards.
+        Shard shards_[kShardCount];
+
+    };
+
+    /************************************************************************/
+
+    Label::Registry::Shard
+    ::Shard() noexcept
+        : storage_(Memory::ToBytes(kShardCapacity),
+                   Memory::ToBytes(kShardGranularity))
+    {
+
+    }
+
+    [[nodiscard]] Mutable<Label::Registry> Label::Registry
+    ::GetSingleton() noexcept
+    {
+        static auto singleton = Registry();
+
+        return singleton;
+    }
+
+    [[nodiscard]] Ptr<Label::Entry> Label::Registry
+    ::Insert(Immutable<Memory::ByteSpan> code_units, Int hash) noexcept
+    {
+        // Low bits of the hash select the slot, high bits the shard.
+
+        auto& shard = shards_[(hash >> 32) & (kShardCount - 1)];
+
+        if (auto table = shard.table_.load(std::memory_order_acquire))
+        {
+            if (auto entry = Find(*table, hash, code_units))
+            {
+                return entry;
+            }
+        }
+
+        auto lock = std::lock_guard<std::mutex>(shard.mutex_);
+
+        // The label may have been interned before acquiring the lock.
+
+        auto table = shard.table_.load(std::memory_order_relaxed);
+
+        if (!table)
+        {
+            table = AllocateTable(shard, kSlotCount);
+
+            if (!table)
+            {
+                return nullptr;
+            }
+
+            shard.table_.store(table, std::memory_order_release);
+        }
+        else if (auto entry = Find(*table, hash, code_units))
+        {
+            return entry;
+        }
+
+        // Keep the load factor at 3/4 at most.
+
+        if (((shard.count_ + 1) * 4 > table->slot_count_ * 3) &&
+            !Grow(shard))
+        {
+            return nullptr;
+        }
+
+        auto count = code_units.GetCount();
+
+        auto storage = shard.storage_.Allocate(
+            Memory::SizeOf<Entry>() + count,
+            Memory::AlignmentOf<Entry>());
+
+        if (!storage)
+        {
+            return nullptr;
+        }
+
+        auto entry = Memory::FromBytePtr<Entry>(storage.GetData());
+
+        new (entry) Entry{ hash, Memory::ToInt(count) };
+
+        Memory::Copy(Memory::MakeByteSpan(Memory::ToBytePtr(entry + 1),
+                                          count),
+                     code_units);
+
+        Store(*shard.table_.load(std::memory_order_relaxed), entry);
+
+        ++shard.count_;
+
+        return entry;
+    }
+
+    [[nodiscard]] Ptr<Label::Entry> Label::Registry
+    ::Find(Immutable<Table> table,
+           Int hash,
+           Immutable<Memory::ByteSpan> code_units) noexcept
+    {
+        auto count = Memory::ToInt(code_units.GetCount());
+
+        for (auto index = hash & (table.slot_count_ - 1); ;
+             index = (index + 1) & (table.slot_count_ - 1))
+        {
+            auto entry = table.slots_[index].load(std::memory_order_acquire);
+
+            if (!entry)
+            {
+                return nullptr;
+            }
+
+            if ((entry->hash_ == hash) &&
+                (entry->count_ == count) &&
+                (std::memcmp(entry + 1, code_units.GetData(), count) == 0))
+            {
+                return entry;
+            }
+        }
+    }
+
+    void Label::Registry
+    ::Store(Immutable<Table> table, Ptr<Entry> entry) noexcept
+    {
+        auto index = entry->hash_ & (table.slot_count_ - 1);
+
+        while (table.slots_[index].load(std::memory_order_relaxed))
+        {
+            index = (index + 1) & (table.slot_count_ - 1);
+        }
+
+        table.slots_[index].store(entry, std::memory_order_release);
+    }
+
+    [[nodiscard]] RWPtr<Label::Registry::Table> Label::Registry
+    ::AllocateTable(Mutable<Shard> shard, Int slot_count) noexcept
+    {
+        using TSlot = std::atomic<Ptr<Entry>>;
+
+        auto table_storage = shard.storage_.Allocate(
+            Memory::SizeOf<Table>(),
+            Memory::AlignmentOf<Table>());
+
+        auto slots_storage = shard.storage_.Allocate(
+            Memory::SizeOf<TSlot>() * slot_count,
+            Memory::AlignmentOf<TSlot>());
+
+        if (!table_storage || !slots_storage)
+        {
+            return nullptr;
+        }
+
+        auto slots = Memory::FromBytePtr<TSlot>(slots_storage.GetData());
+
+        for (auto index = Int{ 0 }; index < slot_count; ++index)
+        {
+            new (slots + index) TSlot{ nullptr };
+        }
+
+        auto table = Memory::FromBytePtr<Table>(table_storage.GetData());
+
+        return new (table) Table{ slot_count, slots };
+    }
+
+    [[nodiscard]] Bool Label::Registry
+    ::Grow(Mutable<Shard> shard) noexcept
+    {
+        auto& table = *shard.table_.load(std::memory_order_relaxed);
+
+        auto next_table = AllocateTable(shard, table.slot_count_ * 2);
+
+        if (!next_table)
+        {
+            return false;
+        }
+
+        for (auto index = Int{ 0 }; index < table.slot_count_; ++index)
+        {
+            if (auto entry = table.slots_[index].load(
+                    std::memory_order_relaxed))
+            {
+                Store(*next_table, entry);
+            }
+        }
+
+        // Lookups still reading the old table either find the entry they
+        // are looking for or fall back to the locked path.
+
+        shard.table_.store(next_table, std::memory_order_release);
+
+        return true;
+    }
+
+    /************************************************************************/
+    /* LABEL                                                                */
+    /************************************************************************/
+
+    [[nodiscard]] Ptr<Label::Entry> Label
+    ::Intern(Immutable<Memory::ByteSpan> code_units, Int hash) noexcept
+    {
+        if (!code_units)
+        {
+            return GetEmpty();
+        }
+
+        auto entry = Registry::GetSingleton().Insert(code_units, hash);
+
+        SYNTROPY_ASSERT(entry);                 // Out of label storage?
+
+        return entry;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,422 @@
+
+/// \file string_algorithm.cpp
+///
+/// \author Raffaele D. Facendola - 2021
+
+#include "syntropy/core/strings/string_algorithm.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "syntropy/hal/hal_search.h"
+
+// ===========================================================================
+
+namespace Syntropy::Strings
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+        /// \brief Number of false candidates tolerated before a search
+        ///        falls back to the Two-Way algorithm.
+        constexpr auto kMaxFalseCandidates = Int{ 64 };
+
+        /// \brief Get the suffix of a sequence starting from a position.
+        [[nodiscard]] Memory::ByteSpan
+        SuffixOf(Immutable<Memory::ByteSpan> code_units, Int index) noexcept
+        {
+            auto data = code_units.GetData();
+
+            return Memory::MakeByteSpan(data + index,
+                                        data + ToInt(code_units.GetCount()));
+        }
+
+        /// \brief Access the code-units in a sequence as unsigned values.
+        [[nodiscard]] Ptr<std::uint8_t>
+        GetData(Immutable<Memory::ByteSpan> code_units) noexcept
+        {
+            return reinterpret_cast<Ptr<std::uint8_t>>(code_units.GetData());
+        }
+
+        /// \brief Critical factorization of a pattern.
+        struct Factorization
+        {
+            /// \brief Position of the critical factorization.
+            Int position_;
+
+            /// \brief Period of the right half of the pattern.
+            Int period_;
+        };
+
+        /// \brief Find the maximal suffix of a pattern, according to either
+        ///        the natural or the reversed order of code-units.
+        [[nodiscard]] Factorization
+        FindMaximalSuffix(Ptr<std::uint8_t> pattern,
+                          Int pattern_size,
+                          Bool reversed) noexcept
+        {
+            auto suffix = Int{ -1 };
+            auto index = Int{ 0 };
+            auto offset = Int{ 1 };
+            auto period = Int{ 1 };
+
+            while (index + offset < pattern_size)
+            {
+                auto lhs = pattern[index + offset];
+                auto rhs = pattern[suffix + offset];
+
+                if (lhs == rhs)
+                {
+                    // Advance through the current period.
+
+                    if (offset != period)
+                    {
+                        ++offset;
+                    }
+                    else
+                    {
+                        index += period;
+                        offset = 1;
+                    }
+                }
+                else if ((lhs < rhs) != reversed)
+                {
+                    // The suffix is still maximal, its period grows.
+
+                    index += offset;
+                    offset = 1;
+                    period = index - suffix;
+                }
+                else
+                {
+                    // A greater suffix starts here.
+
+                    suffix = index++;
+                    offset = 1;
+                    period = 1;
+                }
+            }
+
+            return { suffix + 1, period };
+        }
+
+        /// \brief Find a pattern in a sequence via Crochemore and Perrin's
+        ///        Two-Way algorithm, in linear time and constant space.
+        ///
+        /// \return Returns the position of the first occurrence of pattern,
+        ///         or the number of code-units if there's none.
+        [[nodiscard]] Int
+        FindTwoWay(Immutable<Memory::ByteSpan> code_units,
+                   Immutable<Memory::ByteSpan> pattern) noexcept
+        {
+            auto data = GetData(code_units);
+            auto size = ToInt(code_units.GetCount());
+
+            auto pattern_data = GetData(pattern);
+            auto pattern_size = ToInt(pattern.GetCount());
+
+            // The critical factorization is the later of the two maximal
+            // suffixes.
+
+            auto natural = FindMaximalSuffix(pattern_data,
+                                             pattern_size,
+                                             false);
+
+            auto reversed = FindMaximalSuffix(pattern_data,
+                                              pattern_size,
+                                              true);
+
+            auto factorization = (natural.position_ > reversed.position_)
+                ? natural
+                : reversed;
+
+            auto critical = factorization.position_;
+            auto period = factorization.period_;
+
+            if (std::memcmp(pattern_data,
+                            pattern_data + period,
+                            critical) == 0)
+            {
+                // Periodic pattern: the prefix matched by the last
+                // attempt is remembered, so that no code-unit is compared
+                // twice.
+
+                auto memory = Int{ 0 };
+
+                for (auto index = Int{ 0 }; index + pattern_size <= size;)
+                {
+                    auto right = (critical > memory) ? critical : memory;
+
+                    while ((right < pattern_size) &&
+                           (pattern_data[right] == data[index + right]))
+                    {
+                        ++right;
+                    }
+
+                    if (right < pattern_size)
+                    {
+                        index += right - critical + 1;
+                        memory = 0;
+                        continue;
+                    }
+
+                    auto left = critical - 1;
+
+                    while ((left >= memory) &&
+                           (pattern_data[left] == data[index + left]))
+                    {
+                        --left;
+                    }
+
+                    if (left < memory)
+                    {
+                        return index;
+                    }
+
+                    index += period;
+                    memory = pattern_size - period;
+                }
+            }
+            else
+            {
+                // Non-periodic pattern: mismatches on the left half shift
+                // past the longer half.
+
+                period = ((critical > pattern_size - critical)
+                    ? critical
+                    : (pattern_size - critical)) + 1;
+
+                for (auto index = Int{ 0 }; index + pattern_size <= size;)
+                {
+                    auto right = critical;
+
+                    while ((right < pattern_size) &&
+                           (pattern_data[right] == data[index + right]))
+                    {
+                        ++right;
+                    }
+
+                    if (right < pattern_size)
+                    {
+                        index += right - critical + 1;
+                        continue;
+                    }
+
+                    auto left = critical - 1;
+
+                    while ((left >= 0) &&
+                           (pattern_data[left] == data[index + left]))
+                    {
+                        --left;
+                    }
+
+                    if (left < 0)
+                    {
+                        return index;
+                    }
+
+                    index += period;
+                }
+            }
+
+            return size;
+        }
+
+        /// \brief Find a pattern in a sequence.
+        ///
+        /// Candidates are located by matching the first and last code-unit
+        /// of the pattern in bulk, and then verified. Should candidates
+        /// turn out false too often, as in highly repetitive sequences,
+        /// the search falls back to the Two-Way algorithm, which bounds
+        /// the worst case to a linear number of comparisons.
+        ///
+        /// \return Returns the position of the first occurrence of pattern,
+        ///         or the number of code-units if there's none.
+        [[nodiscard]] Int
+        FindIndex(Immutable<Memory::ByteSpan> code_units,
+                  Immutable<Memory::ByteSpan> pattern) noexcept
+        {
+            auto size = ToInt(code_units.GetCount());
+            auto pattern_size = ToInt(pattern.GetCount());
+
+            if (pattern_size == 0)
+            {
+                return 0;
+            }
+
+            if (pattern_size > size)
+            {
+                return size;
+            }
+
+            if (pattern_size == 1)
+            {
+                return HAL::Search::FindAnyOf(code_units, pattern);
+            }
+
+            auto data = GetData(code_units);
+            auto pattern_data = GetData(pattern);
+
+            auto first = pattern[Memory::ToBytes(0)];
+            auto last = pattern[Memory::ToBytes(pattern_size - 1)];
+
+            auto false_candidates = Int{ 0 };
+
+            for (auto index = Int{ 0 }; index + pattern_size <= size;)
+            {
+                index += HAL::Search::FindPair(SuffixOf(code_units, index),
+                                               first,
+                                               last,
+                                               pattern_size - 1);
+
+                if (index + pattern_size > size)
+                {
+                    break;
+                }
+
+                // First and last code-units are known to match.
+
+                if (std::memcmp(data + index + 1,
+                                pattern_data + 1,
+                                pattern_size - 2) == 0)
+                {
+                    return index;
+                }
+
+                if (++false_candidates > kMaxFalseCandidates)
+                {
+                    return index + FindTwoWay(
+                        SuffixOf(code_units, index + 1), pattern) + 1;
+                }
+
+                ++index;
+            }
+
+            return size;
+        }
+    }
+
+    /************************************************************************/
+    /* STRING ALGORITHM                                                     */
+    /************************************************************************/
+
+    // Search.
+    // =======
+
+    [[nodiscard]] Memory::ByteSpan
+    Find(Immutable<Memory::ByteSpan> code_units,
+         Immutable<Memory::ByteSpan> pattern) noexcept
+    {
+        return SuffixOf(code_units, FindIndex(code_units, pattern));
+    }
+
+    [[nodiscard]] Memory::ByteSpan
+    FindAnyOf(Immutable<Memory::ByteSpan> code_units,
+              Immutable<Memory::ByteSpan> set) noexcept
+    {
+        return SuffixOf(code_units, HAL::Search::FindAnyOf(code_units, set));
+    }
+
+    // Comparison.
+    // ===========
+
+    [[nodiscard]] Ordering
+    CompareIgnoreCase(Immutable<StringView> lhs,
+                      Immutable<StringView> rhs) noexcept
+    {
+        auto lhs_code_units = lhs.GetCodeUnits();
+        auto rhs_code_units = rhs.GetCodeUnits();
+
+        auto lhs_size = ToInt(lhs_code_units.GetCount());
+        auto rhs_size = ToInt(rhs_code_units.GetCount());
+
+        auto index = HAL::Search::FindMismatchIgnoreCase(lhs_code_units,
+                                                         rhs_code_units);
+
+        if ((index < lhs_size) && (index < rhs_size))
+        {
+            auto to_lower = [](std::uint8_t code_unit)
+            {
+                auto is_upper = (code_unit >= 'A') && (code_unit <= 'Z');
+
+                return is_upper ? (code_unit | 0x20) : code_unit;
+            };
+
+            auto lhs_code_unit = to_lower(GetData(lhs_code_units)[index]);
+            auto rhs_code_unit = to_lower(GetData(rhs_code_units)[index]);
+
+            return (lhs_code_unit < rhs_code_unit) ? Ordering::kLess
+                                                   : Ordering::kGreater;
+        }
+
+        if (lhs_size < rhs_size)
+        {
+            return Ordering::kLess;
+        }
+
+        if (lhs_size > rhs_size)
+        {
+            return Ordering::kGreater;
+        }
+
+        return Ordering::kEquivalent;
+    }
+
+}
+
+// ===========================================================================
+
+namespace Syntropy
+{
+    /************************************************************************/
+    /* SPLIT RANGE                                                          */
+    /************************************************************************/
+
+    SplitRange
+    ::SplitRange(Immutable<Memory::ByteSpan> code_units,
+                 Immutable<Memory::ByteSpan> delimiters,
+                 Bool skip_empty) noexcept
+        : code_units_(code_units)
+        , delimiters_(delimiters)
+        , is_empty_(false)
+        , skip_empty_(skip_empty)
+    {
+        front_count_ = HAL::Search::FindAnyOf(code_units_, delimiters_);
+
+        // Empty views are skipped one delimiter at a time.
+
+        while (skip_empty_ && (front_count_ == 0))
+        {
+            if (!code_units_)
+            {
+                is_empty_ = true;
+                break;
+            }
+
+            code_units_ = Strings::SuffixOf(code_units_, 1);
+
+            front_count_ = HAL::Search::FindAnyOf(code_units_, delimiters_);
+        }
+    }
+
+    [[nodiscard]] SplitRange SplitRange
+    ::PopFront() const noexcept
+    {
+        // The last view is not followed by any delimiter.
+
+        if (front_count_ == ToInt(code_units_.GetCount()))
+        {
+            return SplitRange{};
+        }
+
+        return SplitRange{ Strings::SuffixOf(code_units_, front_count_ + 1),
+                           delimiters_,
+                           skip_empty_ };
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,390 @@
+
+/// \file unicode.cpp
+///
+/// \author Raffaele D. Facendola - 2021
+
+#include "syntropy/core/strings/unicode.h"
+
+#include <cstdint>
+
+#include "syntropy/hal/hal_unicode.h"
+
+// ===========================================================================
+
+namespace Syntropy::Strings
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+        /// \brief Code-point replacing ill-formed input.
+        constexpr auto kReplacement = char32_t{ 0xFFFD };
+
+        /// \brief Get the number of UTF-8 code-units needed to encode a
+        ///        code-point.
+        [[nodiscard]] Int
+        GetUTF8Length(char32_t code_point) noexcept
+        {
+            if (code_point < 0x80)
+            {
+                return 1;
+            }
+
+            if (code_point < 0x800)
+            {
+                return 2;
+            }
+
+            if ((code_point < 0x10000) || (code_point > 0x10FFFF))
+            {
+                return 3;                   // Invalid values are replaced.
+            }
+
+            return 4;
+        }
+
+        /// \brief Encode a code-point to UTF-8.
+        ///
+        /// \remarks Destination must fit the encoded code-point.
+        /// \return Returns the number of code-units written.
+        Int
+        EncodeUTF8(char32_t code_point, RWPtr<std::uint8_t> destination)
+            noexcept
+        {
+            if (((code_point >= 0xD800) && (code_point <= 0xDFFF))
+                || (code_point > 0x10FFFF))
+            {
+                code_point = kReplacement;
+            }
+
+            switch (GetUTF8Length(code_point))
+            {
+                case 1:
+                {
+                    destination[0] = static_cast<std::uint8_t>(code_point);
+
+                    return 1;
+                }
+
+                case 2:
+                {
+                    destination[0] = static_cast<std::uint8_t>(
+                        0xC0 | (code_point >> 6));
+
+                    destination[1] = static_cast<std::uint8_t>(
+                        0x80 | (code_point & 0x3F));
+
+                    return 2;
+                }
+
+                case 3:
+                {
+                    destination[0] = static_cast<std::uint8_t>(
+                        0xE0 | (code_point >> 12));
+
+                    destination[1] = static_cast<std::uint8_t>(
+                        0x80 | ((code_point >> 6) & 0x3F));
+
+                    destination[2] = static_cast<std::uint8_t>(
+                        0x80 | (code_point & 0x3F));
+
+                    return 3;
+                }
+
+                default:
+                {
+                    destination[0] = static_cast<std::uint8_t>(
+                        0xF0 | (code_point >> 18));
+
+                    destination[1] = static_cast<std::uint8_t>(
+                        0x80 | ((code_point >> 12) & 0x3F));
+
+                    destination[2] = static_cast<std::uint8_t>(
+                        0x80 | ((code_point >> 6) & 0x3F));
+
+                    destination[3] = static_cast<std::uint8_t>(
+                        0x80 | (code_point & 0x3F));
+
+                    return 4;
+                }
+            }
+        }
+
+        /// \brief Decode the code-point at the beginning of a sequence of
+        ///        UTF-16 code-units.
+        ///
+        /// \return Returns the number of code-units consumed.
+        Int
+        DecodeUTF16(Immutable<Span<char16_t>> code_units,
+                    Int index,
+                    Mutable<char32_t> code_point) noexcept
+        {
+            auto lead = static_cast<char32_t>(code_units[index]);
+
+            if ((lead < 0xD800) || (lead > 0xDFFF))
+            {
+                code_point = lead;
+
+                return 1;
+            }
+
+            // Only high surrogates followed by a low surrogate are
+            // well-formed.
+
+            if ((lead <= 0xDBFF) && (index + 1 < code_units.GetCount()))
+            {
+                auto trail = static_cast<char32_t>(code_units[index + 1]);
+
+                if ((trail >= 0xDC00) && (trail <= 0xDFFF))
+                {
+                    code_point = 0x10000
+                               + ((lead - 0xD800) << 10)
+                               + (trail - 0xDC00);
+
+                    return 2;
+                }
+            }
+
+            code_point = kReplacement;
+
+            return 1;
+        }
+
+        /// \brief Copy ASCII code-units at the beginning of a sequence to
+        ///        a wider destination.
+        ///
+        /// \return Returns the number of code-units copied.
+        template <typename TCodeUnit>
+        Int
+        WidenASCII(Immutable<Memory::ByteSpan> code_units,
+                   RWPtr<TCodeUnit> destination,
+                   Int capacity) noexcept
+        {
+            auto count = HAL::Unicode::CountASCII(code_units);
+
+            count = (count < capacity) ? count : capacity;
+
+            auto source = reinterpret_cast<Ptr<std::uint8_t>>(
+                code_units.GetData());
+
+            for (auto index = Int{ 0 }; index < count; ++index)
+            {
+                destination[index] = static_cast<TCodeUnit>(source[index]);
+            }
+
+            return count;
+        }
+    }
+
+    /************************************************************************/
+    /* UNICODE                                                              */
+    /************************************************************************/
+
+    // Validation.
+    // ===========
+
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<Memory::ByteSpan> code_units) noexcept
+    {
+        return HAL::Unicode::IsValidUTF8(code_units);
+    }
+
+    // Decoding.
+    // =========
+
+    [[nodiscard]] Int
+    CountCodePoints(Immutable<StringView> string_view) noexcept
+    {
+        return HAL::Unicode::CountCodePoints(string_view.GetCodeUnits());
+    }
+
+    // Transcoding.
+    // ============
+
+    [[nodiscard]] Int
+    CountUTF16(Immutable<StringView> string_view) noexcept
+    {
+        return HAL::Unicode::CountUTF16(string_view.GetCodeUnits());
+    }
+
+    [[nodiscard]] Memory::Bytes
+    CountUTF8(Immutable<Span<char16_t>> code_units) noexcept
+    {
+        auto count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < code_units.GetCount();)
+        {
+            auto code_point = char32_t{};
+
+            index += DecodeUTF16(code_units, index, code_point);
+
+            count += GetUTF8Length(code_point);
+        }
+
+        return Memory::ToBytes(count);
+    }
+
+    [[nodiscard]] Memory::Bytes
+    CountUTF8(Immutable<Span<char32_t>> code_units) noexcept
+    {
+        auto count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < code_units.GetCount(); ++index)
+        {
+            count += GetUTF8Length(code_units[index]);
+        }
+
+        return Memory::ToBytes(count);
+    }
+
+    Int
+    ToUTF16(Immutable<StringView> string_view,
+            Immutable<RWSpan<char16_t>> destination) noexcept
+    {
+        auto code_points = CodePointRange{ string_view };
+
+        auto data = destination.GetData();
+        auto capacity = destination.GetCount();
+
+        auto count = Int{ 0 };
+
+        while (!code_points.IsEmpty() && (count < capacity))
+        {
+            // ASCII runs are widened in bulk.
+
+            if (auto ascii_count = WidenASCII(code_points.GetCodeUnits(),
+                                              data + count,
+                                              capacity - count))
+            {
+                auto code_units = code_points.GetCodeUnits();
+
+                count += ascii_count;
+
+                code_points = CodePointRange{ Memory::MakeByteSpan(
+                    code_units.GetData() + ascii_count,
+                    code_units.GetData() + ToInt(code_units.GetCount())) };
+
+                continue;
+            }
+
+            auto code_point = code_points.GetFront();
+
+            if (code_point < 0x10000)
+            {
+                data[count++] = static_cast<char16_t>(code_point);
+            }
+            else if (count + 1 < capacity)
+            {
+                code_point -= 0x10000;
+
+                data[count++] = static_cast<char16_t>(
+                    0xD800 + (code_point >> 10));
+
+                data[count++] = static_cast<char16_t>(
+                    0xDC00 + (code_point & 0x3FF));
+            }
+            else
+            {
+                break;                      // Surrogate pair doesn't fit.
+            }
+
+            code_points = code_points.PopFront();
+        }
+
+        return count;
+    }
+
+    Int
+    ToUTF32(Immutable<StringView> string_view,
+            Immutable<RWSpan<char32_t>> destination) noexcept
+    {
+        auto code_points = CodePointRange{ string_view };
+
+        auto data = destination.GetData();
+        auto capacity = destination.GetCount();
+
+        auto count = Int{ 0 };
+
+        while (!code_points.IsEmpty() && (count < capacity))
+        {
+            if (auto ascii_count = WidenASCII(code_points.GetCodeUnits(),
+                                              data + count,
+                                              capacity - count))
+            {
+                auto code_units = code_points.GetCodeUnits();
+
+                count += ascii_count;
+
+                code_points = CodePointRange{ Memory::MakeByteSpan(
+                    code_units.GetData() + ascii_count,
+                    code_units.GetData() + ToInt(code_units.GetCount())) };
+
+                continue;
+            }
+
+            data[count++] = code_points.GetFront();
+
+            code_points = code_points.PopFront();
+        }
+
+        return count;
+    }
+
+    Memory::Bytes
+    FromUTF16(Immutable<Span<char16_t>> code_units,
+              Immutable<Memory::RWByteSpan> destination) noexcept
+    {
+        auto data = reinterpret_cast<RWPtr<std::uint8_t>>(
+            destination.GetData());
+
+        auto capacity = ToInt(destination.GetCount());
+
+        auto count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < code_units.GetCount();)
+        {
+            auto code_point = char32_t{};
+
+            auto length = DecodeUTF16(code_units, index, code_point);
+
+            if (count + GetUTF8Length(code_point) > capacity)
+            {
+                break;
+            }
+
+            count += EncodeUTF8(code_point, data + count);
+            index += length;
+        }
+
+        return Memory::ToBytes(count);
+    }
+
+    Memory::Bytes
+    FromUTF32(Immutable<Span<char32_t>> code_units,
+              Immutable<Memory::RWByteSpan> destination) noexcept
+    {
+        auto data = reinterpret_cast<RWPtr<std::uint8_t>>(
+            destination.GetData());
+
+        auto capacity = ToInt(destination.GetCount());
+
+        auto count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < code_units.GetCount(); ++index)
+        {
+            if (count + GetUTF8Length(code_units[index]) > capacity)
+            {
+                break;
+            }
+
+            count += EncodeUTF8(code_units[index], data + count);
+        }
+
+        return Memory::ToBytes(count);
+    }
+
+}
+
+// ===========================================================================
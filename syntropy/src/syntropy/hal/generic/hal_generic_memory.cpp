@@ -0,0 +1,44 @@
+#if !defined(_M_X64) && !defined(__x86_64__)
+
+#include "syntropy/hal/hal_memory.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <cstring>
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Memory
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // Memory.
+    // =======
+
+    void
+    Copy(Immutable<Syntropy::Memory::RWByteSpan> destination,
+         Immutable<Syntropy::Memory::ByteSpan> source) noexcept
+    {
+        std::memcpy(destination.GetData(),
+                    source.GetData(),
+                    ToInt(destination.GetCount()));
+    }
+
+    void
+    Set(Immutable<Syntropy::Memory::RWByteSpan> destination,
+        Syntropy::Memory::Byte value) noexcept
+    {
+        std::memset(destination.GetData(),
+                    static_cast<int>(value),
+                    ToInt(destination.GetCount()));
+    }
+
+}
+
+// ===========================================================================
+
+#endif
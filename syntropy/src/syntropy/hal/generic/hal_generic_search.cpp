@@ -0,0 +1,175 @@
+#include "syntropy/hal/hal_search.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Search::Generic
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+        /// \brief Access the code-units in a sequence as unsigned values.
+        [[nodiscard]] Ptr<std::uint8_t>
+        GetData(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+        {
+            return reinterpret_cast<Ptr<std::uint8_t>>(code_units.GetData());
+        }
+
+        /// \brief Convert an ASCII upper-case letter to lower-case.
+        [[nodiscard]] std::uint8_t
+        ToLower(std::uint8_t code_unit) noexcept
+        {
+            auto is_upper = (code_unit >= 'A') && (code_unit <= 'Z');
+
+            return is_upper ? (code_unit | 0x20) : code_unit;
+        }
+    }
+
+    // Search.
+    // =======
+
+    [[nodiscard]] Int
+    FindPair(Immutable<Syntropy::Memory::ByteSpan> code_units,
+             Syntropy::Memory::Byte first,
+             Syntropy::Memory::Byte last,
+             Int distance) noexcept
+    {
+        auto data = GetData(code_units);
+        auto size = ToInt(code_units.GetCount());
+
+        auto first_code_unit = static_cast<std::uint8_t>(first);
+        auto last_code_unit = static_cast<std::uint8_t>(last);
+
+        for (auto index = Int{ 0 }; index + distance < size; ++index)
+        {
+            // Candidates are located by the C library, which is usually
+            // vectorized.
+
+            auto candidate = static_cast<Ptr<std::uint8_t>>(std::memchr(
+                data + index, first_code_unit, size - distance - index));
+
+            if (!candidate)
+            {
+                break;
+            }
+
+            index = candidate - data;
+
+            if (data[index + distance] == last_code_unit)
+            {
+                return index;
+            }
+        }
+
+        return size;
+    }
+
+    [[nodiscard]] Int
+    FindAnyOf(Immutable<Syntropy::Memory::ByteSpan> code_units,
+              Immutable<Syntropy::Memory::ByteSpan> set) noexcept
+    {
+        auto data = GetData(code_units);
+        auto size = ToInt(code_units.GetCount());
+
+        // Code-unit set, one bit per code-unit value.
+
+        std::uint64_t mask[4] = {};
+
+        auto set_data = GetData(set);
+
+        for (auto index = Int{ 0 }; index < ToInt(set.GetCount()); ++index)
+        {
+            auto value = set_data[index];
+
+            mask[value >> 6] |= std::uint64_t{ 1 } << (value & 63);
+        }
+
+        for (auto index = Int{ 0 }; index < size; ++index)
+        {
+            auto value = data[index];
+
+            if (mask[value >> 6] & (std::uint64_t{ 1 } << (value & 63)))
+            {
+                return index;
+            }
+        }
+
+        return size;
+    }
+
+    [[nodiscard]] Int
+    FindMismatchIgnoreCase(Immutable<Syntropy::Memory::ByteSpan> lhs,
+                           Immutable<Syntropy::Memory::ByteSpan> rhs)
+        noexcept
+    {
+        auto lhs_data = GetData(lhs);
+        auto rhs_data = GetData(rhs);
+
+        auto size = ToInt(lhs.GetCount() < rhs.GetCount() ? lhs.GetCount()
+                                                          : rhs.GetCount());
+
+        auto index = Int{ 0 };
+
+        for (; (index < size)
+               && (ToLower(lhs_data[index]) == ToLower(rhs_data[index]));
+             ++index)
+        {
+
+        }
+
+        return index;
+    }
+
+}
+
+// ===========================================================================
+
+#if !defined(_M_X64) && !defined(__x86_64__)
+
+namespace Syntropy::HAL::Search
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // Search.
+    // =======
+
+    [[nodiscard]] Int
+    FindPair(Immutable<Syntropy::Memory::ByteSpan> code_units,
+             Syntropy::Memory::Byte first,
+             Syntropy::Memory::Byte last,
+             Int distance) noexcept
+    {
+        return Generic::FindPair(code_units, first, last, distance);
+    }
+
+    [[nodiscard]] Int
+    FindAnyOf(Immutable<Syntropy::Memory::ByteSpan> code_units,
+              Immutable<Syntropy::Memory::ByteSpan> set) noexcept
+    {
+        return Generic::FindAnyOf(code_units, set);
+    }
+
+    [[nodiscard]] Int
+    FindMismatchIgnoreCase(Immutable<Syntropy::Memory::ByteSpan> lhs,
+                           Immutable<Syntropy::Memory::ByteSpan> rhs)
+        noexcept
+    {
+        return Generic::FindMismatchIgnoreCase(lhs, rhs);
+    }
+
+}
+
+#endif
+
+// ===========================================================================
@@ -0,0 +1,238 @@
+#include "syntropy/hal/hal_unicode.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Unicode::Generic
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+        /// \brief Mask of the most significant bit of each byte in a word.
+        constexpr auto kHighBits = std::uint64_t{ 0x8080808080808080ull };
+
+        /// \brief Access the code-units in a sequence as unsigned values.
+        [[nodiscard]] Ptr<std::uint8_t>
+        GetData(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+        {
+            return reinterpret_cast<Ptr<std::uint8_t>>(code_units.GetData());
+        }
+
+        /// \brief Load eight code-units at once.
+        [[nodiscard]] std::uint64_t
+        LoadWord(Ptr<std::uint8_t> data) noexcept
+        {
+            auto word = std::uint64_t{};
+
+            std::memcpy(&word, data, sizeof(word));
+
+            return word;
+        }
+    }
+
+    // Unicode.
+    // ========
+
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        // See The Unicode Standard, Table 3-7.
+
+        auto data = GetData(code_units);
+        auto size = ToInt(code_units.GetCount());
+
+        for (auto index = Int{ 0 }; index < size;)
+        {
+            // ASCII runs are skipped a word at a time.
+
+            if ((index + 8 <= size)
+                && ((LoadWord(data + index) & kHighBits) == 0))
+            {
+                index += 8;
+                continue;
+            }
+
+            auto lead = data[index];
+
+            if (lead < 0x80)
+            {
+                ++index;
+                continue;
+            }
+
+            auto length = Int{ 0 };
+            auto low = std::uint8_t{ 0x80 };
+            auto high = std::uint8_t{ 0xBF };
+
+            if ((lead >= 0xC2) && (lead <= 0xDF))
+            {
+                length = 2;
+            }
+            else if (lead == 0xE0)
+            {
+                length = 3;
+                low = 0xA0;                             // Overlong.
+            }
+            else if (lead == 0xED)
+            {
+                length = 3;
+                high = 0x9F;                            // Surrogates.
+            }
+            else if ((lead >= 0xE1) && (lead <= 0xEF))
+            {
+                length = 3;
+            }
+            else if (lead == 0xF0)
+            {
+                length = 4;
+                low = 0x90;                             // Overlong.
+            }
+            else if ((lead >= 0xF1) && (lead <= 0xF3))
+            {
+                length = 4;
+            }
+            else if (lead == 0xF4)
+            {
+                length = 4;
+                high = 0x8F;                            // Above U+10FFFF.
+            }
+            else
+            {
+                return false;
+            }
+
+            if ((size - index < length)
+                || (data[index + 1] < low)
+                || (data[index + 1] > high))
+            {
+                return false;
+            }
+
+            for (auto offset = Int{ 2 }; offset < length; ++offset)
+            {
+                if ((data[index + offset] & 0xC0) != 0x80)
+                {
+                    return false;
+                }
+            }
+
+            index += length;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] Int
+    CountCodePoints(Immutable<Syntropy::Memory::ByteSpan> code_units)
+        noexcept
+    {
+        // Each code-point has exactly one leading code-unit.
+
+        auto data = GetData(code_units);
+        auto size = ToInt(code_units.GetCount());
+
+        auto count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < size; ++index)
+        {
+            count += ((data[index] & 0xC0) != 0x80) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    [[nodiscard]] Int
+    CountUTF16(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        // Four-byte sequences are encoded as surrogate pairs.
+
+        auto data = GetData(code_units);
+        auto size = ToInt(code_units.GetCount());
+
+        auto count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < size; ++index)
+        {
+            count += ((data[index] & 0xC0) != 0x80) ? 1 : 0;
+            count += (data[index] >= 0xF0) ? 1 : 0;
+        }
+
+        return count;
+    }
+
+    [[nodiscard]] Int
+    CountASCII(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        auto data = GetData(code_units);
+        auto size = ToInt(code_units.GetCount());
+
+        auto index = Int{ 0 };
+
+        for (; (index + 8 <= size)
+               && ((LoadWord(data + index) & kHighBits) == 0); index += 8)
+        {
+
+        }
+
+        for (; (index < size) && (data[index] < 0x80); ++index)
+        {
+
+        }
+
+        return index;
+    }
+
+}
+
+// ===========================================================================
+
+#if !defined(_M_X64) && !defined(__x86_64__)
+
+namespace Syntropy::HAL::Unicode
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // Unicode.
+    // ========
+
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        return Generic::IsValidUTF8(code_units);
+    }
+
+    [[nodiscard]] Int
+    CountCodePoints(Immutable<Syntropy::Memory::ByteSpan> code_units)
+        noexcept
+    {
+        return Generic::CountCodePoints(code_units);
+    }
+
+    [[nodiscard]] Int
+    CountUTF16(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        return Generic::CountUTF16(code_units);
+    }
+
+    [[nodiscard]] Int
+    CountASCII(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        return Generic::CountASCII(code_units);
+    }
+
+}
+
+#endif
+
+// ===========================================================================
@@ -0,0 +1,37 @@
+/// \file hal_memory.h
+/// \brief This header is part of the Syntropy hardware abstraction layer
+///        module. It exposes APIs needed to perform bulk memory operations.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Memory
+{
+    /************************************************************************/
+    /* MEMORY                                                               */
+    /************************************************************************/
+
+    /// \brief Copy a source memory region to a destination memory region.
+    ///
+    /// \remarks The behavior of this function is undefined unless both
+    ///          regions have the same size and don't overlap.
+    void
+    Copy(Immutable<Syntropy::Memory::RWByteSpan> destination,
+         Immutable<Syntropy::Memory::ByteSpan> source) noexcept;
+
+    /// \brief Set a value to each byte in a destination memory region.
+    void
+    Set(Immutable<Syntropy::Memory::RWByteSpan> destination,
+        Syntropy::Memory::Byte value) noexcept;
+
+}
+
+// ===========================================================================
@@ -0,0 +1,89 @@
+/// \file hal_search.h
+/// \brief This header is part of the Syntropy hardware abstraction layer
+///        module. It exposes APIs needed to scan sequences of code-units in
+///        bulk.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Search
+{
+    /************************************************************************/
+    /* SEARCH                                                               */
+    /************************************************************************/
+
+    /// \brief Find the first position in a sequence where a code-unit is
+    ///        followed, distance code-units later, by another one.
+    ///
+    /// \return Returns the first position matching both code-units, or
+    ///         the number of code-units in the sequence if there's none.
+    [[nodiscard]] Int
+    FindPair(Immutable<Syntropy::Memory::ByteSpan> code_units,
+             Syntropy::Memory::Byte first,
+             Syntropy::Memory::Byte last,
+             Int distance) noexcept;
+
+    /// \brief Find the first code-unit in a sequence which is equal to
+    ///        any code-unit in a set.
+    ///
+    /// \return Returns the position of the first match, or the number of
+    ///         code-units in the sequence if there's none.
+    [[nodiscard]] Int
+    FindAnyOf(Immutable<Syntropy::Memory::ByteSpan> code_units,
+              Immutable<Syntropy::Memory::ByteSpan> set) noexcept;
+
+    /// \brief Find the first position where two sequences differ, ignoring
+    ///        the case of ASCII letters.
+    ///
+    /// \return Returns the position of the first mismatch, or the number of
+    ///         code-units in the shortest sequence if there's none.
+    [[nodiscard]] Int
+    FindMismatchIgnoreCase(Immutable<Syntropy::Memory::ByteSpan> lhs,
+                           Immutable<Syntropy::Memory::ByteSpan> rhs)
+        noexcept;
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Search::Generic
+{
+    /************************************************************************/
+    /* SEARCH                                                               */
+    /************************************************************************/
+
+    // Portable implementations, used as a fallback by platform-specific
+    // implementations.
+
+    /// \brief Find the first position in a sequence where a code-unit is
+    ///        followed, distance code-units later, by another one.
+    [[nodiscard]] Int
+    FindPair(Immutable<Syntropy::Memory::ByteSpan> code_units,
+             Syntropy::Memory::Byte first,
+             Syntropy::Memory::Byte last,
+             Int distance) noexcept;
+
+    /// \brief Find the first code-unit in a sequence which is equal to
+    ///        any code-unit in a set.
+    [[nodiscard]] Int
+    FindAnyOf(Immutable<Syntropy::Memory::ByteSpan> code_units,
+              Immutable<Syntropy::Memory::ByteSpan> set) noexcept;
+
+    /// \brief Find the first position where two sequences differ, ignoring
+    ///        the case of ASCII letters.
+    [[nodiscard]] Int
+    FindMismatchIgnoreCase(Immutable<Syntropy::Memory::ByteSpan> lhs,
+                           Immutable<Syntropy::Memory::ByteSpan> rhs)
+        noexcept;
+
+}
+
+// ===========================================================================
@@ -0,0 +1,77 @@
+/// \file hal_unicode.h
+/// \brief This header is part of the Syntropy hardware abstraction layer
+///        module. It exposes APIs needed to process UTF-8 text in bulk.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Unicode
+{
+    /************************************************************************/
+    /* UNICODE                                                              */
+    /************************************************************************/
+
+    /// \brief Check whether a sequence of code-units is well-formed UTF-8.
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept;
+
+    /// \brief Get the number of code-points in a well-formed UTF-8
+    ///        sequence.
+    [[nodiscard]] Int
+    CountCodePoints(Immutable<Syntropy::Memory::ByteSpan> code_units)
+        noexcept;
+
+    /// \brief Get the number of UTF-16 code-units needed to encode a
+    ///        well-formed UTF-8 sequence.
+    [[nodiscard]] Int
+    CountUTF16(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept;
+
+    /// \brief Get the number of ASCII code-units at the beginning of a
+    ///        sequence.
+    [[nodiscard]] Int
+    CountASCII(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept;
+
+}
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Unicode::Generic
+{
+    /************************************************************************/
+    /* UNICODE                                                              */
+    /************************************************************************/
+
+    // Portable implementations, used as a fallback by platform-specific
+    // implementations.
+
+    /// \brief Check whether a sequence of code-units is well-formed UTF-8.
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept;
+
+    /// \brief Get the number of code-points in a well-formed UTF-8
+    ///        sequence.
+    [[nodiscard]] Int
+    CountCodePoints(Immutable<Syntropy::Memory::ByteSpan> code_units)
+        noexcept;
+
+    /// \brief Get the number of UTF-16 code-units needed to encode a
+    ///        well-formed UTF-8 sequence.
+    [[nodiscard]] Int
+    CountUTF16(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept;
+
+    /// \brief Get the number of ASCII code-units at the beginning of a
+    ///        sequence.
+    [[nodiscard]] Int
+    CountASCII(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept;
+
+}
+
+// ===========================================================================
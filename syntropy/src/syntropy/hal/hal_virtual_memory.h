@@ -0,0 +1,69 @@
+/// \file hal_virtual_memory.h
+/// \brief This header is part of the Syntropy hardware abstraction layer
+///        module. It exposes APIs needed to handle virtual memory.
+///
+/// \author Raffaele D. Facendola - 2017
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+
+// ===========================================================================
+
+namespace Syntropy::HAL::VirtualMemory
+{
+    /************************************************************************/
+    /* VIRTUAL MEMORY                                                       */
+    /************************************************************************/
+
+    /// \brief Get the virtual memory page size.
+    [[nodiscard]] Memory::Bytes
+    GetPageSize() noexcept;
+
+    /// \brief Get the virtual memory page alignment.
+    [[nodiscard]] Memory::Alignment
+    GetPageAlignment() noexcept;
+
+    /// \brief Reserve a range of virtual memory addresses.
+    [[nodiscard]] Memory::RWByteSpan
+    Reserve(Memory::Bytes size) noexcept;
+
+    /// \brief Allocate a range of virtual memory addresses.
+    [[nodiscard]] Memory::RWByteSpan
+    Allocate(Memory::Bytes size) noexcept;
+
+    /// \brief Release a range of virtual memory addresses.
+    Bool
+    Release(Immutable<Memory::RWByteSpan> block) noexcept;
+
+    /// \brief Commit a reserved virtual memory block.
+    Bool
+    Commit(Immutable<Memory::RWByteSpan> block,
+           Syntropy::VirtualMemory::CommitMode mode) noexcept;
+
+    /// \brief Decommit a virtual memory block.
+    Bool
+    Decommit(Immutable<Memory::RWByteSpan> block) noexcept;
+
+    /// \brief Get the number of NUMA nodes available to the process.
+    [[nodiscard]] Int
+    GetNodeCount() noexcept;
+
+    /// \brief Get the NUMA node of the processor running the calling
+    ///        thread.
+    [[nodiscard]] Int
+    GetCurrentNode() noexcept;
+
+    /// \brief Set the preferred NUMA node of a virtual memory block.
+    Bool
+    Bind(Immutable<Memory::RWByteSpan> block, Int node) noexcept;
+
+}
+
+// ===========================================================================
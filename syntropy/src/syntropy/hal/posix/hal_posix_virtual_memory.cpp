@@ -0,0 +1,363 @@
+#if defined(__unix__) || defined(__APPLE__)
+
+#include "syntropy/hal/hal_virtual_memory.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+
+#include <sched.h>
+#include <sys/syscall.h>
+
+#include <linux/mempolicy.h>
+
+#endif
+
+// ===========================================================================
+
+namespace Syntropy::HAL::VirtualMemory
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+#ifdef MAP_NORESERVE
+
+        /// \brief Flags of reserved address space mappings.
+        constexpr auto kReserveFlags = MAP_PRIVATE
+                                     | MAP_ANONYMOUS
+                                     | MAP_NORESERVE;
+
+#else
+
+        /// \brief Flags of reserved address space mappings.
+        constexpr auto kReserveFlags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#endif
+
+#ifdef __linux__
+
+        /// \brief Number of bits in a word of a NUMA node mask.
+        constexpr auto kNodeWordBits = Int{ 8 * sizeof(unsigned long) };
+
+        /// \brief Number of nodes representable by a NUMA node mask.
+        constexpr auto kNodeMaskBits = Int{ 1024 };
+
+        /// \brief A NUMA node mask, as expected by NUMA system calls.
+        using NodeMask = unsigned long[kNodeMaskBits / kNodeWordBits];
+
+#endif
+
+        /// \brief Extend a block to the boundaries of the pages it spans.
+        [[nodiscard]] Memory::RWByteSpan
+        ToPageSpan(Immutable<Memory::RWByteSpan> block) noexcept
+        {
+            auto page_alignment = GetPageAlignment();
+
+            auto begin = Memory::AlignDown(block.GetData(), page_alignment);
+
+            auto end = Memory::Align(block.GetData() + block.GetCount(),
+                                     page_alignment);
+
+            return { begin, end };
+        }
+    }
+
+    // Virtual memory.
+    // ===============
+
+    [[nodiscard]] Memory::Bytes
+    GetPageSize() noexcept
+    {
+        static auto page_size = Memory::Bytes{ sysconf(_SC_PAGESIZE) };
+
+        return page_size;
+    }
+
+    [[nodiscard]] Memory::Alignment
+    GetPageAlignment() noexcept
+    {
+        // Virtual memory pages are aligned to page-size boundaries.
+
+        return Memory::ToAlignment(GetPageSize());
+    }
+
+    [[nodiscard]] Memory::RWByteSpan
+    Reserve(Memory::Bytes size) noexcept
+    {
+        // Inaccessible, unbacked address space: no swap is accounted for
+        // reserved pages until they are committed.
+
+        if (size > Memory::Bytes{ 0 })
+        {
+            auto data = mmap(nullptr,
+                             ToInt(size),
+                             PROT_NONE,
+                             kReserveFlags,
+                             -1,
+                             0);
+
+            if (data != MAP_FAILED)
+            {
+                return { Memory::ToBytePtr(data), size };
+            }
+        }
+
+        return {};
+    }
+
+    [[nodiscard]] Memory::RWByteSpan
+    Allocate(Memory::Bytes size) noexcept
+    {
+        // Anonymous pages are zero-filled and mapped upon first access.
+
+        if (size > Memory::Bytes{ 0 })
+        {
+            auto data = mmap(nullptr,
+                             ToInt(size),
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS,
+                             -1,
+                             0);
+
+            if (data != MAP_FAILED)
+            {
+                return { Memory::ToBytePtr(data), size };
+            }
+        }
+
+        return {};
+    }
+
+    Bool
+    Release(Immutable<Memory::RWByteSpan> block) noexcept
+    {
+        if (block)
+        {
+            // Unlike Windows, the entire range must be specified.
+
+            auto page_span = ToPageSpan(block);
+
+            return munmap(page_span.GetData(),
+                          ToInt(page_span.GetCount())) == 0;
+        }
+
+        return true;
+    }
+
+    Bool
+    Commit(Immutable<Memory::RWByteSpan> block,
+           Syntropy::VirtualMemory::CommitMode mode) noexcept
+    {
+        if (block)
+        {
+            auto page_span = ToPageSpan(block);
+
+            auto data = page_span.GetData();
+            auto size = ToInt(page_span.GetCount());
+
+            // Commit each page containing at least one byte in the range.
+            // Physical pages are provided by the kernel upon first access.
+
+            if (mprotect(data, size, PROT_READ | PROT_WRITE) != 0)
+            {
+                return false;
+            }
+
+#ifdef MADV_HUGEPAGE
+
+            // Huge pages are a hint: failing to honor it still leaves the
+            // range committed.
+
+            if (mode == Syntropy::VirtualMemory::CommitMode::kHugePages)
+            {
+                madvise(data, size, MADV_HUGEPAGE);
+            }
+
+#endif
+
+            return true;
+        }
+
+        return true;
+    }
+
+    Bool
+    Decommit(Immutable<Memory::RWByteSpan> block) noexcept
+    {
+        if (block)
+        {
+            auto page_span = ToPageSpan(block);
+
+            auto data = page_span.GetData();
+            auto size = ToInt(page_span.GetCount());
+
+#ifdef __linux__
+
+            // Return the physical pages to the system. Next access to the
+            // range would yield zero-filled pages.
+
+            if (madvise(data, size, MADV_DONTNEED) != 0)
+            {
+                return false;
+            }
+
+            // Make the range inaccessible again, as if it were only reserved.
+
+            return mprotect(data, size, PROT_NONE) == 0;
+
+#else
+
+            // Other systems may keep the content of pages advised as not
+            // needed: replacing the mapping discards them for sure.
+
+            return mmap(data,
+                        size,
+                        PROT_NONE,
+                        kReserveFlags | MAP_FIXED,
+                        -1,
+                        0) != MAP_FAILED;
+
+#endif
+        }
+
+        return true;
+    }
+
+#ifdef __linux__
+
+    [[nodiscard]] Int
+    GetNodeCount() noexcept
+    {
+        static auto node_count = []() noexcept
+        {
+            // Nodes may not be contiguous: the highest node allowed to the
+            // process determines the count. Kernels without NUMA support
+            // fail the call.
+
+            NodeMask node_mask = {};
+
+            if (syscall(SYS_get_mempolicy,
+                        nullptr,
+                        node_mask,
+                        kNodeMaskBits,
+                        nullptr,
+                        MPOL_F_MEMS_ALLOWED) != 0)
+            {
+                return Int{ 1 };
+            }
+
+            auto count = Int{ 1 };
+
+            for (auto node = Int{ 0 }; node < kNodeMaskBits; ++node)
+            {
+                auto word = node_mask[node / kNodeWordBits];
+
+                if ((word >> (node % kNodeWordBits)) & 1ul)
+                {
+                    count = node + 1;
+                }
+            }
+
+            return count;
+        }();
+
+        return node_count;
+    }
+
+    [[nodiscard]] Int
+    GetCurrentNode() noexcept
+    {
+        auto cpu = 0u;
+        auto node = 0u;
+
+#if defined(__GLIBC__) && \
+    ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 29)))
+
+        // Serviced by the vDSO, where available.
+
+        if (getcpu(&cpu, &node) != 0)
+        {
+            return 0;
+        }
+
+#else
+
+        if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0)
+        {
+            return 0;
+        }
+
+#endif
+
+        return static_cast<Int>(node);
+    }
+
+    Bool
+    Bind(Immutable<Memory::RWByteSpan> block, Int node) noexcept
+    {
+        if ((node < 0) || (node >= kNodeMaskBits))
+        {
+            return false;
+        }
+
+        if (block)
+        {
+            auto page_span = ToPageSpan(block);
+
+            NodeMask node_mask = {};
+
+            node_mask[node / kNodeWordBits] = 1ul << (node % kNodeWordBits);
+
+            // Preferred rather than strict binding: when the node runs out
+            // of memory pages are acquired elsewhere instead of failing.
+
+            return syscall(SYS_mbind,
+                           page_span.GetData(),
+                           ToInt(page_span.GetCount()),
+                           MPOL_PREFERRED,
+                           node_mask,
+                           kNodeMaskBits + 1,
+                           0) == 0;
+        }
+
+        return true;
+    }
+
+#else
+
+    // NUMA policies are only supported on Linux: other systems are
+    // exposed as a single node.
+
+    [[nodiscard]] Int
+    GetNodeCount() noexcept
+    {
+        return 1;
+    }
+
+    [[nodiscard]] Int
+    GetCurrentNode() noexcept
+    {
+        return 0;
+    }
+
+    Bool
+    Bind(Immutable<Memory::RWByteSpan> block, Int node) noexcept
+    {
+        return node == 0;
+    }
+
+#endif
+
+}
+
+// ===========================================================================
+
+#endif
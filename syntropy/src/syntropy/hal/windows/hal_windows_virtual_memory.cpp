@@ -0,0 +1,190 @@
+#ifdef _WIN64
+
+#include "syntropy/hal/hal_virtual_memory.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#pragma warning(push)
+#pragma warning(disable:4091)
+
+ #include <Windows.h>
+
+#undef max
+
+#pragma warning(pop)
+
+// ===========================================================================
+
+namespace Syntropy::HAL::VirtualMemory
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // Virtual memory.
+    // ===============
+
+    [[nodiscard]] Memory::Bytes
+    GetPageSize() noexcept
+    {
+        SYSTEM_INFO system_info;
+
+        GetSystemInfo(&system_info);
+
+        return Memory::Bytes{ system_info.dwPageSize };
+    }
+
+    [[nodiscard]] Memory::Alignment
+    GetPageAlignment() noexcept
+    {
+        // Virtual memory pages are aligned to page-size boundaries.
+
+        return Memory::ToAlignment(GetPageSize());
+    }
+
+    [[nodiscard]] Memory::RWByteSpan
+    Reserve(Memory::Bytes size) noexcept
+    {
+        // Reserve up to the next page boundary.
+
+        if (size > Memory::Bytes{ 0 })
+        {
+            if (auto data = VirtualAlloc(0,
+                                         ToInt(size),
+                                         MEM_RESERVE,
+                                         PAGE_READWRITE))
+            {
+                return { Memory::ToBytePtr(data), size };
+            }
+        }
+
+        return {};
+    }
+
+    [[nodiscard]] Memory::RWByteSpan
+    Allocate(Memory::Bytes size) noexcept
+    {
+        // Allocate up to the next page boundary.
+
+        if (size > Memory::Bytes{ 0 })
+        {
+            if (auto data = VirtualAlloc(0,
+                                         ToInt(size),
+                                         MEM_RESERVE | MEM_COMMIT,
+                                         PAGE_READWRITE))
+            {
+                return { Memory::ToBytePtr(data), size };
+            }
+        }
+
+        return {};
+    }
+
+    Bool
+    Release(Immutable<Memory::RWByteSpan> block) noexcept
+    {
+        if (block)
+        {
+            // Deallocate the entire previously-allocated range.
+
+            return VirtualFree(block.GetData(), 0, MEM_RELEASE) != 0;
+        }
+
+        return true;
+    }
+
+    Bool
+    Commit(Immutable<Memory::RWByteSpan> block,
+           Syntropy::VirtualMemory::CommitMode mode) noexcept
+    {
+        // Large pages require the range to be reserved as such and the
+        // process to hold SeLockMemoryPrivilege: the mode is ignored.
+
+        if (block)
+        {
+            auto size = ToInt(block.GetCount());
+
+            // Commit each page containing at least one byte in the range.
+
+            return VirtualAlloc(block.GetData(),
+                                size,
+                                MEM_COMMIT,
+                                PAGE_READWRITE) != nullptr;
+        }
+
+        return true;
+    }
+
+    Bool
+    Decommit(Immutable<Memory::RWByteSpan> block) noexcept
+    {
+        if (block)
+        {
+            auto size = ToInt(block.GetCount());
+
+            // Decommit each page containing at least one byte in the range.
+
+            return VirtualFree(block.GetData(), size, MEM_DECOMMIT) != 0;
+        }
+
+        return true;
+    }
+
+    [[nodiscard]] Int
+    GetNodeCount() noexcept
+    {
+        auto highest_node = ULONG{ 0 };
+
+        if (!GetNumaHighestNodeNumber(&highest_node))
+        {
+            return 1;
+        }
+
+        return static_cast<Int>(highest_node) + 1;
+    }
+
+    [[nodiscard]] Int
+    GetCurrentNode() noexcept
+    {
+        auto processor = PROCESSOR_NUMBER{};
+
+        GetCurrentProcessorNumberEx(&processor);
+
+        auto node = USHORT{ 0 };
+
+        if (!GetNumaProcessorNodeEx(&processor, &node))
+        {
+            return 0;
+        }
+
+        return static_cast<Int>(node);
+    }
+
+    Bool
+    Bind(Immutable<Memory::RWByteSpan> block, Int node) noexcept
+    {
+        if (block)
+        {
+            auto size = ToInt(block.GetCount());
+
+            // Committing an already committed range again with a preferred
+            // node affects the pages which were not accessed yet.
+
+            return VirtualAllocExNuma(GetCurrentProcess(),
+                                      block.GetData(),
+                                      size,
+                                      MEM_COMMIT,
+                                      PAGE_READWRITE,
+                                      static_cast<DWORD>(node)) != nullptr;
+        }
+
+        return true;
+    }
+
+}
+
+// ===========================================================================
+
+#endif
@@ -0,0 +1,88 @@
+/// \file hal_x64_cpu.h
+/// \brief This header is part of the Syntropy hardware abstraction layer
+///        module. It exposes APIs needed to query x64 CPU features.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// ===========================================================================
+
+#if defined(__clang__) || defined(__GNUC__)
+
+    /// \brief Enables AVX2 code generation for a single function.
+    #define SYNTROPY_HAL_TARGET_AVX2 \
+        __attribute__((target("avx2")))
+
+#else
+
+    /// \brief Enables AVX2 code generation for a single function.
+    ///
+    /// MSVC accepts AVX2 intrinsics in any function.
+    #define SYNTROPY_HAL_TARGET_AVX2
+
+#endif
+
+// ===========================================================================
+
+namespace Syntropy::HAL::CPU
+{
+    /************************************************************************/
+    /* CPU                                                                  */
+    /************************************************************************/
+
+    /// \brief Check whether the host CPU and OS support AVX2.
+    [[nodiscard]] inline Bool
+    HasAVX2() noexcept
+    {
+#ifdef _MSC_VER
+
+        int info[4];
+
+        __cpuid(info, 0);
+
+        if (info[0] < 7)
+        {
+            return false;
+        }
+
+        __cpuid(info, 1);
+
+        auto os_xsave = (info[2] & (1 << 27)) != 0;
+        auto avx = (info[2] & (1 << 28)) != 0;
+
+        // YMM state must be preserved by the OS.
+
+        if (!os_xsave || !avx || ((_xgetbv(0) & 0x6) != 0x6))
+        {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+
+        return (info[1] & (1 << 5)) != 0;
+
+#else
+
+        __builtin_cpu_init();
+
+        return __builtin_cpu_supports("avx2");
+
+#endif
+    }
+
+}
+
+// ===========================================================================
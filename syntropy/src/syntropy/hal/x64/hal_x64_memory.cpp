@@ -0,0 +1,258 @@
+#if defined(_M_X64) || defined(__x86_64__)
+
+#include "syntropy/hal/hal_memory.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <cstdint>
+#include <cstring>
+
+#include "syntropy/hal/x64/hal_x64_cpu.h"
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Memory
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+        /// \brief Size above which stores bypass the cache hierarchy, as
+        ///        the destination is unlikely to be read back soon.
+        constexpr auto kStreamSize = Int{ 1 } << 21;
+
+        /// \brief Type of a kernel copying non-overlapping memory regions.
+        using TCopyKernel = void (*)(RWPtr<char>, Ptr<char>, Int) noexcept;
+
+        /// \brief Type of a kernel setting each byte in a memory region.
+        using TSetKernel = void (*)(RWPtr<char>, char, Int) noexcept;
+
+        /// \brief Kernels selected for the host CPU.
+        struct Kernels
+        {
+            /// \brief Streaming copy kernel.
+            TCopyKernel copy_{ nullptr };
+
+            /// \brief Streaming set kernel.
+            TSetKernel set_{ nullptr };
+        };
+
+        /// \brief Get the number of bytes needed to align a pointer.
+        [[nodiscard]] Int
+        GetMisalignment(Ptr<char> pointer, Int alignment) noexcept
+        {
+            auto address = reinterpret_cast<std::uintptr_t>(pointer);
+
+            return static_cast<Int>((alignment - (address % alignment))
+                                    % alignment);
+        }
+
+        /// \brief Copy memory using SSE2 non-temporal stores.
+        void
+        StreamCopySSE2(RWPtr<char> destination,
+                       Ptr<char> source,
+                       Int size) noexcept
+        {
+            auto head = GetMisalignment(destination, 16);
+
+            std::memcpy(destination, source, head);
+
+            destination += head;
+            source += head;
+            size -= head;
+
+            for (; size >= 64; size -= 64, destination += 64, source += 64)
+            {
+                auto source_lanes = reinterpret_cast<const __m128i*>(source);
+                auto destination_lanes
+                    = reinterpret_cast<__m128i*>(destination);
+
+                auto lane0 = _mm_loadu_si128(source_lanes + 0);
+                auto lane1 = _mm_loadu_si128(source_lanes + 1);
+                auto lane2 = _mm_loadu_si128(source_lanes + 2);
+                auto lane3 = _mm_loadu_si128(source_lanes + 3);
+
+                _mm_stream_si128(destination_lanes + 0, lane0);
+                _mm_stream_si128(destination_lanes + 1, lane1);
+                _mm_stream_si128(destination_lanes + 2, lane2);
+                _mm_stream_si128(destination_lanes + 3, lane3);
+            }
+
+            _mm_sfence();
+
+            std::memcpy(destination, source, size);
+        }
+
+        /// \brief Copy memory using AVX2 non-temporal stores.
+        SYNTROPY_HAL_TARGET_AVX2 void
+        StreamCopyAVX2(RWPtr<char> destination,
+                       Ptr<char> source,
+                       Int size) noexcept
+        {
+            auto head = GetMisalignment(destination, 32);
+
+            std::memcpy(destination, source, head);
+
+            destination += head;
+            source += head;
+            size -= head;
+
+            for (; size >= 128; size -= 128, destination += 128, source += 128)
+            {
+                auto source_lanes = reinterpret_cast<const __m256i*>(source);
+                auto destination_lanes
+                    = reinterpret_cast<__m256i*>(destination);
+
+                auto lane0 = _mm256_loadu_si256(source_lanes + 0);
+                auto lane1 = _mm256_loadu_si256(source_lanes + 1);
+                auto lane2 = _mm256_loadu_si256(source_lanes + 2);
+                auto lane3 = _mm256_loadu_si256(source_lanes + 3);
+
+                _mm256_stream_si256(destination_lanes + 0, lane0);
+                _mm256_stream_si256(destination_lanes + 1, lane1);
+                _mm256_stream_si256(destination_lanes + 2, lane2);
+                _mm256_stream_si256(destination_lanes + 3, lane3);
+            }
+
+            _mm_sfence();
+
+            std::memcpy(destination, source, size);
+        }
+
+        /// \brief Set memory using SSE2 non-temporal stores.
+        void
+        StreamSetSSE2(RWPtr<char> destination, char value, Int size) noexcept
+        {
+            auto head = GetMisalignment(destination, 16);
+
+            std::memset(destination, value, head);
+
+            destination += head;
+            size -= head;
+
+            auto lane = _mm_set1_epi8(value);
+
+            for (; size >= 64; size -= 64, destination += 64)
+            {
+                auto destination_lanes
+                    = reinterpret_cast<__m128i*>(destination);
+
+                _mm_stream_si128(destination_lanes + 0, lane);
+                _mm_stream_si128(destination_lanes + 1, lane);
+                _mm_stream_si128(destination_lanes + 2, lane);
+                _mm_stream_si128(destination_lanes + 3, lane);
+            }
+
+            _mm_sfence();
+
+            std::memset(destination, value, size);
+        }
+
+        /// \brief Set memory using AVX2 non-temporal stores.
+        SYNTROPY_HAL_TARGET_AVX2 void
+        StreamSetAVX2(RWPtr<char> destination, char value, Int size) noexcept
+        {
+            auto head = GetMisalignment(destination, 32);
+
+            std::memset(destination, value, head);
+
+            destination += head;
+            size -= head;
+
+            auto lane = _mm256_set1_epi8(value);
+
+            for (; size >= 128; size -= 128, destination += 128)
+            {
+                auto destination_lanes
+                    = reinterpret_cast<__m256i*>(destination);
+
+                _mm256_stream_si256(destination_lanes + 0, lane);
+                _mm256_stream_si256(destination_lanes + 1, lane);
+                _mm256_stream_si256(destination_lanes + 2, lane);
+                _mm256_stream_si256(destination_lanes + 3, lane);
+            }
+
+            _mm_sfence();
+
+            std::memset(destination, value, size);
+        }
+
+        /// \brief Get the kernels for the host CPU.
+        ///
+        /// Kernels are selected once, upon first use.
+        [[nodiscard]] Immutable<Kernels>
+        GetKernels() noexcept
+        {
+            static const auto kernels = []() noexcept
+            {
+                if (CPU::HasAVX2())
+                {
+                    return Kernels{ &StreamCopyAVX2, &StreamSetAVX2 };
+                }
+
+                // SSE2 is part of the x64 baseline.
+
+                return Kernels{ &StreamCopySSE2, &StreamSetSSE2 };
+            }();
+
+            return kernels;
+        }
+    }
+
+    // Memory.
+    // =======
+
+    void
+    Copy(Immutable<Syntropy::Memory::RWByteSpan> destination,
+         Immutable<Syntropy::Memory::ByteSpan> source) noexcept
+    {
+        auto destination_data = reinterpret_cast<RWPtr<char>>(
+            destination.GetData());
+
+        auto source_data = reinterpret_cast<Ptr<char>>(source.GetData());
+
+        auto size = ToInt(destination.GetCount());
+
+        if (size >= kStreamSize)
+        {
+            GetKernels().copy_(destination_data, source_data, size);
+        }
+        else
+        {
+            // The C runtime is already vectorized and tuned for cached
+            // copies.
+
+            std::memcpy(destination_data, source_data, size);
+        }
+    }
+
+    void
+    Set(Immutable<Syntropy::Memory::RWByteSpan> destination,
+        Syntropy::Memory::Byte value) noexcept
+    {
+        auto destination_data = reinterpret_cast<RWPtr<char>>(
+            destination.GetData());
+
+        auto size = ToInt(destination.GetCount());
+
+        if (size >= kStreamSize)
+        {
+            GetKernels().set_(destination_data,
+                              static_cast<char>(value),
+                              size);
+        }
+        else
+        {
+            std::memset(destination_data, static_cast<int>(value), size);
+        }
+    }
+
+}
+
+// ===========================================================================
+
+#endif
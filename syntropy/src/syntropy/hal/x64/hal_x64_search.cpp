@@ -0,0 +1,448 @@
+#if defined(_M_X64) || defined(__x86_64__)
+
+#include "syntropy/hal/hal_search.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <bit>
+#include <cstdint>
+
+#include "syntropy/hal/x64/hal_x64_cpu.h"
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Search
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+        /// \brief Type of a kernel finding a pair of code-units.
+        using TFindPairKernel = Int (*)(Ptr<std::uint8_t>,
+                                        Int,
+                                        std::uint8_t,
+                                        std::uint8_t,
+                                        Int) noexcept;
+
+        /// \brief Type of a kernel finding any code-unit in a set.
+        using TFindAnyOfKernel = Int (*)(Ptr<std::uint8_t>,
+                                         Int,
+                                         Ptr<std::uint8_t>,
+                                         Int) noexcept;
+
+        /// \brief Type of a kernel comparing two sequences.
+        using TFindMismatchKernel = Int (*)(Ptr<std::uint8_t>,
+                                            Ptr<std::uint8_t>,
+                                            Int) noexcept;
+
+        /// \brief Kernels selected for the host CPU.
+        struct Kernels
+        {
+            /// \brief Pair search kernel.
+            TFindPairKernel find_pair_{ nullptr };
+
+            /// \brief Set search kernel.
+            TFindAnyOfKernel find_any_of_{ nullptr };
+
+            /// \brief Case-insensitive comparison kernel.
+            TFindMismatchKernel find_mismatch_ignore_case_{ nullptr };
+        };
+
+        /// \brief Maximum number of code-units in a set searched by
+        ///        vector kernels. Larger sets are searched via a lookup
+        ///        table, one code-unit at a time.
+        constexpr auto kMaxSetCount = Int{ 16 };
+
+        /// \brief Wrap a raw sequence of code-units in a byte span.
+        [[nodiscard]] Syntropy::Memory::ByteSpan
+        MakeCodeUnits(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            return { reinterpret_cast<Syntropy::Memory::BytePtr>(data),
+                     Syntropy::Memory::ToBytes(size) };
+        }
+
+        /// \brief Access the code-units in a sequence as unsigned values.
+        [[nodiscard]] Ptr<std::uint8_t>
+        GetData(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+        {
+            return reinterpret_cast<Ptr<std::uint8_t>>(code_units.GetData());
+        }
+
+        /// \brief Find a pair of code-units using the portable kernel.
+        Int
+        FindPairGeneric(Ptr<std::uint8_t> data,
+                        Int size,
+                        std::uint8_t first,
+                        std::uint8_t last,
+                        Int distance) noexcept
+        {
+            return Generic::FindPair(MakeCodeUnits(data, size),
+                                     static_cast<Syntropy::Memory::Byte>(first),
+                                     static_cast<Syntropy::Memory::Byte>(last),
+                                     distance);
+        }
+
+        /// \brief Find any code-unit in a set using the portable kernel.
+        Int
+        FindAnyOfGeneric(Ptr<std::uint8_t> data,
+                         Int size,
+                         Ptr<std::uint8_t> set,
+                         Int set_size) noexcept
+        {
+            return Generic::FindAnyOf(MakeCodeUnits(data, size),
+                                      MakeCodeUnits(set, set_size));
+        }
+
+        /// \brief Compare two sequences using the portable kernel.
+        Int
+        FindMismatchIgnoreCaseGeneric(Ptr<std::uint8_t> lhs,
+                                      Ptr<std::uint8_t> rhs,
+                                      Int size) noexcept
+        {
+            return Generic::FindMismatchIgnoreCase(MakeCodeUnits(lhs, size),
+                                                   MakeCodeUnits(rhs, size));
+        }
+
+        /// \brief Find a pair of code-units using SSE2.
+        ///
+        /// Each lane is matched against both the first and the last
+        /// code-unit at once, such that most false candidates are
+        /// discarded without being visited.
+        Int
+        FindPairSSE2(Ptr<std::uint8_t> data,
+                     Int size,
+                     std::uint8_t first,
+                     std::uint8_t last,
+                     Int distance) noexcept
+        {
+            auto first_lane = _mm_set1_epi8(static_cast<char>(first));
+            auto last_lane = _mm_set1_epi8(static_cast<char>(last));
+
+            auto index = Int{ 0 };
+
+            for (; index + distance + 16 <= size; index += 16)
+            {
+                auto head = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + index));
+
+                auto tail = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + index + distance));
+
+                auto match = _mm_and_si128(_mm_cmpeq_epi8(head, first_lane),
+                                           _mm_cmpeq_epi8(tail, last_lane));
+
+                if (auto mask = _mm_movemask_epi8(match))
+                {
+                    return index + std::countr_zero(
+                        static_cast<unsigned>(mask));
+                }
+            }
+
+            return index + FindPairGeneric(data + index,
+                                           size - index,
+                                           first,
+                                           last,
+                                           distance);
+        }
+
+        /// \brief Find any code-unit in a set using SSE2.
+        Int
+        FindAnyOfSSE2(Ptr<std::uint8_t> data,
+                      Int size,
+                      Ptr<std::uint8_t> set,
+                      Int set_size) noexcept
+        {
+            if (set_size > kMaxSetCount)
+            {
+                return FindAnyOfGeneric(data, size, set, set_size);
+            }
+
+            __m128i set_lanes[kMaxSetCount];
+
+            for (auto set_index = Int{ 0 }; set_index < set_size; ++set_index)
+            {
+                set_lanes[set_index] = _mm_set1_epi8(
+                    static_cast<char>(set[set_index]));
+            }
+
+            auto index = Int{ 0 };
+
+            for (; index + 16 <= size; index += 16)
+            {
+                auto lane = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + index));
+
+                auto match = _mm_setzero_si128();
+
+                for (auto set_index = Int{ 0 }; set_index < set_size;
+                     ++set_index)
+                {
+                    match = _mm_or_si128(
+                        match,
+                        _mm_cmpeq_epi8(lane, set_lanes[set_index]));
+                }
+
+                if (auto mask = _mm_movemask_epi8(match))
+                {
+                    return index + std::countr_zero(
+                        static_cast<unsigned>(mask));
+                }
+            }
+
+            return index + FindAnyOfGeneric(data + index,
+                                            size - index,
+                                            set,
+                                            set_size);
+        }
+
+        /// \brief Convert ASCII upper-case letters in a lane to lower-case,
+        ///        using SSE2.
+        [[nodiscard]] __m128i
+        ToLowerSSE2(__m128i lane) noexcept
+        {
+            // Code-units above 0x7F are negative, hence never upper-case.
+
+            auto is_upper = _mm_and_si128(
+                _mm_cmpgt_epi8(lane, _mm_set1_epi8('A' - 1)),
+                _mm_cmplt_epi8(lane, _mm_set1_epi8('Z' + 1)));
+
+            return _mm_or_si128(lane,
+                                _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+        }
+
+        /// \brief Compare two sequences, ignoring case, using SSE2.
+        Int
+        FindMismatchIgnoreCaseSSE2(Ptr<std::uint8_t> lhs,
+                                   Ptr<std::uint8_t> rhs,
+                                   Int size) noexcept
+        {
+            auto index = Int{ 0 };
+
+            for (; index + 16 <= size; index += 16)
+            {
+                auto lhs_lane = ToLowerSSE2(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(lhs + index)));
+
+                auto rhs_lane = ToLowerSSE2(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(rhs + index)));
+
+                auto mask = _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(lhs_lane, rhs_lane));
+
+                if (mask != 0xFFFF)
+                {
+                    return index + std::countr_one(
+                        static_cast<unsigned>(mask));
+                }
+            }
+
+            return index + FindMismatchIgnoreCaseGeneric(lhs + index,
+                                                         rhs + index,
+                                                         size - index);
+        }
+
+        /// \brief Find a pair of code-units using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 Int
+        FindPairAVX2(Ptr<std::uint8_t> data,
+                     Int size,
+                     std::uint8_t first,
+                     std::uint8_t last,
+                     Int distance) noexcept
+        {
+            auto first_lane = _mm256_set1_epi8(static_cast<char>(first));
+            auto last_lane = _mm256_set1_epi8(static_cast<char>(last));
+
+            auto index = Int{ 0 };
+
+            for (; index + distance + 32 <= size; index += 32)
+            {
+                auto head = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + index));
+
+                auto tail = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + index + distance));
+
+                auto match = _mm256_and_si256(
+                    _mm256_cmpeq_epi8(head, first_lane),
+                    _mm256_cmpeq_epi8(tail, last_lane));
+
+                if (auto mask = _mm256_movemask_epi8(match))
+                {
+                    return index + std::countr_zero(
+                        static_cast<unsigned>(mask));
+                }
+            }
+
+            return index + FindPairSSE2(data + index,
+                                        size - index,
+                                        first,
+                                        last,
+                                        distance);
+        }
+
+        /// \brief Find any code-unit in a set using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 Int
+        FindAnyOfAVX2(Ptr<std::uint8_t> data,
+                      Int size,
+                      Ptr<std::uint8_t> set,
+                      Int set_size) noexcept
+        {
+            if (set_size > kMaxSetCount)
+            {
+                return FindAnyOfGeneric(data, size, set, set_size);
+            }
+
+            __m256i set_lanes[kMaxSetCount];
+
+            for (auto set_index = Int{ 0 }; set_index < set_size; ++set_index)
+            {
+                set_lanes[set_index] = _mm256_set1_epi8(
+                    static_cast<char>(set[set_index]));
+            }
+
+            auto index = Int{ 0 };
+
+            for (; index + 32 <= size; index += 32)
+            {
+                auto lane = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + index));
+
+                auto match = _mm256_setzero_si256();
+
+                for (auto set_index = Int{ 0 }; set_index < set_size;
+                     ++set_index)
+                {
+                    match = _mm256_or_si256(
+                        match,
+                        _mm256_cmpeq_epi8(lane, set_lanes[set_index]));
+                }
+
+                if (auto mask = _mm256_movemask_epi8(match))
+                {
+                    return index + std::countr_zero(
+                        static_cast<unsigned>(mask));
+                }
+            }
+
+            return index + FindAnyOfSSE2(data + index,
+                                         size - index,
+                                         set,
+                                         set_size);
+        }
+
+        /// \brief Convert ASCII upper-case letters in a lane to lower-case,
+        ///        using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 __m256i
+        ToLowerAVX2(__m256i lane) noexcept
+        {
+            auto is_upper = _mm256_andnot_si256(
+                _mm256_cmpgt_epi8(lane, _mm256_set1_epi8('Z')),
+                _mm256_cmpgt_epi8(lane, _mm256_set1_epi8('A' - 1)));
+
+            return _mm256_or_si256(
+                lane,
+                _mm256_and_si256(is_upper, _mm256_set1_epi8(0x20)));
+        }
+
+        /// \brief Compare two sequences, ignoring case, using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 Int
+        FindMismatchIgnoreCaseAVX2(Ptr<std::uint8_t> lhs,
+                                   Ptr<std::uint8_t> rhs,
+                                   Int size) noexcept
+        {
+            auto index = Int{ 0 };
+
+            for (; index + 32 <= size; index += 32)
+            {
+                auto lhs_lane = ToLowerAVX2(_mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(lhs + index)));
+
+                auto rhs_lane = ToLowerAVX2(_mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(rhs + index)));
+
+                auto mask = static_cast<unsigned>(_mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(lhs_lane, rhs_lane)));
+
+                if (mask != 0xFFFFFFFFu)
+                {
+                    return index + std::countr_one(mask);
+                }
+            }
+
+            return index + FindMismatchIgnoreCaseSSE2(lhs + index,
+                                                      rhs + index,
+                                                      size - index);
+        }
+
+        /// \brief Get the kernels for the host CPU.
+        ///
+        /// Kernels are selected once, upon first use.
+        [[nodiscard]] Immutable<Kernels>
+        GetKernels() noexcept
+        {
+            static const auto kernels = []() noexcept
+            {
+                if (CPU::HasAVX2())
+                {
+                    return Kernels{ &FindPairAVX2,
+                                    &FindAnyOfAVX2,
+                                    &FindMismatchIgnoreCaseAVX2 };
+                }
+
+                return Kernels{ &FindPairSSE2,
+                                &FindAnyOfSSE2,
+                                &FindMismatchIgnoreCaseSSE2 };
+            }();
+
+            return kernels;
+        }
+    }
+
+    // Search.
+    // =======
+
+    [[nodiscard]] Int
+    FindPair(Immutable<Syntropy::Memory::ByteSpan> code_units,
+             Syntropy::Memory::Byte first,
+             Syntropy::Memory::Byte last,
+             Int distance) noexcept
+    {
+        return GetKernels().find_pair_(GetData(code_units),
+                                       ToInt(code_units.GetCount()),
+                                       static_cast<std::uint8_t>(first),
+                                       static_cast<std::uint8_t>(last),
+                                       distance);
+    }
+
+    [[nodiscard]] Int
+    FindAnyOf(Immutable<Syntropy::Memory::ByteSpan> code_units,
+              Immutable<Syntropy::Memory::ByteSpan> set) noexcept
+    {
+        return GetKernels().find_any_of_(GetData(code_units),
+                                         ToInt(code_units.GetCount()),
+                                         GetData(set),
+                                         ToInt(set.GetCount()));
+    }
+
+    [[nodiscard]] Int
+    FindMismatchIgnoreCase(Immutable<Syntropy::Memory::ByteSpan> lhs,
+                           Immutable<Syntropy::Memory::ByteSpan> rhs)
+        noexcept
+    {
+        auto size = ToInt(lhs.GetCount() < rhs.GetCount() ? lhs.GetCount()
+                                                          : rhs.GetCount());
+
+        return GetKernels().find_mismatch_ignore_case_(GetData(lhs),
+                                                       GetData(rhs),
+                                                       size);
+    }
+
+}
+
+// ===========================================================================
+
+#endif
@@ -0,0 +1,524 @@
+#if defined(_M_X64) || defined(__x86_64__)
+
+#include "syntropy/hal/hal_unicode.h"
+
+/************************************************************************/
+/* HEADERS & LIBRARIES                                                  */
+/************************************************************************/
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+#include "syntropy/hal/x64/hal_x64_cpu.h"
+
+// ===========================================================================
+
+namespace Syntropy::HAL::Unicode
+{
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    namespace
+    {
+        /// \brief Type of a kernel validating UTF-8 code-units.
+        using TValidateKernel = Bool (*)(Ptr<std::uint8_t>, Int) noexcept;
+
+        /// \brief Type of a kernel counting code-units matching a
+        ///        criterion.
+        using TCountKernel = Int (*)(Ptr<std::uint8_t>, Int) noexcept;
+
+        /// \brief Kernels selected for the host CPU.
+        struct Kernels
+        {
+            /// \brief UTF-8 validation kernel.
+            TValidateKernel validate_{ nullptr };
+
+            /// \brief Code-point counting kernel.
+            TCountKernel count_code_points_{ nullptr };
+
+            /// \brief UTF-16 code-unit counting kernel.
+            TCountKernel count_utf16_{ nullptr };
+
+            /// \brief ASCII prefix counting kernel.
+            TCountKernel count_ascii_{ nullptr };
+        };
+
+        // Error flags of a pair of consecutive code-units.
+        // See Keiser, Lemire - "Validating UTF-8 In Less Than One
+        // Instruction Per Byte", 2021.
+
+        /// \brief 11______ 0_______ or 11______ 11______.
+        constexpr auto kTooShort = std::uint8_t{ 1 << 0 };
+
+        /// \brief 0_______ 10______.
+        constexpr auto kTooLong = std::uint8_t{ 1 << 1 };
+
+        /// \brief 11100000 100_____.
+        constexpr auto kOverlong3 = std::uint8_t{ 1 << 2 };
+
+        /// \brief 11110100 1001____ and any greater lead.
+        constexpr auto kTooLarge = std::uint8_t{ 1 << 3 };
+
+        /// \brief 11101101 101_____.
+        constexpr auto kSurrogate = std::uint8_t{ 1 << 4 };
+
+        /// \brief 1100000_ 10______.
+        constexpr auto kOverlong2 = std::uint8_t{ 1 << 5 };
+
+        /// \brief 11110101 1000____ and any greater lead, or
+        ///        11110000 1000____.
+        constexpr auto kTooLarge1000 = std::uint8_t{ 1 << 6 };
+
+        /// \brief 11110000 1000____.
+        constexpr auto kOverlong4 = std::uint8_t{ 1 << 6 };
+
+        /// \brief 10______ 10______.
+        constexpr auto kTwoContinuations = std::uint8_t{ 1 << 7 };
+
+        /// \brief Errors depending on the high nibble of the first byte
+        ///        only.
+        constexpr auto kCarry = std::uint8_t{ kTooShort
+                                            | kTooLong
+                                            | kTwoContinuations };
+
+        /// \brief Errors by high nibble of the first code-unit.
+        alignas(16) constexpr std::uint8_t kFirstHigh[16] =
+        {
+            kTooLong, kTooLong, kTooLong, kTooLong,
+            kTooLong, kTooLong, kTooLong, kTooLong,
+            kTwoContinuations, kTwoContinuations,
+            kTwoContinuations, kTwoContinuations,
+            kTooShort | kOverlong2,
+            kTooShort,
+            kTooShort | kOverlong3 | kSurrogate,
+            kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+        };
+
+        /// \brief Errors by low nibble of the first code-unit.
+        alignas(16) constexpr std::uint8_t kFirstLow[16] =
+        {
+            kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+            kCarry | kOverlong2,
+            kCarry,
+            kCarry,
+            kCarry | kTooLarge,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+            kCarry | kTooLarge | kTooLarge1000,
+            kCarry | kTooLarge | kTooLarge1000,
+        };
+
+        /// \brief Errors by high nibble of the second code-unit.
+        alignas(16) constexpr std::uint8_t kSecondHigh[16] =
+        {
+            kTooShort, kTooShort, kTooShort, kTooShort,
+            kTooShort, kTooShort, kTooShort, kTooShort,
+            kTooLong | kOverlong2 | kTwoContinuations | kOverlong3
+                | kTooLarge1000 | kOverlong4,
+            kTooLong | kOverlong2 | kTwoContinuations | kOverlong3
+                | kTooLarge,
+            kTooLong | kOverlong2 | kTwoContinuations | kSurrogate
+                | kTooLarge,
+            kTooLong | kOverlong2 | kTwoContinuations | kSurrogate
+                | kTooLarge,
+            kTooShort, kTooShort, kTooShort, kTooShort,
+        };
+
+        /// \brief Maximum value of the last code-units in a block, such that
+        ///        no sequence is left incomplete.
+        alignas(32) constexpr std::uint8_t kIncomplete[32] =
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+        };
+
+        /// \brief Wrap a raw sequence of code-units in a byte span.
+        [[nodiscard]] Syntropy::Memory::ByteSpan
+        MakeCodeUnits(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            return { reinterpret_cast<Syntropy::Memory::BytePtr>(data),
+                     Syntropy::Memory::ToBytes(size) };
+        }
+
+        /// \brief Validate UTF-8 code-units using the portable kernel.
+        Bool
+        ValidateGeneric(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            return Generic::IsValidUTF8(MakeCodeUnits(data, size));
+        }
+
+        /// \brief Count leading code-units using SSE2.
+        Int
+        CountCodePointsSSE2(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            // Continuation code-units are the only ones below -64, as
+            // signed values.
+
+            auto threshold = _mm_set1_epi8(-65);
+
+            auto count = Int{ 0 };
+            auto index = Int{ 0 };
+
+            for (; index + 16 <= size; index += 16)
+            {
+                auto lane = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + index));
+
+                auto mask = _mm_movemask_epi8(_mm_cmpgt_epi8(lane, threshold));
+
+                count += std::popcount(static_cast<unsigned>(mask));
+            }
+
+            return count + Generic::CountCodePoints(
+                MakeCodeUnits(data + index, size - index));
+        }
+
+        /// \brief Count UTF-16 code-units using SSE2.
+        Int
+        CountUTF16SSE2(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            // Four-byte leading code-units are the only ones above -17, as
+            // signed values, among negative ones.
+
+            auto threshold = _mm_set1_epi8(-65);
+            auto four_bytes = _mm_set1_epi8(-17);
+
+            auto count = Int{ 0 };
+            auto index = Int{ 0 };
+
+            for (; index + 16 <= size; index += 16)
+            {
+                auto lane = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + index));
+
+                auto leading = _mm_cmpgt_epi8(lane, threshold);
+
+                auto supplementary = _mm_and_si128(
+                    _mm_cmpgt_epi8(lane, four_bytes),
+                    _mm_cmplt_epi8(lane, _mm_setzero_si128()));
+
+                count += std::popcount(static_cast<unsigned>(
+                    _mm_movemask_epi8(leading)));
+
+                count += std::popcount(static_cast<unsigned>(
+                    _mm_movemask_epi8(supplementary)));
+            }
+
+            return count + Generic::CountUTF16(
+                MakeCodeUnits(data + index, size - index));
+        }
+
+        /// \brief Count leading ASCII code-units using SSE2.
+        Int
+        CountASCIISSE2(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            auto index = Int{ 0 };
+
+            for (; index + 16 <= size; index += 16)
+            {
+                auto lane = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(data + index));
+
+                if (auto mask = _mm_movemask_epi8(lane))
+                {
+                    return index + std::countr_zero(
+                        static_cast<unsigned>(mask));
+                }
+            }
+
+            return index + Generic::CountASCII(
+                MakeCodeUnits(data + index, size - index));
+        }
+
+        /// \brief Look up sixteen-entry table by each code-unit in a lane.
+        SYNTROPY_HAL_TARGET_AVX2 __m256i
+        Lookup(Ptr<std::uint8_t> table, __m256i indices) noexcept
+        {
+            auto entries = _mm256_broadcastsi128_si256(
+                _mm_load_si128(reinterpret_cast<const __m128i*>(table)));
+
+            return _mm256_shuffle_epi8(entries, indices);
+        }
+
+        /// \brief Get the high nibble of each code-unit in a lane.
+        SYNTROPY_HAL_TARGET_AVX2 __m256i
+        GetHighNibbles(__m256i lane) noexcept
+        {
+            return _mm256_and_si256(_mm256_srli_epi16(lane, 4),
+                                    _mm256_set1_epi8(0x0F));
+        }
+
+        /// \brief Shift a lane by count code-units, shifting in the last
+        ///        code-units of the previous lane.
+        template <int VCount>
+        SYNTROPY_HAL_TARGET_AVX2 __m256i
+        Previous(__m256i lane, __m256i previous_lane) noexcept
+        {
+            auto carry = _mm256_permute2x128_si256(previous_lane, lane, 0x21);
+
+            return _mm256_alignr_epi8(lane, carry, 16 - VCount);
+        }
+
+        /// \brief State of an AVX2 UTF-8 validation.
+        struct ValidationAVX2
+        {
+            /// \brief Accumulated errors.
+            __m256i error_;
+
+            /// \brief Previous lane.
+            __m256i previous_;
+
+            /// \brief Sequences left incomplete by the previous lane.
+            __m256i incomplete_;
+        };
+
+        /// \brief Validate a lane of 32 code-units.
+        SYNTROPY_HAL_TARGET_AVX2 void
+        ValidateLaneAVX2(Mutable<ValidationAVX2> state, __m256i lane)
+            noexcept
+        {
+            // ASCII lanes can only complete a sequence left open by the
+            // previous lane.
+
+            if (_mm256_movemask_epi8(lane) == 0)
+            {
+                state.error_ = _mm256_or_si256(state.error_,
+                                               state.incomplete_);
+                return;
+            }
+
+            auto previous1 = Previous<1>(lane, state.previous_);
+            auto previous2 = Previous<2>(lane, state.previous_);
+            auto previous3 = Previous<3>(lane, state.previous_);
+
+            // Errors detected on each pair of consecutive code-units.
+
+            auto first_high = Lookup(kFirstHigh, GetHighNibbles(previous1));
+
+            auto first_low = Lookup(
+                kFirstLow,
+                _mm256_and_si256(previous1, _mm256_set1_epi8(0x0F)));
+
+            auto second_high = Lookup(kSecondHigh, GetHighNibbles(lane));
+
+            auto special = _mm256_and_si256(
+                _mm256_and_si256(first_high, first_low),
+                second_high);
+
+            // Third and fourth code-units of a sequence must be
+            // continuations, which are flagged as two continuations above.
+
+            auto third = _mm256_subs_epu8(previous2,
+                                          _mm256_set1_epi8(0xE0 - 0x80));
+
+            auto fourth = _mm256_subs_epu8(previous3,
+                                           _mm256_set1_epi8(0xF0 - 0x80));
+
+            auto continuation = _mm256_and_si256(
+                _mm256_or_si256(third, fourth),
+                _mm256_set1_epi8(static_cast<char>(0x80)));
+
+            state.error_ = _mm256_or_si256(
+                state.error_,
+                _mm256_xor_si256(continuation, special));
+
+            state.incomplete_ = _mm256_subs_epu8(
+                lane,
+                _mm256_load_si256(reinterpret_cast<const __m256i*>(
+                    kIncomplete)));
+
+            state.previous_ = lane;
+        }
+
+        /// \brief Validate UTF-8 code-units using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 Bool
+        ValidateAVX2(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            auto state = ValidationAVX2{ _mm256_setzero_si256(),
+                                         _mm256_setzero_si256(),
+                                         _mm256_setzero_si256() };
+
+            auto index = Int{ 0 };
+
+            for (; index + 32 <= size; index += 32)
+            {
+                ValidateLaneAVX2(state, _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + index)));
+            }
+
+            // The last lane is padded with ASCII code-units.
+
+            if (index < size)
+            {
+                alignas(32) std::uint8_t tail[32] = {};
+
+                std::memcpy(tail, data + index, size - index);
+
+                ValidateLaneAVX2(state, _mm256_load_si256(
+                    reinterpret_cast<const __m256i*>(tail)));
+            }
+
+            auto error = _mm256_or_si256(state.error_, state.incomplete_);
+
+            return _mm256_testz_si256(error, error) != 0;
+        }
+
+        /// \brief Count leading code-units using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 Int
+        CountCodePointsAVX2(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            auto threshold = _mm256_set1_epi8(-65);
+
+            auto count = Int{ 0 };
+            auto index = Int{ 0 };
+
+            for (; index + 32 <= size; index += 32)
+            {
+                auto lane = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + index));
+
+                auto mask = _mm256_movemask_epi8(
+                    _mm256_cmpgt_epi8(lane, threshold));
+
+                count += std::popcount(static_cast<unsigned>(mask));
+            }
+
+            return count + CountCodePointsSSE2(data + index, size - index);
+        }
+
+        /// \brief Count UTF-16 code-units using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 Int
+        CountUTF16AVX2(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            auto threshold = _mm256_set1_epi8(-65);
+            auto four_bytes = _mm256_set1_epi8(-17);
+
+            auto count = Int{ 0 };
+            auto index = Int{ 0 };
+
+            for (; index + 32 <= size; index += 32)
+            {
+                auto lane = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + index));
+
+                auto leading = _mm256_cmpgt_epi8(lane, threshold);
+
+                auto supplementary = _mm256_andnot_si256(
+                    _mm256_cmpgt_epi8(lane, _mm256_set1_epi8(-1)),
+                    _mm256_cmpgt_epi8(lane, four_bytes));
+
+                count += std::popcount(static_cast<unsigned>(
+                    _mm256_movemask_epi8(leading)));
+
+                count += std::popcount(static_cast<unsigned>(
+                    _mm256_movemask_epi8(supplementary)));
+            }
+
+            return count + CountUTF16SSE2(data + index, size - index);
+        }
+
+        /// \brief Count leading ASCII code-units using AVX2.
+        SYNTROPY_HAL_TARGET_AVX2 Int
+        CountASCIIAVX2(Ptr<std::uint8_t> data, Int size) noexcept
+        {
+            auto index = Int{ 0 };
+
+            for (; index + 32 <= size; index += 32)
+            {
+                auto lane = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(data + index));
+
+                if (auto mask = _mm256_movemask_epi8(lane))
+                {
+                    return index + std::countr_zero(
+                        static_cast<unsigned>(mask));
+                }
+            }
+
+            return index + CountASCIISSE2(data + index, size - index);
+        }
+
+        /// \brief Get the kernels for the host CPU.
+        ///
+        /// Kernels are selected once, upon first use.
+        [[nodiscard]] Immutable<Kernels>
+        GetKernels() noexcept
+        {
+            static const auto kernels = []() noexcept
+            {
+                if (CPU::HasAVX2())
+                {
+                    return Kernels{ &ValidateAVX2,
+                                    &CountCodePointsAVX2,
+                                    &CountUTF16AVX2,
+                                    &CountASCIIAVX2 };
+                }
+
+                // SSE2 is part of the x64 baseline, but lacks the byte
+                // shuffles needed by vectorized validation.
+
+                return Kernels{ &ValidateGeneric,
+                                &CountCodePointsSSE2,
+                                &CountUTF16SSE2,
+                                &CountASCIISSE2 };
+            }();
+
+            return kernels;
+        }
+
+        /// \brief Access the code-units in a sequence as unsigned values.
+        [[nodiscard]] Ptr<std::uint8_t>
+        GetData(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+        {
+            return reinterpret_cast<Ptr<std::uint8_t>>(code_units.GetData());
+        }
+    }
+
+    // Unicode.
+    // ========
+
+    [[nodiscard]] Bool
+    IsValidUTF8(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        return GetKernels().validate_(GetData(code_units),
+                                      ToInt(code_units.GetCount()));
+    }
+
+    [[nodiscard]] Int
+    CountCodePoints(Immutable<Syntropy::Memory::ByteSpan> code_units)
+        noexcept
+    {
+        return GetKernels().count_code_points_(GetData(code_units),
+                                               ToInt(code_units.GetCount()));
+    }
+
+    [[nodiscard]] Int
+    CountUTF16(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        return GetKernels().count_utf16_(GetData(code_units),
+                                         ToInt(code_units.GetCount()));
+    }
+
+    [[nodiscard]] Int
+    CountASCII(Immutable<Syntropy::Memory::ByteSpan> code_units) noexcept
+    {
+        return GetKernels().count_ascii_(GetData(code_units),
+                                         ToInt(code_units.GetCount()));
+    }
+
+}
+
+// ===========================================================================
+
+#endif
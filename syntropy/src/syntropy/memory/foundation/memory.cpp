@@ -1,14 +1,15 @@
-
 /// \file memory.cpp
 ///
 /// \author Raffaele D. Facendola - February 2021
 
 #include "syntropy/memory/foundation/memory.h"
 
-#include "syntropy/core/ranges/contiguous_range.h"
+#include <cstring>
 
 #include "syntropy/math/math.h"
 
+#include "syntropy/hal/hal_memory.h"
+
 // ===========================================================================
 
 namespace Syntropy::Memory
@@ -24,30 +25,61 @@ namespace Syntropy::Memory
 
         if (size > Bytes{ 0 })
         {
-            // auto destination_span = Ranges::Front(destination, size);
+            auto destination_span = RWByteSpan{ destination.GetData(), size };
+            auto source_span = ByteSpan{ source.GetData(), size };
 
-            // auto source_span = Ranges::Front(source, size);
+            auto destination_end = destination_span.GetData() + size;
+            auto source_end = source_span.GetData() + size;
 
-            // if (!Ranges::Intersect(destination_span, source_span))
+            if ((destination_span.GetData() < source_end) &&
+                (source_span.GetData() < destination_end))
             {
-                // Faster copy for non-overlapping ranges.
+                // Slower copy for overlapping ranges.
 
-                std::memcpy(destination.GetData(),
-                            source.GetData(),
-                            ToInt(size));
+                std::memmove(destination_span.GetData(),
+                             source_span.GetData(),
+                             ToInt(size));
             }
-            //else
+            else
             {
-                // Slower copy for overlapping ranges.
+                // Faster copy for non-overlapping ranges.
 
-                std::memmove(destination.GetData(),
-                             source.GetData(),
-                             ToInt(size));
+                HAL::Memory::Copy(destination_span, source_span);
             }
         }
 
         return size;
     }
+
+    void
+    Repeat(Immutable<RWByteSpan> destination, Immutable<ByteSpan> source)
+    {
+        auto size = destination.GetCount();
+
+        auto count = Copy(destination, source);
+
+        // Copy the filled region after itself, doubling it at each step.
+
+        while ((count > Bytes{ 0 }) && (count < size))
+        {
+            auto filled_span = ByteSpan{ destination.GetData(), count };
+
+            auto empty_span = RWByteSpan{ destination.GetData() + count,
+                                          size - count };
+
+            count += Copy(empty_span, filled_span);
+        }
+    }
+
+    void
+    Set(Immutable<RWByteSpan> destination, Byte value)
+    {
+        if (destination.GetCount() > Bytes{ 0 })
+        {
+            HAL::Memory::Set(destination, value);
+        }
+    }
+
 }
 
 // ===========================================================================
@@ -0,0 +1,79 @@
+/// \file virtual_memory.cpp
+///
+/// \author Raffaele D. Facendola - 2017
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+
+#include "syntropy/hal/hal_virtual_memory.h"
+
+// ===========================================================================
+
+namespace Syntropy::VirtualMemory
+{
+    /************************************************************************/
+    /* VIRTUAL MEMORY                                                       */
+    /************************************************************************/
+
+    [[nodiscard]] Memory::Bytes
+    GetPageSize() noexcept
+    {
+        return HAL::VirtualMemory::GetPageSize();
+    }
+
+    [[nodiscard]] Memory::Alignment
+    GetPageAlignment() noexcept
+    {
+        return HAL::VirtualMemory::GetPageAlignment();
+    }
+
+    [[nodiscard]] Memory::RWByteSpan
+    Reserve(Memory::Bytes size) noexcept
+    {
+        return HAL::VirtualMemory::Reserve(size);
+    }
+
+    [[nodiscard]] Memory::RWByteSpan
+    Allocate(Memory::Bytes size) noexcept
+    {
+        return HAL::VirtualMemory::Allocate(size);
+    }
+
+    Bool
+    Release(Immutable<Memory::RWByteSpan> block) noexcept
+    {
+        return HAL::VirtualMemory::Release(block);
+    }
+
+    Bool
+    Commit(Immutable<Memory::RWByteSpan> block, CommitMode mode) noexcept
+    {
+        return HAL::VirtualMemory::Commit(block, mode);
+    }
+
+    Bool
+    Decommit(Immutable<Memory::RWByteSpan> block) noexcept
+    {
+        return HAL::VirtualMemory::Decommit(block);
+    }
+
+    [[nodiscard]] Int
+    GetNodeCount() noexcept
+    {
+        return HAL::VirtualMemory::GetNodeCount();
+    }
+
+    [[nodiscard]] Int
+    GetCurrentNode() noexcept
+    {
+        return HAL::VirtualMemory::GetCurrentNode();
+    }
+
+    Bool
+    Bind(Immutable<Memory::RWByteSpan> block, Int node) noexcept
+    {
+        return HAL::VirtualMemory::Bind(block, node);
+    }
+
+}
+
+// ===========================================================================
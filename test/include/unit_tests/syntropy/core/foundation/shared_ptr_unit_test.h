@@ -0,0 +1,356 @@
+/// \file shared_ptr_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+#include "syntropy/core/foundation/shared_ptr.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* SHARED PTR TEST FIXTURE                                              */
+    /************************************************************************/
+
+    /// \brief Shared pointer test fixture.
+    struct SharedPtrTestFixture
+    {
+        /// \brief Event recorded when a shared object is destroyed.
+        static constexpr Int kDestroyed = 1;
+
+        /// \brief Event recorded when a shared object storage is
+        ///        deallocated.
+        static constexpr Int kDeallocated = 2;
+
+        /// \brief Number of threads sharing the same object.
+        static constexpr Int kThreadCount = 8;
+
+        /// \brief Number of references acquired by each thread.
+        static constexpr Int kRoundCount = 10000;
+
+        /// \brief Allocator recording the blocks it deallocates.
+        struct CountingAllocator : Memory::BaseAllocator
+        {
+            /// \brief Number of blocks allocated so far.
+            Int allocation_count_{ 0 };
+
+            /// \brief Events recorded so far, in order.
+            std::vector<Int> events_;
+
+            /// \brief Sum of the values of the last object destroyed.
+            Int sum_{ 0 };
+
+            [[nodiscard]] Memory::RWByteSpan
+            Allocate(Memory::Bytes size,
+                     Memory::Alignment alignment) noexcept override;
+
+            void
+            Deallocate(Immutable<Memory::RWByteSpan> block,
+                       Memory::Alignment alignment) noexcept override;
+        };
+
+        /// \brief Object recording its own destruction.
+        struct Tracked
+        {
+            /// \brief Allocator the object records its destruction on.
+            RWPtr<CountingAllocator> allocator_{ nullptr };
+
+            /// \brief Values written through shared pointers.
+            std::vector<Int> values_;
+
+            /// \brief Create a new object.
+            Tracked(Mutable<CountingAllocator> allocator, Int count) noexcept;
+
+            /// \brief Record the object destruction.
+            ~Tracked() noexcept;
+        };
+
+        /// \brief Allocator.
+        CountingAllocator allocator_;
+
+        /// \brief Executed before each test case.
+        void Before();
+
+        /// \brief Share an object among strong and weak references and
+        ///        release them, counting events that either happened out
+        ///        of order or didn't happen at all.
+        template <typename TPolicy>
+        [[nodiscard]] static Int
+        CountReleaseFailures(Mutable<SharedPtrTestFixture> fixture) noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& shared_ptr_unit_test
+        = MakeAutoUnitTest<SharedPtrTestFixture>(
+            u8"shared_ptr.foundation.core.syntropy")
+
+    .TestCase(u8"Copies share the ownership of the object, moves transfer "
+              u8"it.", [](auto& fixture)
+    {
+        auto shared = MakeRWSharedOnAllocator<SharedPtrTestFixture::Tracked,
+                                              LocalCountPolicy>(
+            fixture.allocator_, fixture.allocator_, 1);
+
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.allocation_count_, 1);
+        SYNTROPY_UNIT_EQUAL(shared.GetCount(), 1);
+
+        auto copy = shared;
+
+        SYNTROPY_UNIT_EQUAL(shared.GetCount(), 2);
+        SYNTROPY_UNIT_EQUAL(copy.Get() == shared.Get(), true);
+
+        auto moved = Move(copy);
+
+        SYNTROPY_UNIT_EQUAL(shared.GetCount(), 2);
+        SYNTROPY_UNIT_EQUAL(Bool{ copy }, false);
+
+        moved.Reset();
+
+        SYNTROPY_UNIT_EQUAL(shared.GetCount(), 1);
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.events_.empty(), true);
+
+        shared.Reset();
+
+        SYNTROPY_UNIT_EQUAL((fixture.allocator_.events_
+                             == std::vector<Int>{
+                                 fixture.kDestroyed,
+                                 fixture.kDeallocated }), true);
+    })
+
+    .TestCase(u8"Weak references don't keep the object alive, but keep its "
+              u8"storage allocated, with local counts.", [](auto& fixture)
+    {
+        SYNTROPY_UNIT_EQUAL(SharedPtrTestFixture
+                            ::CountReleaseFailures<LocalCountPolicy>(
+                                fixture), 0);
+    })
+
+    .TestCase(u8"Weak references don't keep the object alive, but keep its "
+              u8"storage allocated, with concurrent counts.",
+              [](auto& fixture)
+    {
+        SYNTROPY_UNIT_EQUAL(SharedPtrTestFixture
+                            ::CountReleaseFailures<ConcurrentCountPolicy>(
+                                fixture), 0);
+    })
+
+    .TestCase(u8"Aliasing pointers keep the owner alive.", [](auto& fixture)
+    {
+        auto shared = MakeRWSharedOnAllocator<SharedPtrTestFixture::Tracked,
+                                              LocalCountPolicy>(
+            fixture.allocator_, fixture.allocator_, 1);
+
+        auto alias = RWSharedPtr<std::vector<Int>, LocalCountPolicy>{
+            shared, &shared->values_ };
+
+        SYNTROPY_UNIT_EQUAL(alias.GetCount(), 2);
+
+        shared.Reset();
+
+        SYNTROPY_UNIT_EQUAL(alias.GetCount(), 1);
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.events_.empty(), true);
+        SYNTROPY_UNIT_EQUAL(Int(alias->size()), 1);
+
+        alias.Reset();
+
+        SYNTROPY_UNIT_EQUAL((fixture.allocator_.events_
+                             == std::vector<Int>{
+                                 fixture.kDestroyed,
+                                 fixture.kDeallocated }), true);
+    })
+
+    .TestCase(u8"The last concurrent reference destroys the object once, "
+              u8"after observing every write performed through other "
+              u8"references.", [](auto& fixture)
+    {
+        using TPointer = RWSharedPtr<SharedPtrTestFixture::Tracked>;
+
+        auto shared = MakeRWSharedOnAllocator<SharedPtrTestFixture::Tracked,
+                                              ConcurrentCountPolicy>(
+            fixture.allocator_, fixture.allocator_, fixture.kThreadCount);
+
+        auto weak = RWWeakPtr<SharedPtrTestFixture::Tracked>{ shared };
+
+        // Each thread writes its own slot and releases its reference: the
+        // object is destroyed by whichever thread happens to be the last.
+
+        auto references = std::vector<TPointer>(fixture.kThreadCount,
+                                                shared);
+
+        shared.Reset();
+
+        auto threads = std::vector<std::thread>{};
+
+        for (auto index = Int{ 0 }; index < fixture.kThreadCount; ++index)
+        {
+            threads.emplace_back([&fixture, &references, &weak, index]()
+            {
+                for (auto round = Int{ 0 }; round < fixture.kRoundCount;
+                     ++round)
+                {
+                    auto copy = references[index];
+                    auto locked = weak.Lock();
+
+                    ++copy->values_[index];
+                    ++locked->values_[index];
+                }
+
+                references[index].Reset();
+            });
+        }
+
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+
+        SYNTROPY_UNIT_EQUAL(weak.IsExpired(), true);
+        SYNTROPY_UNIT_EQUAL(Bool{ weak.Lock() }, false);
+        SYNTROPY_UNIT_EQUAL((fixture.allocator_.events_
+                             == std::vector<Int>{ fixture.kDestroyed }),
+                            true);
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.sum_,
+                            2 * fixture.kThreadCount * fixture.kRoundCount);
+
+        weak.Reset();
+
+        SYNTROPY_UNIT_EQUAL((fixture.allocator_.events_
+                             == std::vector<Int>{
+                                 fixture.kDestroyed,
+                                 fixture.kDeallocated }), true);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // SharedPtrTestFixture.
+
+    inline void SharedPtrTestFixture::Before()
+    {
+        allocator_.allocation_count_ = 0;
+        allocator_.events_.clear();
+        allocator_.sum_ = 0;
+    }
+
+    template <typename TPolicy>
+    [[nodiscard]] inline Int SharedPtrTestFixture
+    ::CountReleaseFailures(Mutable<SharedPtrTestFixture> fixture) noexcept
+    {
+        auto& events = fixture.allocator_.events_;
+
+        auto failure_count = Int{ 0 };
+
+        auto shared = MakeRWSharedOnAllocator<Tracked, TPolicy>(
+            fixture.allocator_, fixture.allocator_, 1);
+
+        auto weak = RWWeakPtr<Tracked, TPolicy>{ shared };
+        auto other = weak;
+
+        // Locking a live object acquires a new strong reference.
+
+        if (auto locked = weak.Lock(); !locked || (shared.GetCount() != 2))
+        {
+            ++failure_count;
+        }
+
+        if ((shared.GetCount() != 1) || weak.IsExpired())
+        {
+            ++failure_count;
+        }
+
+        // The last strong reference destroys the object only.
+
+        shared.Reset();
+
+        if ((events != std::vector<Int>{ kDestroyed })
+            || !weak.IsExpired()
+            || weak.Lock())
+        {
+            ++failure_count;
+        }
+
+        // The last weak reference deallocates the storage.
+
+        weak.Reset();
+
+        if (events.size() != 1)
+        {
+            ++failure_count;
+        }
+
+        other.Reset();
+
+        if (events != std::vector<Int>{ kDestroyed, kDeallocated })
+        {
+            ++failure_count;
+        }
+
+        return failure_count;
+    }
+
+    // SharedPtrTestFixture :: CountingAllocator.
+
+    [[nodiscard]] inline Memory::RWByteSpan
+    SharedPtrTestFixture::CountingAllocator
+    ::Allocate(Memory::Bytes size, Memory::Alignment alignment) noexcept
+    {
+        ++allocation_count_;
+
+        return Memory::GetSystemAllocator().Allocate(size, alignment);
+    }
+
+    inline void
+    SharedPtrTestFixture::CountingAllocator
+    ::Deallocate(Immutable<Memory::RWByteSpan> block,
+                 Memory::Alignment alignment) noexcept
+    {
+        events_.emplace_back(kDeallocated);
+
+        Memory::GetSystemAllocator().Deallocate(block, alignment);
+    }
+
+    // SharedPtrTestFixture :: Tracked.
+
+    inline SharedPtrTestFixture::Tracked
+    ::Tracked(Mutable<CountingAllocator> allocator, Int count) noexcept
+        : allocator_(&allocator)
+        , values_(count)
+    {
+
+    }
+
+    inline SharedPtrTestFixture::Tracked
+    ::~Tracked() noexcept
+    {
+        allocator_->sum_ = 0;
+
+        for (auto&& value : values_)
+        {
+            allocator_->sum_ += value;
+        }
+
+        allocator_->events_.emplace_back(kDestroyed);
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,165 @@
+/// \file label_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/core/strings/string_view.h"
+#include "syntropy/core/strings/label.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* LABEL TEST FIXTURE                                                   */
+    /************************************************************************/
+
+    /// \brief Label test fixture.
+    struct LabelTestFixture
+    {
+        /// \brief Characters of a label, not known at compile time.
+        char runtime_characters_[9] = "rpc.ping";
+
+        /// \brief Get a view to the characters of a runtime label.
+        [[nodiscard]] StringView
+        GetRuntimeView() const noexcept
+        {
+            auto data = Memory::ToBytePtr(runtime_characters_);
+
+            return StringView{ Memory::MakeByteSpan(data,
+                                                    Memory::ToBytes(8)) };
+        }
+
+        /// \brief Intern a label whose characters depend on an index,
+        ///        not known at compile time.
+        [[nodiscard]] static Label
+        MakeIndexedLabel(Int index) noexcept
+        {
+            char characters[] = "rpc.xx";
+
+            characters[4] = static_cast<char>('a' + ((index >> 4) & 15));
+            characters[5] = static_cast<char>('a' + (index & 15));
+
+            auto data = Memory::ToBytePtr(characters);
+
+            return Label{ StringView{ Memory::MakeByteSpan(
+                data, Memory::ToBytes(6)) } };
+        }
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& label_unit_test
+        = MakeAutoUnitTest<LabelTestFixture>(u8"label.strings.core.syntropy")
+
+    .TestCase(u8"Labels created from the same characters are equal.",
+              [](auto& fixture)
+    {
+        SYNTROPY_UNIT_EQUAL(Label{ u8"rpc.ping" } == Label{ u8"rpc.ping" },
+                            true);
+
+        SYNTROPY_UNIT_EQUAL(Label{ u8"rpc.ping" } == Label{ u8"rpc.pong" },
+                            false);
+    })
+
+    .TestCase(u8"Labels created from a literal don't include the "
+              u8"null-terminator.", [](auto& fixture)
+    {
+        auto label = Label{ u8"rpc.ping" };
+
+        SYNTROPY_UNIT_EQUAL(ToInt(label.GetCodeUnits().GetCount()), 8);
+        SYNTROPY_UNIT_EQUAL(Label{ u8"" } == Label{}, true);
+    })
+
+    .TestCase(u8"Literal labels are equal to runtime labels with the same "
+              u8"characters.", [](auto& fixture)
+    {
+        using namespace Literals;
+
+        auto runtime_label = Label{ fixture.GetRuntimeView() };
+
+        SYNTROPY_UNIT_EQUAL(u8"rpc.ping"_label == runtime_label, true);
+        SYNTROPY_UNIT_EQUAL("rpc.ping"_label == runtime_label, true);
+        SYNTROPY_UNIT_EQUAL(Label{ u8"rpc.ping" } == runtime_label, true);
+    })
+
+    .TestCase(u8"Literal label hashes match the hash of runtime labels with "
+              u8"the same characters.", [](auto& fixture)
+    {
+        using namespace Literals;
+
+        auto runtime_label = Label{ fixture.GetRuntimeView() };
+
+        SYNTROPY_UNIT_EQUAL(runtime_label.GetHash(),
+                            Label::Hash(u8"rpc.ping"));
+
+        SYNTROPY_UNIT_EQUAL(u8"rpc.ping"_label.GetHash(),
+                            runtime_label.GetHash());
+    })
+
+    .TestCase(u8"Labels interned concurrently from the same characters "
+              u8"refer to the same code-units.", [](auto& fixture)
+    {
+        constexpr auto kThreadCount = Int{ 8 };
+        constexpr auto kLabelCount = Int{ 256 };
+
+        auto labels = std::vector<std::vector<Label>>(kThreadCount);
+        auto threads = std::vector<std::thread>{};
+
+        for (auto thread_index = Int{ 0 }; thread_index < kThreadCount;
+             ++thread_index)
+        {
+            threads.emplace_back([&labels, thread_index]()
+            {
+                auto& thread_labels = labels[thread_index];
+
+                for (auto index = Int{ 0 }; index < kLabelCount; ++index)
+                {
+                    thread_labels.emplace_back(
+                        LabelTestFixture::MakeIndexedLabel(index));
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto mismatch_count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < kLabelCount; ++index)
+        {
+            auto expected = labels[0][index].GetCodeUnits().GetData();
+
+            for (auto& thread_labels : labels)
+            {
+                if (thread_labels[index].GetCodeUnits().GetData()
+                    != expected)
+                {
+                    ++mismatch_count;
+                }
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(mismatch_count, 0);
+        SYNTROPY_UNIT_EQUAL(labels[0][0] == labels[0][1], false);
+    });
+
+}
+
+// ===========================================================================
@@ -0,0 +1,352 @@
+/// \file string_algorithm_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <vector>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/core/strings/string_view.h"
+#include "syntropy/core/strings/string_algorithm.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* STRING ALGORITHM TEST FIXTURE                                        */
+    /************************************************************************/
+
+    /// \brief String algorithm test fixture.
+    struct StringAlgorithmTestFixture
+    {
+        /// \brief Number of code-units in a vector lane.
+        static constexpr Int kLaneSize = 32;
+
+        /// \brief Number of code-units in the text.
+        static constexpr Int kTextSize = 3 * kLaneSize;
+
+        /// \brief Text to search into.
+        char text_[kTextSize];
+
+        /// \brief Fill the text with a character.
+        void
+        Fill(char character) noexcept;
+
+        /// \brief Copy characters to the text, starting from given offset.
+        void
+        Place(Int offset, Immutable<StringView> characters) noexcept;
+
+        /// \brief Get a view to count characters in the text, starting from
+        ///        given offset.
+        [[nodiscard]] StringView
+        GetText(Int offset, Int count) const noexcept;
+
+        /// \brief Get a view to the whole text.
+        [[nodiscard]] StringView
+        GetText() const noexcept;
+
+        /// \brief Get a view to a string literal, without its terminator.
+        template <Int TSize>
+        [[nodiscard]] static StringView
+        ViewOf(const char (&characters)[TSize]) noexcept;
+
+        /// \brief Get the position of the first occurrence of a pattern in
+        ///        a string view, or its size if there's none.
+        [[nodiscard]] static Int
+        IndexOf(Immutable<StringView> string_view,
+                Immutable<StringView> pattern) noexcept;
+
+        /// \brief Get the number of code-units of each view in a range.
+        [[nodiscard]] static std::vector<Int>
+        CountsOf(SplitRange range) noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& string_algorithm_unit_test
+        = MakeAutoUnitTest<StringAlgorithmTestFixture>(
+            u8"string_algorithm.strings.core.syntropy")
+
+    .TestCase(u8"Searching empty code-units finds nothing, while an empty "
+              u8"pattern is found at the front.", [](auto& fixture)
+    {
+        auto empty = fixture.GetText(0, 0);
+
+        fixture.Fill('a');
+
+        SYNTROPY_UNIT_EQUAL(fixture.IndexOf(empty, fixture.ViewOf("a")), 0);
+        SYNTROPY_UNIT_EQUAL(fixture.IndexOf(empty, fixture.ViewOf("ab")), 0);
+        SYNTROPY_UNIT_EQUAL(fixture.IndexOf(empty, empty), 0);
+        SYNTROPY_UNIT_EQUAL(fixture.IndexOf(fixture.GetText(), empty), 0);
+
+        SYNTROPY_UNIT_EQUAL(Strings::Contains(empty, fixture.ViewOf("a")),
+                            false);
+        SYNTROPY_UNIT_EQUAL(Strings::Contains(fixture.GetText(), empty),
+                            true);
+    })
+
+    .TestCase(u8"Patterns of one code-unit are found at any offset.",
+              [](auto& fixture)
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto offset = Int{ 0 }; offset < fixture.kTextSize; ++offset)
+        {
+            fixture.Fill('.');
+            fixture.Place(offset, fixture.ViewOf("x"));
+
+            auto pattern = fixture.ViewOf("x");
+
+            if (fixture.IndexOf(fixture.GetText(), pattern) != offset)
+            {
+                ++failure_count;
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    })
+
+    .TestCase(u8"Patterns of two code-units are found at any offset, "
+              u8"including across the lane boundary.", [](auto& fixture)
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto offset = Int{ 0 }; offset + 1 < fixture.kTextSize;
+             ++offset)
+        {
+            // The first code-unit of the pattern occurs everywhere.
+
+            fixture.Fill('x');
+            fixture.Place(offset + 1, fixture.ViewOf("y"));
+
+            auto pattern = fixture.ViewOf("xy");
+
+            if (fixture.IndexOf(fixture.GetText(), pattern) != offset)
+            {
+                ++failure_count;
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    })
+
+    .TestCase(u8"Matches straddling a lane boundary are found past "
+              u8"near-misses.", [](auto& fixture)
+    {
+        auto failure_count = Int{ 0 };
+
+        auto pattern = fixture.ViewOf("needle");
+
+        for (auto lane : { Int{ 16 }, Int{ 32 }, Int{ 64 } })
+        {
+            for (auto offset = lane - 5; offset < lane; ++offset)
+            {
+                // Near-misses share both ends of the pattern.
+
+                fixture.Fill('.');
+                fixture.Place(0, fixture.ViewOf("neexle"));
+                fixture.Place(offset - 6, fixture.ViewOf("needxe"));
+                fixture.Place(offset, pattern);
+
+                if (fixture.IndexOf(fixture.GetText(), pattern) != offset)
+                {
+                    ++failure_count;
+                }
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    })
+
+    .TestCase(u8"Missing patterns and patterns longer than the code-units "
+              u8"are not found.", [](auto& fixture)
+    {
+        fixture.Fill('x');
+        fixture.Place(fixture.kLaneSize - 1, fixture.ViewOf("y"));
+
+        auto text = fixture.GetText(0, fixture.kLaneSize);
+
+        SYNTROPY_UNIT_EQUAL(fixture.IndexOf(text, fixture.ViewOf("z")),
+                            fixture.kLaneSize);
+        SYNTROPY_UNIT_EQUAL(fixture.IndexOf(text, fixture.ViewOf("yx")),
+                            fixture.kLaneSize);
+        SYNTROPY_UNIT_EQUAL(fixture.IndexOf(fixture.GetText(0, 1),
+                                            fixture.ViewOf("xx")), 1);
+        SYNTROPY_UNIT_EQUAL(Strings::Contains(text, fixture.ViewOf("xy")),
+                            true);
+        SYNTROPY_UNIT_EQUAL(Strings::Contains(text, fixture.ViewOf("yx")),
+                            false);
+    })
+
+    .TestCase(u8"Splitting empty code-units results in a single empty "
+              u8"view, while tokenizing them results in none.",
+              [](auto& fixture)
+    {
+        auto empty = fixture.GetText(0, 0);
+        auto delimiters = fixture.ViewOf(",");
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Split(empty,
+                                                             delimiters))
+                             == std::vector<Int>{ 0 }), true);
+
+        SYNTROPY_UNIT_EQUAL(Strings::Tokenize(empty, delimiters).IsEmpty(),
+                            true);
+    })
+
+    .TestCase(u8"Leading and trailing delimiters delimit empty views when "
+              u8"splitting and are discarded when tokenizing.",
+              [](auto& fixture)
+    {
+        auto delimiters = fixture.ViewOf(",;");
+
+        fixture.Fill('.');
+        fixture.Place(0, fixture.ViewOf(",a;bb,"));
+
+        auto text = fixture.GetText(0, 6);
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Split(text,
+                                                             delimiters))
+                             == std::vector<Int>{ 0, 1, 2, 0 }), true);
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Tokenize(text,
+                                                                delimiters))
+                             == std::vector<Int>{ 1, 2 }), true);
+
+        fixture.Place(0, fixture.ViewOf(";;a,,"));
+
+        auto doubled = fixture.GetText(0, 5);
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Split(doubled,
+                                                             delimiters))
+                             == std::vector<Int>{ 0, 0, 1, 0, 0 }), true);
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Tokenize(doubled,
+                                                                delimiters))
+                             == std::vector<Int>{ 1 }), true);
+
+        auto edges = fixture.GetText(0, 2);
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Split(edges,
+                                                             delimiters))
+                             == std::vector<Int>{ 0, 0, 0 }), true);
+
+        SYNTROPY_UNIT_EQUAL(Strings::Tokenize(edges, delimiters).IsEmpty(),
+                            true);
+    })
+
+    .TestCase(u8"Delimiters around the lane boundary are found.",
+              [](auto& fixture)
+    {
+        auto delimiters = fixture.ViewOf(",");
+
+        fixture.Fill('.');
+
+        for (auto offset : { Int{ 15 }, Int{ 16 }, Int{ 31 }, Int{ 32 },
+                             Int{ 63 } })
+        {
+            fixture.Place(offset, delimiters);
+        }
+
+        auto text = fixture.GetText();
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Split(text,
+                                                             delimiters))
+                             == std::vector<Int>{ 15, 0, 14, 0, 30, 32 }),
+                            true);
+
+        SYNTROPY_UNIT_EQUAL((fixture.CountsOf(Strings::Tokenize(text,
+                                                                delimiters))
+                             == std::vector<Int>{ 15, 14, 30, 32 }), true);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // StringAlgorithmTestFixture.
+
+    inline void StringAlgorithmTestFixture
+    ::Fill(char character) noexcept
+    {
+        for (auto& code_unit : text_)
+        {
+            code_unit = character;
+        }
+    }
+
+    inline void StringAlgorithmTestFixture
+    ::Place(Int offset, Immutable<StringView> characters) noexcept
+    {
+        auto code_units = characters.GetCodeUnits();
+
+        for (auto index = Int{ 0 }; index < ToInt(code_units.GetCount());
+             ++index)
+        {
+            text_[offset + index] = static_cast<char>(
+                code_units[Memory::ToBytes(index)]);
+        }
+    }
+
+    [[nodiscard]] inline StringView StringAlgorithmTestFixture
+    ::GetText(Int offset, Int count) const noexcept
+    {
+        auto data = Memory::ToBytePtr(text_ + offset);
+
+        return StringView{ Memory::MakeByteSpan(data,
+                                                Memory::ToBytes(count)) };
+    }
+
+    [[nodiscard]] inline StringView StringAlgorithmTestFixture
+    ::GetText() const noexcept
+    {
+        return GetText(0, kTextSize);
+    }
+
+    template <Int TSize>
+    [[nodiscard]] inline StringView StringAlgorithmTestFixture
+    ::ViewOf(const char (&characters)[TSize]) noexcept
+    {
+        auto data = Memory::ToBytePtr(characters);
+
+        return StringView{ Memory::MakeByteSpan(data,
+                                                Memory::ToBytes(TSize - 1)) };
+    }
+
+    [[nodiscard]] inline Int StringAlgorithmTestFixture
+    ::IndexOf(Immutable<StringView> string_view,
+              Immutable<StringView> pattern) noexcept
+    {
+        auto result = Strings::Find(string_view, pattern);
+
+        return ToInt(string_view.GetCodeUnits().GetCount())
+             - ToInt(result.GetCodeUnits().GetCount());
+    }
+
+    [[nodiscard]] inline std::vector<Int> StringAlgorithmTestFixture
+    ::CountsOf(SplitRange range) noexcept
+    {
+        auto counts = std::vector<Int>{};
+
+        for (; !range.IsEmpty(); range = range.PopFront())
+        {
+            counts.emplace_back(
+                ToInt(range.GetFront().GetCodeUnits().GetCount()));
+        }
+
+        return counts;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,150 @@
+/// \file string_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/core/strings/string_view.h"
+#include "syntropy/core/strings/string.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* STRING TEST FIXTURE                                                  */
+    /************************************************************************/
+
+    /// \brief String test fixture.
+    struct StringTestFixture
+    {
+        /// \brief Characters strings are made of.
+        char characters_[33] = "abcdefghijklmnopqrstuvwxyz012345";
+
+        /// \brief Get a view to the first count characters.
+        [[nodiscard]] StringView
+        GetView(Int count) const noexcept
+        {
+            auto data = Memory::ToBytePtr(characters_);
+
+            return StringView{ Memory::MakeByteSpan(data,
+                                                    Memory::ToBytes(count)) };
+        }
+
+        /// \brief Check whether a string holds the first count characters.
+        [[nodiscard]] Bool
+        Holds(Immutable<String> string, Int count) const noexcept
+        {
+            return ViewOf(string) == GetView(count);
+        }
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& string_unit_test
+        = MakeAutoUnitTest<StringTestFixture>(u8"string.strings.core.syntropy")
+
+    .TestCase(u8"Strings up to kInlineCount code-units are stored inline.",
+              [](auto& fixture)
+    {
+        auto string_22 = String{ fixture.GetView(22) };
+        auto string_23 = String{ fixture.GetView(23) };
+        auto string_24 = String{ fixture.GetView(24) };
+
+        SYNTROPY_UNIT_EQUAL(String::kInlineCount, 23);
+
+        SYNTROPY_UNIT_EQUAL(string_22.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(string_23.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(string_24.IsInline(), false);
+
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(string_22, 22), true);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(string_23, 23), true);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(string_24, 24), true);
+    })
+
+    .TestCase(u8"Empty strings are stored inline.", [](auto& fixture)
+    {
+        auto string = String{ fixture.GetView(0) };
+
+        SYNTROPY_UNIT_EQUAL(string.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(ToInt(string.GetCodeUnits().GetCount()), 0);
+        SYNTROPY_UNIT_EQUAL(String{}.IsInline(), true);
+    })
+
+    .TestCase(u8"Assigning a short string to a long one moves the "
+              u8"code-units inline.", [](auto& fixture)
+    {
+        auto string = String{ fixture.GetView(24) };
+
+        string = String{ fixture.GetView(23) };
+
+        SYNTROPY_UNIT_EQUAL(string.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(string, 23), true);
+
+        auto short_string = String{ fixture.GetView(22) };
+
+        string = String{ fixture.GetView(32) };
+        string = short_string;
+
+        SYNTROPY_UNIT_EQUAL(string.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(string, 22), true);
+    })
+
+    .TestCase(u8"Assigning a long string to a short one moves the "
+              u8"code-units out-of-line.", [](auto& fixture)
+    {
+        auto string = String{ fixture.GetView(23) };
+
+        string = String{ fixture.GetView(24) };
+
+        SYNTROPY_UNIT_EQUAL(string.IsInline(), false);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(string, 24), true);
+
+        auto long_string = String{ fixture.GetView(32) };
+
+        string = String{ fixture.GetView(22) };
+        string = long_string;
+
+        SYNTROPY_UNIT_EQUAL(string.IsInline(), false);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(string, 32), true);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(long_string, 32), true);
+    })
+
+    .TestCase(u8"Moving a string leaves the source empty and inline.",
+              [](auto& fixture)
+    {
+        auto long_string = String{ fixture.GetView(24) };
+        auto data = long_string.GetCodeUnits().GetData();
+
+        auto moved_long_string = Move(long_string);
+
+        SYNTROPY_UNIT_EQUAL(moved_long_string.GetCodeUnits().GetData()
+                            == data, true);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(moved_long_string, 24), true);
+        SYNTROPY_UNIT_EQUAL(long_string.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(ToInt(long_string.GetCodeUnits().GetCount()), 0);
+
+        auto short_string = String{ fixture.GetView(23) };
+
+        auto moved_short_string = Move(short_string);
+
+        SYNTROPY_UNIT_EQUAL(moved_short_string.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.Holds(moved_short_string, 23), true);
+        SYNTROPY_UNIT_EQUAL(short_string.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(ToInt(short_string.GetCodeUnits().GetCount()),
+                            0);
+    });
+
+}
+
+// ===========================================================================
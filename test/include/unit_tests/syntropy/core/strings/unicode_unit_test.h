@@ -0,0 +1,317 @@
+/// \file unicode_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <cstdint>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/core/strings/unicode.h"
+
+#include "syntropy/hal/hal_unicode.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* UNICODE TEST FIXTURE                                                 */
+    /************************************************************************/
+
+    /// \brief Unicode test fixture.
+    struct UnicodeTestFixture
+    {
+        /// \brief A sequence of up to 4 code-units.
+        struct Sequence
+        {
+            /// \brief Code-units.
+            std::uint8_t code_units_[4];
+
+            /// \brief Number of code-units.
+            Int count_;
+        };
+
+        /// \brief Result of validating a sequence with every kernel.
+        enum class Validity
+        {
+            /// \brief Every kernel rejects the sequence.
+            kInvalid,
+
+            /// \brief Every kernel accepts the sequence.
+            kValid,
+
+            /// \brief Kernels disagree.
+            kMismatch,
+        };
+
+        /// \brief Number of code-units in a vector lane.
+        static constexpr Int kLaneSize = 32;
+
+        /// \brief Number of code-units in the buffer.
+        static constexpr Int kBufferSize = 3 * kLaneSize;
+
+        /// \brief Well-formed sequences at the boundaries of each row of
+        ///        Table 3-7 of the Unicode standard.
+        static constexpr Sequence kWellFormed[] =
+        {
+            { { 0x00 }, 1 },
+            { { 0x7F }, 1 },
+            { { 0xC2, 0x80 }, 2 },
+            { { 0xDF, 0xBF }, 2 },
+            { { 0xE0, 0xA0, 0x80 }, 3 },
+            { { 0xE0, 0xBF, 0xBF }, 3 },
+            { { 0xE1, 0x80, 0x80 }, 3 },
+            { { 0xEC, 0xBF, 0xBF }, 3 },
+            { { 0xED, 0x80, 0x80 }, 3 },
+            { { 0xED, 0x9F, 0xBF }, 3 },
+            { { 0xEE, 0x80, 0x80 }, 3 },
+            { { 0xEF, 0xBF, 0xBF }, 3 },
+            { { 0xF0, 0x90, 0x80, 0x80 }, 4 },
+            { { 0xF0, 0xBF, 0xBF, 0xBF }, 4 },
+            { { 0xF1, 0x80, 0x80, 0x80 }, 4 },
+            { { 0xF3, 0xBF, 0xBF, 0xBF }, 4 },
+            { { 0xF4, 0x80, 0x80, 0x80 }, 4 },
+            { { 0xF4, 0x8F, 0xBF, 0xBF }, 4 },
+        };
+
+        /// \brief Ill-formed sequences right outside each row of Table 3-7
+        ///        of the Unicode standard.
+        static constexpr Sequence kIllFormed[] =
+        {
+            { { 0x80 }, 1 },
+            { { 0xBF }, 1 },
+            { { 0xC0, 0x80 }, 2 },
+            { { 0xC1, 0xBF }, 2 },
+            { { 0xC2, 0x7F }, 2 },
+            { { 0xDF, 0xC0 }, 2 },
+            { { 0xE0, 0x9F, 0xBF }, 3 },
+            { { 0xE1, 0x7F, 0x80 }, 3 },
+            { { 0xEC, 0xBF, 0xC0 }, 3 },
+            { { 0xED, 0xA0, 0x80 }, 3 },
+            { { 0xED, 0xBF, 0xBF }, 3 },
+            { { 0xEF, 0xC0, 0x80 }, 3 },
+            { { 0xF0, 0x8F, 0xBF, 0xBF }, 4 },
+            { { 0xF3, 0xBF, 0xBF, 0xC0 }, 4 },
+            { { 0xF4, 0x90, 0x80, 0x80 }, 4 },
+            { { 0xF5, 0x80, 0x80, 0x80 }, 4 },
+            { { 0xFF }, 1 },
+        };
+
+        /// \brief Scratch buffer sequences are placed in.
+        std::uint8_t buffer_[kBufferSize];
+
+        /// \brief Fill the buffer with ASCII code-units, place a sequence
+        ///        at given offset and get the first count code-units.
+        [[nodiscard]] Memory::ByteSpan
+        Place(Immutable<Sequence> sequence, Int offset, Int count) noexcept;
+
+        /// \brief Validate code-units with both the portable kernel and
+        ///        the one selected for the host.
+        [[nodiscard]] static Validity
+        Validate(Immutable<Memory::ByteSpan> code_units) noexcept;
+
+        /// \brief Count the number of offsets a sequence can be placed at,
+        ///        within the buffer, for which validation doesn't match
+        ///        the expected result.
+        [[nodiscard]] Int
+        CountFailures(Immutable<Sequence> sequence,
+                      Validity expected) noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& unicode_unit_test
+        = MakeAutoUnitTest<UnicodeTestFixture>(
+            u8"unicode.strings.core.syntropy")
+
+    .TestCase(u8"Well-formed sequences at the boundaries of Table 3-7 are "
+              u8"accepted by every kernel, at any offset.", [](auto& fixture)
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto&& sequence : fixture.kWellFormed)
+        {
+            failure_count += fixture.CountFailures(
+                sequence, UnicodeTestFixture::Validity::kValid);
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    })
+
+    .TestCase(u8"Ill-formed sequences right outside Table 3-7 are rejected "
+              u8"by every kernel, at any offset.", [](auto& fixture)
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto&& sequence : fixture.kIllFormed)
+        {
+            failure_count += fixture.CountFailures(
+                sequence, UnicodeTestFixture::Validity::kInvalid);
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    })
+
+    .TestCase(u8"Sequences truncated by the end of the code-units are "
+              u8"rejected by every kernel, across the lane boundary.",
+              [](auto& fixture)
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto&& sequence : fixture.kWellFormed)
+        {
+            // Cut the sequence after each of its code-units, such that the
+            // code-units end right after the lane boundary.
+
+            for (auto count = Int{ 1 }; count < sequence.count_; ++count)
+            {
+                auto offset = fixture.kLaneSize + 1 - count;
+
+                auto code_units = fixture.Place(sequence,
+                                                offset,
+                                                offset + count);
+
+                if (fixture.Validate(code_units)
+                    != UnicodeTestFixture::Validity::kInvalid)
+                {
+                    ++failure_count;
+                }
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    })
+
+    .TestCase(u8"Sequences interrupted by an ASCII code-unit are rejected "
+              u8"by every kernel, across the lane boundary.",
+              [](auto& fixture)
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto&& sequence : fixture.kWellFormed)
+        {
+            for (auto count = Int{ 1 }; count < sequence.count_; ++count)
+            {
+                // Only the first count code-units are placed before the
+                // lane boundary, the rest is replaced by ASCII.
+
+                auto truncated = sequence;
+
+                truncated.count_ = count;
+
+                auto offset = fixture.kLaneSize - count;
+
+                auto code_units = fixture.Place(truncated,
+                                                offset,
+                                                fixture.kBufferSize);
+
+                if (fixture.Validate(code_units)
+                    != UnicodeTestFixture::Validity::kInvalid)
+                {
+                    ++failure_count;
+                }
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    })
+
+    .TestCase(u8"Code-point and UTF-16 counts match the portable kernel.",
+              [](auto& fixture)
+    {
+        auto mismatch_count = Int{ 0 };
+
+        for (auto&& sequence : fixture.kWellFormed)
+        {
+            for (auto offset = Int{ 0 };
+                 offset + sequence.count_ <= fixture.kBufferSize;
+                 ++offset)
+            {
+                auto code_units = fixture.Place(sequence,
+                                                offset,
+                                                fixture.kBufferSize);
+
+                if ((HAL::Unicode::CountCodePoints(code_units)
+                     != HAL::Unicode::Generic::CountCodePoints(code_units))
+                    || (HAL::Unicode::CountUTF16(code_units)
+                        != HAL::Unicode::Generic::CountUTF16(code_units))
+                    || (HAL::Unicode::CountASCII(code_units)
+                        != HAL::Unicode::Generic::CountASCII(code_units)))
+                {
+                    ++mismatch_count;
+                }
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(mismatch_count, 0);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // UnicodeTestFixture.
+
+    [[nodiscard]] inline Memory::ByteSpan UnicodeTestFixture
+    ::Place(Immutable<Sequence> sequence, Int offset, Int count) noexcept
+    {
+        for (auto& code_unit : buffer_)
+        {
+            code_unit = 'a';
+        }
+
+        for (auto index = Int{ 0 }; index < sequence.count_; ++index)
+        {
+            buffer_[offset + index] = sequence.code_units_[index];
+        }
+
+        return Memory::MakeByteSpan(Memory::ToBytePtr(buffer_),
+                                    Memory::ToBytes(count));
+    }
+
+    [[nodiscard]] inline UnicodeTestFixture::Validity UnicodeTestFixture
+    ::Validate(Immutable<Memory::ByteSpan> code_units) noexcept
+    {
+        auto is_valid = HAL::Unicode::IsValidUTF8(code_units);
+
+        if (is_valid != HAL::Unicode::Generic::IsValidUTF8(code_units))
+        {
+            return Validity::kMismatch;
+        }
+
+        return is_valid ? Validity::kValid : Validity::kInvalid;
+    }
+
+    [[nodiscard]] inline Int UnicodeTestFixture
+    ::CountFailures(Immutable<Sequence> sequence, Validity expected) noexcept
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto offset = Int{ 0 };
+             offset + sequence.count_ <= kBufferSize;
+             ++offset)
+        {
+            auto code_units = Place(sequence, offset, kBufferSize);
+
+            if (Validate(code_units) != expected)
+            {
+                ++failure_count;
+            }
+        }
+
+        return failure_count;
+    }
+
+}
+
+// ===========================================================================
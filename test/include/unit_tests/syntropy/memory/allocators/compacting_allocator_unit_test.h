@@ -0,0 +1,317 @@
+/// \file compacting_allocator_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <vector>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/compacting_allocator.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* COMPACTING ALLOCATOR TEST FIXTURE                                    */
+    /************************************************************************/
+
+    /// \brief Compacting allocator test fixture.
+    struct CompactingAllocatorTestFixture
+    {
+        /// \brief Type of the allocator under test.
+        using TAllocator = Memory::CompactingAllocator;
+
+        /// \brief Type of a handle.
+        using THandle = Memory::CompactingAllocator::THandle;
+
+        /// \brief Maximum amount of memory for blocks.
+        static constexpr Int kCapacity = 1 << 20;
+
+        /// \brief Maximum number of live blocks.
+        static constexpr Int kHandleCount = 1024;
+
+        /// \brief Size of each block. Headers take another granule.
+        static constexpr Int kBlockSize = 48;
+
+        /// \brief Size of each block, including its header.
+        static constexpr Int kBlockExtent
+            = kBlockSize + Memory::CompactingAllocator::kGranularity;
+
+        /// \brief Number of blocks allocated by each test case.
+        static constexpr Int kBlockCount = 8;
+
+        /// \brief Allocate count blocks, each filled with its own index.
+        [[nodiscard]] static std::vector<THandle>
+        AllocateFilled(Mutable<TAllocator> allocator, Int count) noexcept;
+
+        /// \brief Count handles that are either invalid or whose block is
+        ///        not filled with their own index. Empty handles are
+        ///        skipped.
+        [[nodiscard]] static Int
+        CountFailures(Immutable<TAllocator> allocator,
+                      Immutable<std::vector<THandle>> handles) noexcept;
+
+        /// \brief Run compaction steps until a cycle completes.
+        ///
+        /// \return Returns the number of steps performed.
+        static Int
+        CompactAll(Mutable<TAllocator> allocator) noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& compacting_allocator_unit_test
+        = MakeAutoUnitTest<CompactingAllocatorTestFixture>(
+            u8"compacting_allocator.allocators.memory.syntropy")
+
+    .TestCase(u8"Empty blocks and blocks exceeding the granularity "
+              u8"alignment are not allocated.", [](auto& fixture)
+    {
+        auto allocator = CompactingAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kCapacity), fixture.kHandleCount };
+
+        auto empty = allocator.Allocate(Memory::ToBytes(0),
+                                        Memory::ToAlignment(16));
+
+        auto overaligned = allocator.Allocate(
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(32));
+
+        SYNTROPY_UNIT_EQUAL(Bool{ empty }, false);
+        SYNTROPY_UNIT_EQUAL(Bool{ overaligned }, false);
+    })
+
+    .TestCase(u8"Handles to deallocated blocks are invalid, even after "
+              u8"their entry is reused.", [](auto& fixture)
+    {
+        auto allocator = CompactingAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kCapacity), fixture.kHandleCount };
+
+        auto handles = fixture.AllocateFilled(allocator, 2);
+
+        auto stale = handles[0];
+
+        allocator.Deallocate(stale);
+
+        handles[0] = allocator.Allocate(Memory::ToBytes(fixture.kBlockSize),
+                                        Memory::ToAlignment(16));
+
+        SYNTROPY_UNIT_EQUAL(allocator.IsValid(stale), false);
+        SYNTROPY_UNIT_EQUAL(allocator.IsValid(handles[0]), true);
+        SYNTROPY_UNIT_EQUAL(handles[0] == stale, false);
+        SYNTROPY_UNIT_EQUAL(allocator.IsValid(handles[1]), true);
+    })
+
+    .TestCase(u8"Compaction slides live blocks over holes, preserving "
+              u8"their handles and content.", [](auto& fixture)
+    {
+        auto allocator = CompactingAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kCapacity), fixture.kHandleCount };
+
+        auto handles = fixture.AllocateFilled(allocator, fixture.kBlockCount);
+
+        auto first = allocator.Resolve(handles[0]).GetData();
+
+        for (auto index = Int{ 0 }; index < fixture.kBlockCount; index += 2)
+        {
+            allocator.Deallocate(handles[index]);
+
+            handles[index] = {};
+        }
+
+        auto live_size = Memory::ToBytes(fixture.kBlockCount / 2
+                                         * fixture.kBlockExtent);
+
+        SYNTROPY_UNIT_EQUAL(allocator.GetAllocatedSize()
+                            == Memory::ToBytes(fixture.kBlockCount / 2
+                                               * fixture.kBlockSize), true);
+        SYNTROPY_UNIT_EQUAL(allocator.GetUsedSize() > live_size, true);
+
+        // Small budgets spread the cycle across many steps.
+
+        SYNTROPY_UNIT_EQUAL(fixture.CompactAll(allocator) > 1, true);
+
+        SYNTROPY_UNIT_EQUAL(allocator.GetUsedSize() == live_size, true);
+        SYNTROPY_UNIT_EQUAL(allocator.Resolve(handles[1]).GetData() == first,
+                            true);
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, handles), 0);
+    })
+
+    .TestCase(u8"Pinned blocks are not moved by compaction, until they are "
+              u8"unpinned.", [](auto& fixture)
+    {
+        auto allocator = CompactingAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kCapacity), fixture.kHandleCount };
+
+        auto handles = fixture.AllocateFilled(allocator, 4);
+
+        allocator.Deallocate(handles[0]);
+
+        handles[0] = {};
+
+        auto pinned = allocator.Pin(handles[2]);
+
+        fixture.CompactAll(allocator);
+
+        // The gap left by the block slid before the pinned one is kept
+        // until the next cycle.
+
+        SYNTROPY_UNIT_EQUAL(allocator.Resolve(handles[2]).GetData()
+                            == pinned.GetData(), true);
+        SYNTROPY_UNIT_EQUAL(allocator.GetUsedSize()
+                            == Memory::ToBytes(4 * fixture.kBlockExtent),
+                            true);
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, handles), 0);
+
+        allocator.Unpin(handles[2]);
+
+        fixture.CompactAll(allocator);
+
+        SYNTROPY_UNIT_EQUAL(allocator.Resolve(handles[2]).GetData()
+                            < pinned.GetData(), true);
+        SYNTROPY_UNIT_EQUAL(allocator.GetUsedSize()
+                            == Memory::ToBytes(3 * fixture.kBlockExtent),
+                            true);
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, handles), 0);
+    })
+
+    .TestCase(u8"Exhausted allocators compact before giving up.",
+              [](auto& fixture)
+    {
+        auto page_size = ToInt(VirtualMemory::GetPageSize());
+
+        auto allocator = CompactingAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(page_size), page_size };
+
+        auto block_count = page_size / fixture.kBlockExtent;
+
+        auto handles = fixture.AllocateFilled(allocator, block_count);
+
+        auto exhausted = allocator.Allocate(
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(16));
+
+        SYNTROPY_UNIT_EQUAL(Bool{ exhausted }, false);
+
+        // Holes before the last block are reclaimed only by compaction.
+
+        for (auto index = Int{ 0 }; index < block_count - 1; index += 2)
+        {
+            allocator.Deallocate(handles[index]);
+
+            handles[index] = {};
+        }
+
+        auto reclaimed = allocator.Allocate(
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(16));
+
+        SYNTROPY_UNIT_EQUAL(allocator.IsValid(reclaimed), true);
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, handles), 0);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // CompactingAllocatorTestFixture.
+
+    [[nodiscard]] inline auto CompactingAllocatorTestFixture
+    ::AllocateFilled(Mutable<TAllocator> allocator, Int count) noexcept
+        -> std::vector<THandle>
+    {
+        auto handles = std::vector<THandle>{};
+
+        for (auto index = Int{ 0 }; index < count; ++index)
+        {
+            auto handle = allocator.Allocate(Memory::ToBytes(kBlockSize),
+                                             Memory::ToAlignment(16));
+
+            if (handle)
+            {
+                auto block = allocator.Resolve(handle);
+
+                for (auto offset = Int{ 0 }; offset < kBlockSize; ++offset)
+                {
+                    block[Memory::ToBytes(offset)] = Memory::ToByte(index);
+                }
+            }
+
+            handles.emplace_back(handle);
+        }
+
+        return handles;
+    }
+
+    [[nodiscard]] inline Int CompactingAllocatorTestFixture
+    ::CountFailures(Immutable<TAllocator> allocator,
+                    Immutable<std::vector<THandle>> handles) noexcept
+    {
+        auto failure_count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < Int(handles.size()); ++index)
+        {
+            auto& handle = handles[index];
+
+            if (!handle)
+            {
+                continue;
+            }
+
+            if (!allocator.IsValid(handle))
+            {
+                ++failure_count;
+                continue;
+            }
+
+            auto block = allocator.Resolve(handle);
+
+            if (block.GetCount() != Memory::ToBytes(kBlockSize))
+            {
+                ++failure_count;
+            }
+
+            for (auto offset = Int{ 0 }; offset < ToInt(block.GetCount());
+                 ++offset)
+            {
+                if (block[Memory::ToBytes(offset)] != Memory::ToByte(index))
+                {
+                    ++failure_count;
+                    break;
+                }
+            }
+        }
+
+        return failure_count;
+    }
+
+    inline Int CompactingAllocatorTestFixture
+    ::CompactAll(Mutable<TAllocator> allocator) noexcept
+    {
+        auto step_count = Int{ 1 };
+
+        while (!allocator.Compact(Memory::ToBytes(kBlockExtent)))
+        {
+            ++step_count;
+        }
+
+        return step_count;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,238 @@
+/// \file concurrent_pool_allocator_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/system_allocator.h"
+#include "syntropy/memory/allocators/concurrent_pool_allocator.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* CONCURRENT POOL ALLOCATOR TEST FIXTURE                               */
+    /************************************************************************/
+
+    /// \brief Concurrent pool allocator test fixture.
+    struct ConcurrentPoolAllocatorTestFixture
+    {
+        /// \brief Type of the allocator under test.
+        using TAllocator
+            = Memory::ConcurrentPoolAllocator<Memory::SystemAllocator>;
+
+        /// \brief Size of each block.
+        static constexpr Int kBlockSize = 64;
+
+        /// \brief Size of each chunk, small enough to grow the pool
+        ///        concurrently.
+        static constexpr Int kChunkSize = 4096;
+
+        /// \brief Number of threads hammering the allocator.
+        static constexpr Int kThreadCount = 8;
+
+        /// \brief Number of rounds performed by each thread.
+        static constexpr Int kRoundCount = 200;
+
+        /// \brief Number of blocks allocated by each thread, each round.
+        static constexpr Int kBlockCount = 256;
+
+        /// \brief Allocate and deallocate blocks from many threads at once,
+        ///        stamping each block, and count blocks that were either
+        ///        not allocated or handed to more than one thread.
+        [[nodiscard]] static Int
+        Stress(Mutable<TAllocator> allocator) noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& concurrent_pool_allocator_unit_test
+        = MakeAutoUnitTest<ConcurrentPoolAllocatorTestFixture>(
+            u8"concurrent_pool_allocator.allocators.memory.syntropy")
+
+    .TestCase(u8"Blocks exceeding the pool size or alignment are not "
+              u8"allocated.", [](auto& fixture)
+    {
+        auto allocator = ConcurrentPoolAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(16),
+            Memory::ToBytes(fixture.kChunkSize),
+            0 };
+
+        auto oversized = allocator.Allocate(
+            Memory::ToBytes(fixture.kBlockSize + 1),
+            Memory::ToAlignment(16));
+
+        auto overaligned = allocator.Allocate(
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(32));
+
+        SYNTROPY_UNIT_EQUAL(oversized.GetData() == nullptr, true);
+        SYNTROPY_UNIT_EQUAL(overaligned.GetData() == nullptr, true);
+    })
+
+    .TestCase(u8"Blocks are distinct, aligned and reused after being "
+              u8"deallocated.", [](auto& fixture)
+    {
+        auto allocator = ConcurrentPoolAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(16),
+            Memory::ToBytes(fixture.kChunkSize),
+            0 };
+
+        auto blocks = std::vector<Memory::RWByteSpan>{};
+
+        auto failure_count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < fixture.kBlockCount; ++index)
+        {
+            auto block = allocator.Allocate(
+                Memory::ToBytes(fixture.kBlockSize),
+                Memory::ToAlignment(16));
+
+            if (!block.GetData()
+                || !Memory::IsAlignedTo(block.GetData(),
+                                        Memory::ToAlignment(16)))
+            {
+                ++failure_count;
+            }
+
+            for (auto&& other : blocks)
+            {
+                if (other.GetData() == block.GetData())
+                {
+                    ++failure_count;
+                }
+            }
+
+            blocks.emplace_back(block);
+        }
+
+        auto last = blocks.back();
+
+        allocator.Deallocate(last, Memory::ToAlignment(16));
+
+        auto reused = allocator.Allocate(Memory::ToBytes(fixture.kBlockSize),
+                                         Memory::ToAlignment(16));
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+        SYNTROPY_UNIT_EQUAL(reused.GetData() == last.GetData(), true);
+    })
+
+    .TestCase(u8"Blocks are never handed to more than one thread at once, "
+              u8"without magazines.", [](auto& fixture)
+    {
+        auto allocator = ConcurrentPoolAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(16),
+            Memory::ToBytes(fixture.kChunkSize),
+            0 };
+
+        SYNTROPY_UNIT_EQUAL(fixture.Stress(allocator), 0);
+    })
+
+    .TestCase(u8"Blocks are never handed to more than one thread at once, "
+              u8"with magazines.", [](auto& fixture)
+    {
+        auto allocator = ConcurrentPoolAllocatorTestFixture::TAllocator{
+            Memory::ToBytes(fixture.kBlockSize),
+            Memory::ToAlignment(16),
+            Memory::ToBytes(fixture.kChunkSize),
+            8 };
+
+        SYNTROPY_UNIT_EQUAL(fixture.Stress(allocator), 0);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // ConcurrentPoolAllocatorTestFixture.
+
+    [[nodiscard]] inline Int ConcurrentPoolAllocatorTestFixture
+    ::Stress(Mutable<TAllocator> allocator) noexcept
+    {
+        auto failure_count = std::atomic<Int>{ 0 };
+
+        auto threads = std::vector<std::thread>{};
+
+        for (auto thread_index = Int{ 0 }; thread_index < kThreadCount;
+             ++thread_index)
+        {
+            threads.emplace_back([&allocator, &failure_count, thread_index]()
+            {
+                auto blocks = std::vector<RWPtr<Int>>{};
+
+                for (auto round = Int{ 0 }; round < kRoundCount; ++round)
+                {
+                    auto stamp = thread_index * kRoundCount + round;
+
+                    for (auto index = Int{ 0 }; index < kBlockCount; ++index)
+                    {
+                        auto block = allocator.Allocate(
+                            Memory::ToBytes(kBlockSize),
+                            Memory::ToAlignment(16));
+
+                        if (block.GetData())
+                        {
+                            auto value = reinterpret_cast<RWPtr<Int>>(
+                                block.GetData());
+
+                            *value = stamp;
+
+                            blocks.emplace_back(value);
+                        }
+                        else
+                        {
+                            ++failure_count;
+                        }
+                    }
+
+                    std::this_thread::yield();
+
+                    // A block shared with another thread loses its stamp.
+
+                    for (auto&& value : blocks)
+                    {
+                        if (*value != stamp)
+                        {
+                            ++failure_count;
+                        }
+
+                        allocator.Deallocate(
+                            Memory::MakeByteSpan(Memory::ToBytePtr(value),
+                                                 Memory::ToBytes(kBlockSize)),
+                            Memory::ToAlignment(16));
+                    }
+
+                    blocks.clear();
+                }
+            });
+        }
+
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+
+        return failure_count.load();
+    }
+
+}
+
+// ===========================================================================
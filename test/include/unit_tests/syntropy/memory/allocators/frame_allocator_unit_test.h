@@ -0,0 +1,171 @@
+/// \file frame_allocator_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/system_allocator.h"
+#include "syntropy/memory/allocators/frame_allocator.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* FRAME ALLOCATOR TEST FIXTURE                                         */
+    /************************************************************************/
+
+    /// \brief Frame allocator test fixture.
+    struct FrameAllocatorTestFixture
+    {
+        /// \brief Type of the allocator under test, in release builds.
+        using TReleaseAllocator
+            = Memory::FrameAllocator<Memory::SystemAllocator,
+                                     2,
+                                     Memory::FrameReleasePolicy>;
+
+        /// \brief Type of the allocator under test, in debug builds.
+        using TCheckedAllocator
+            = Memory::FrameAllocator<Memory::SystemAllocator,
+                                     2,
+                                     Memory::FrameCheckedPolicy>;
+
+        /// \brief Size of each chunk.
+        static constexpr Int kGranularity = 4096;
+
+        /// \brief Size of each block.
+        static constexpr Int kBlockSize = 64;
+
+        /// \brief Fill a block with a value.
+        static void
+        Fill(Immutable<Memory::RWByteSpan> block, Int value) noexcept;
+
+        /// \brief Check whether every byte in a block is equal to a value.
+        [[nodiscard]] static Bool
+        IsFilled(Immutable<Memory::RWByteSpan> block,
+                 Memory::Byte value) noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& frame_allocator_unit_test
+        = MakeAutoUnitTest<FrameAllocatorTestFixture>(
+            u8"frame_allocator.allocators.memory.syntropy")
+
+    .TestCase(u8"Frames retired and started again reuse the same chunks.",
+              [](auto& fixture)
+    {
+        auto allocator = FrameAllocatorTestFixture::TReleaseAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto size = Memory::ToBytes(fixture.kBlockSize);
+        auto alignment = Memory::ToAlignment(16);
+
+        auto first = allocator.Allocate(size, alignment);
+
+        allocator.AdvanceFrame();
+
+        auto second = allocator.Allocate(size, alignment);
+
+        SYNTROPY_UNIT_EQUAL(first.GetData() != second.GetData(), true);
+        SYNTROPY_UNIT_EQUAL(allocator.IsAlive(0), true);
+
+        allocator.AdvanceFrame();
+
+        auto third = allocator.Allocate(size, alignment);
+
+        SYNTROPY_UNIT_EQUAL(allocator.IsAlive(0), false);
+        SYNTROPY_UNIT_EQUAL(third.GetData() == first.GetData(), true);
+        SYNTROPY_UNIT_EQUAL(Memory::IsAlignedTo(third.GetData(), alignment),
+                            true);
+    })
+
+    .TestCase(u8"Release frames leave blocks untouched on deallocation and "
+              u8"retirement.", [](auto& fixture)
+    {
+        auto allocator = FrameAllocatorTestFixture::TReleaseAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto block = allocator.Allocate(Memory::ToBytes(fixture.kBlockSize),
+                                        Memory::ToAlignment(16));
+
+        fixture.Fill(block, 42);
+
+        allocator.Deallocate(block, Memory::ToAlignment(16));
+
+        allocator.AdvanceFrame();
+        allocator.AdvanceFrame();
+
+        SYNTROPY_UNIT_EQUAL(allocator.Owns(block), true);
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(block, Memory::ToByte(42)),
+                            true);
+    })
+
+    .TestCase(u8"Checked frames are filled with the retired pattern once "
+              u8"retired.", [](auto& fixture)
+    {
+        auto allocator = FrameAllocatorTestFixture::TCheckedAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto block = allocator.Allocate(Memory::ToBytes(fixture.kBlockSize),
+                                        Memory::ToAlignment(16));
+
+        fixture.Fill(block, 42);
+
+        allocator.Deallocate(block, Memory::ToAlignment(16));
+        allocator.AdvanceFrame();
+
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(block, Memory::ToByte(42)),
+                            true);
+
+        allocator.AdvanceFrame();
+
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(
+            block,
+            Memory::FrameCheckedPolicy::kRetiredPattern), true);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // FrameAllocatorTestFixture.
+
+    inline void FrameAllocatorTestFixture
+    ::Fill(Immutable<Memory::RWByteSpan> block, Int value) noexcept
+    {
+        for (auto index = Int{ 0 }; index < ToInt(block.GetCount()); ++index)
+        {
+            block[Memory::ToBytes(index)] = Memory::ToByte(value);
+        }
+    }
+
+    [[nodiscard]] inline Bool FrameAllocatorTestFixture
+    ::IsFilled(Immutable<Memory::RWByteSpan> block,
+               Memory::Byte value) noexcept
+    {
+        for (auto index = Int{ 0 }; index < ToInt(block.GetCount()); ++index)
+        {
+            if (block[Memory::ToBytes(index)] != value)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,252 @@
+/// \file numa_arena_allocator_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/math/math.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/numa_arena_allocator.h"
+
+#include "syntropy/virtual_memory/foundation/virtual_memory.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* NUMA ARENA ALLOCATOR TEST FIXTURE                                    */
+    /************************************************************************/
+
+    /// \brief NUMA arena allocator test fixture.
+    ///
+    /// Test cases hold on any machine: systems with a single node fall
+    /// back to a single sub-arena.
+    struct NumaArenaAllocatorTestFixture
+    {
+        /// \brief Size of each chunk.
+        static constexpr Int kGranularity = 1 << 16;
+
+        /// \brief Number of blocks allocated by each test case.
+        static constexpr Int kBlockCount = 256;
+
+        /// \brief Size of each block.
+        static constexpr Int kBlockSize = 200;
+
+        /// \brief Number of threads allocating concurrently.
+        static constexpr Int kThreadCount = 4;
+
+        /// \brief Allocate kBlockCount blocks on a node, or on the node of
+        ///        the calling thread if node is negative, and count blocks
+        ///        that are either empty, misaligned, not owned by the
+        ///        allocator or overlapping the previous one.
+        [[nodiscard]] static Int
+        CountFailures(Mutable<Memory::NumaArenaAllocator> allocator,
+                      Int node,
+                      Mutable<std::vector<Memory::RWByteSpan>> blocks)
+            noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& numa_arena_allocator_unit_test
+        = MakeAutoUnitTest<NumaArenaAllocatorTestFixture>(
+            u8"numa_arena_allocator.allocators.memory.syntropy")
+
+    .TestCase(u8"Node queries are consistent with the number of "
+              u8"sub-arenas.", [](auto& fixture)
+    {
+        auto allocator = Memory::NumaArenaAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto node_count = VirtualMemory::GetNodeCount();
+        auto current_node = VirtualMemory::GetCurrentNode();
+
+        SYNTROPY_UNIT_EQUAL(node_count >= 1, true);
+        SYNTROPY_UNIT_EQUAL((current_node >= 0)
+                            && (current_node < node_count), true);
+        SYNTROPY_UNIT_EQUAL(allocator.GetArenaCount(),
+                            Math::Min(node_count,
+                                      Memory::NumaArenaAllocator
+                                      ::kArenaCount));
+    })
+
+    .TestCase(u8"Blocks are aligned, distinct and owned by the allocator, "
+              u8"on the current node and on any explicit node.",
+              [](auto& fixture)
+    {
+        auto allocator = Memory::NumaArenaAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto blocks = std::vector<Memory::RWByteSpan>{};
+
+        // Nodes exceeding the node count wrap around.
+
+        auto node_count = VirtualMemory::GetNodeCount();
+
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, -1, blocks), 0);
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, 0, blocks), 0);
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator,
+                                                  node_count,
+                                                  blocks), 0);
+    })
+
+    .TestCase(u8"Blocks larger than the granularity get a chunk of their "
+              u8"own.", [](auto& fixture)
+    {
+        auto allocator = Memory::NumaArenaAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto size = Memory::ToBytes(4 * fixture.kGranularity);
+
+        auto block = allocator.Allocate(size, Memory::ToAlignment(4096));
+
+        SYNTROPY_UNIT_EQUAL(block.GetCount() == size, true);
+        SYNTROPY_UNIT_EQUAL(Memory::IsAlignedTo(block.GetData(),
+                                                Memory::ToAlignment(4096)),
+                            true);
+        SYNTROPY_UNIT_EQUAL(allocator.Owns(block), true);
+    })
+
+    .TestCase(u8"Deallocating a block does nothing, while deallocating "
+              u8"everything releases every chunk.", [](auto& fixture)
+    {
+        auto allocator = Memory::NumaArenaAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto blocks = std::vector<Memory::RWByteSpan>{};
+
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, -1, blocks), 0);
+
+        allocator.Deallocate(blocks.front(), Memory::ToAlignment(8));
+
+        SYNTROPY_UNIT_EQUAL(allocator.Owns(blocks.front()), true);
+
+        allocator.DeallocateAll();
+
+        SYNTROPY_UNIT_EQUAL(allocator.Owns(blocks.front()), false);
+        SYNTROPY_UNIT_EQUAL(allocator.Owns(blocks.back()), false);
+
+        blocks.clear();
+
+        SYNTROPY_UNIT_EQUAL(fixture.CountFailures(allocator, -1, blocks), 0);
+    })
+
+    .TestCase(u8"Threads allocate concurrently without sharing blocks.",
+              [](auto& fixture)
+    {
+        auto allocator = Memory::NumaArenaAllocator{
+            Memory::ToBytes(fixture.kGranularity) };
+
+        auto failure_counts = std::vector<Int>(fixture.kThreadCount);
+        auto blocks = std::vector<std::vector<Memory::RWByteSpan>>(
+            fixture.kThreadCount);
+
+        auto threads = std::vector<std::thread>{};
+
+        for (auto index = Int{ 0 }; index < fixture.kThreadCount; ++index)
+        {
+            threads.emplace_back([&, index]()
+            {
+                failure_counts[index] = fixture.CountFailures(
+                    allocator, -1, blocks[index]);
+            });
+        }
+
+        for (auto&& thread : threads)
+        {
+            thread.join();
+        }
+
+        auto failure_count = Int{ 0 };
+
+        for (auto&& count : failure_counts)
+        {
+            failure_count += count;
+        }
+
+        // Blocks are tagged with the index of the thread that allocated
+        // them: any block shared with another thread is overwritten.
+
+        for (auto index = Int{ 0 }; index < fixture.kThreadCount; ++index)
+        {
+            for (auto&& block : blocks[index])
+            {
+                block[Memory::ToBytes(0)] = Memory::ToByte(index);
+            }
+        }
+
+        for (auto index = Int{ 0 }; index < fixture.kThreadCount; ++index)
+        {
+            for (auto&& block : blocks[index])
+            {
+                if (block[Memory::ToBytes(0)] != Memory::ToByte(index))
+                {
+                    ++failure_count;
+                }
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(failure_count, 0);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // NumaArenaAllocatorTestFixture.
+
+    [[nodiscard]] inline Int NumaArenaAllocatorTestFixture
+    ::CountFailures(Mutable<Memory::NumaArenaAllocator> allocator,
+                    Int node,
+                    Mutable<std::vector<Memory::RWByteSpan>> blocks)
+        noexcept
+    {
+        auto failure_count = Int{ 0 };
+
+        auto previous = Memory::RWByteSpan{};
+
+        for (auto index = Int{ 0 }; index < kBlockCount; ++index)
+        {
+            auto size = Memory::ToBytes(kBlockSize);
+            auto alignment = Memory::ToAlignment(Int{ 8 } << (index % 4));
+
+            auto block = (node < 0)
+                ? allocator.Allocate(size, alignment)
+                : allocator.Allocate(size, alignment, node);
+
+            auto previous_end = previous.GetData() + previous.GetCount();
+
+            if ((block.GetCount() != size)
+                || !Memory::IsAlignedTo(block.GetData(), alignment)
+                || !allocator.Owns(block)
+                || ((block.GetData() < previous_end)
+                    && (block.GetData() >= previous.GetData())))
+            {
+                ++failure_count;
+            }
+
+            blocks.emplace_back(block);
+
+            previous = block;
+        }
+
+        return failure_count;
+    }
+
+}
+
+// ===========================================================================
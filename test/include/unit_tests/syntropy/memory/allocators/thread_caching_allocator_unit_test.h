@@ -0,0 +1,230 @@
+/// \file thread_caching_allocator_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <thread>
+#include <vector>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+#include "syntropy/memory/allocators/thread_caching_allocator.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* THREAD CACHING ALLOCATOR TEST FIXTURE                                */
+    /************************************************************************/
+
+    /// \brief Thread caching allocator test fixture.
+    struct ThreadCachingAllocatorTestFixture
+    {
+        /// \brief Backing allocator counting the blocks it allocates.
+        struct CountingAllocator : Memory::BaseAllocator
+        {
+            /// \brief Number of blocks allocated so far.
+            Int allocation_count_{ 0 };
+
+            /// \brief Number of blocks deallocated so far.
+            Int deallocation_count_{ 0 };
+
+            [[nodiscard]] Memory::RWByteSpan
+            Allocate(Memory::Bytes size,
+                     Memory::Alignment alignment) noexcept override;
+
+            void
+            Deallocate(Immutable<Memory::RWByteSpan> block,
+                       Memory::Alignment alignment) noexcept override;
+        };
+
+        /// \brief Number of blocks spanning several batches and chunks.
+        static constexpr Int kBlockCount = 4096;
+
+        /// \brief Size of each block.
+        static constexpr Int kBlockSize = 64;
+
+        /// \brief Backing allocator.
+        CountingAllocator backing_;
+
+        /// \brief Executed before each test case.
+        void Before();
+
+        /// \brief Allocate kBlockCount blocks.
+        [[nodiscard]] static std::vector<Memory::RWByteSpan>
+        AllocateBlocks(Mutable<Memory::ThreadCachingAllocator> allocator)
+            noexcept;
+
+        /// \brief Deallocate a set of blocks.
+        static void
+        DeallocateBlocks(Mutable<Memory::ThreadCachingAllocator> allocator,
+                         Immutable<std::vector<Memory::RWByteSpan>> blocks)
+            noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& thread_caching_allocator_unit_test
+        = MakeAutoUnitTest<ThreadCachingAllocatorTestFixture>(
+            u8"thread_caching_allocator.allocators.memory.syntropy")
+
+    .TestCase(u8"Small blocks are refilled in batches carved from chunks "
+              u8"of the backing allocator.", [](auto& fixture)
+    {
+        auto allocator = Memory::ThreadCachingAllocator{ fixture.backing_ };
+
+        auto blocks = fixture.AllocateBlocks(allocator);
+
+        auto chunk_count = fixture.backing_.allocation_count_;
+
+        // Each chunk holds several batches, each batch several blocks.
+
+        SYNTROPY_UNIT_EQUAL((chunk_count > 0)
+                            && (chunk_count * 16 < fixture.kBlockCount),
+                            true);
+
+        fixture.DeallocateBlocks(allocator, blocks);
+    })
+
+    .TestCase(u8"Released blocks are refilled without acquiring new "
+              u8"chunks.", [](auto& fixture)
+    {
+        auto allocator = Memory::ThreadCachingAllocator{ fixture.backing_ };
+
+        auto blocks = fixture.AllocateBlocks(allocator);
+
+        auto chunk_count = fixture.backing_.allocation_count_;
+
+        fixture.DeallocateBlocks(allocator, blocks);
+
+        allocator.Flush();
+
+        blocks = fixture.AllocateBlocks(allocator);
+
+        SYNTROPY_UNIT_EQUAL(fixture.backing_.allocation_count_, chunk_count);
+
+        fixture.DeallocateBlocks(allocator, blocks);
+    })
+
+    .TestCase(u8"Blocks flushed by a thread are refilled by other threads.",
+              [](auto& fixture)
+    {
+        auto allocator = Memory::ThreadCachingAllocator{ fixture.backing_ };
+
+        auto blocks = fixture.AllocateBlocks(allocator);
+
+        auto chunk_count = fixture.backing_.allocation_count_;
+
+        fixture.DeallocateBlocks(allocator, blocks);
+
+        allocator.Flush();
+
+        // Blocks deallocated on the other thread are flushed upon exit.
+
+        auto thread = std::thread([&allocator, &fixture]()
+        {
+            auto blocks = fixture.AllocateBlocks(allocator);
+
+            fixture.DeallocateBlocks(allocator, blocks);
+        });
+
+        thread.join();
+
+        blocks = fixture.AllocateBlocks(allocator);
+
+        SYNTROPY_UNIT_EQUAL(fixture.backing_.allocation_count_, chunk_count);
+
+        fixture.DeallocateBlocks(allocator, blocks);
+    })
+
+    .TestCase(u8"Chunks are returned to the backing allocator upon "
+              u8"destruction.", [](auto& fixture)
+    {
+        {
+            auto allocator
+                = Memory::ThreadCachingAllocator{ fixture.backing_ };
+
+            auto blocks = fixture.AllocateBlocks(allocator);
+
+            fixture.DeallocateBlocks(allocator, blocks);
+        }
+
+        SYNTROPY_UNIT_EQUAL(fixture.backing_.deallocation_count_,
+                            fixture.backing_.allocation_count_);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // ThreadCachingAllocatorTestFixture.
+
+    inline void ThreadCachingAllocatorTestFixture::Before()
+    {
+        backing_.allocation_count_ = 0;
+        backing_.deallocation_count_ = 0;
+    }
+
+    [[nodiscard]] inline std::vector<Memory::RWByteSpan>
+    ThreadCachingAllocatorTestFixture
+    ::AllocateBlocks(Mutable<Memory::ThreadCachingAllocator> allocator)
+        noexcept
+    {
+        auto blocks = std::vector<Memory::RWByteSpan>{};
+
+        for (auto index = Int{ 0 }; index < kBlockCount; ++index)
+        {
+            blocks.emplace_back(allocator.Allocate(
+                Memory::ToBytes(kBlockSize),
+                Memory::ToAlignment(8)));
+        }
+
+        return blocks;
+    }
+
+    inline void ThreadCachingAllocatorTestFixture
+    ::DeallocateBlocks(Mutable<Memory::ThreadCachingAllocator> allocator,
+                       Immutable<std::vector<Memory::RWByteSpan>> blocks)
+        noexcept
+    {
+        for (auto&& block : blocks)
+        {
+            allocator.Deallocate(block, Memory::ToAlignment(8));
+        }
+    }
+
+    // ThreadCachingAllocatorTestFixture :: CountingAllocator.
+
+    [[nodiscard]] inline Memory::RWByteSpan
+    ThreadCachingAllocatorTestFixture::CountingAllocator
+    ::Allocate(Memory::Bytes size, Memory::Alignment alignment) noexcept
+    {
+        ++allocation_count_;
+
+        return Memory::GetSystemAllocator().Allocate(size, alignment);
+    }
+
+    inline void
+    ThreadCachingAllocatorTestFixture::CountingAllocator
+    ::Deallocate(Immutable<Memory::RWByteSpan> block,
+                 Memory::Alignment alignment) noexcept
+    {
+        ++deallocation_count_;
+
+        Memory::GetSystemAllocator().Deallocate(block, alignment);
+    }
+
+}
+
+// ===========================================================================
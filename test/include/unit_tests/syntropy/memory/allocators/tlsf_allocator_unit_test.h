@@ -0,0 +1,218 @@
+/// \file tlsf_allocator_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include <cstdint>
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+
+#include "syntropy/memory/allocators/system_allocator.h"
+#include "syntropy/memory/allocators/tlsf_allocator.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* TLSF ALLOCATOR TEST FIXTURE                                          */
+    /************************************************************************/
+
+    /// \brief TLSF allocator test fixture.
+    struct TLSFAllocatorTestFixture
+    {
+        /// \brief Type of the allocator under test.
+        using TAllocator = Memory::TLSFAllocator<Memory::SystemAllocator>;
+
+        /// \brief Allocator under test.
+        TAllocator allocator_{ Memory::ToBytes(Int{ 1 } << 16) };
+
+        /// \brief Size of the largest free block of a pool no block was
+        ///        allocated from.
+        Int pool_free_size_{ 0 };
+
+        /// \brief Memory reserved by the first pool.
+        Int reserved_size_{ 0 };
+
+        /// \brief Executed before each test case.
+        void Before();
+
+        /// \brief Executed after each test case.
+        void After();
+
+        /// \brief Allocate a block with default alignment.
+        [[nodiscard]] Memory::RWByteSpan
+        Allocate(Int size) noexcept;
+
+        /// \brief Deallocate a block allocated with default alignment.
+        void
+        Deallocate(Immutable<Memory::RWByteSpan> block) noexcept;
+
+        /// \brief Get the number of free blocks.
+        [[nodiscard]] Int
+        GetFreeCount() const noexcept;
+
+        /// \brief Get the size of the largest free block.
+        [[nodiscard]] Int
+        GetLargestFreeSize() const noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& tlsf_allocator_unit_test
+        = MakeAutoUnitTest<TLSFAllocatorTestFixture>(
+            u8"tlsf_allocator.allocators.memory.syntropy")
+
+    .TestCase(u8"Allocating from a free block splits the remainder into a "
+              u8"new free block.", [](auto& fixture)
+    {
+        auto lhs = fixture.Allocate(64);
+        auto rhs = fixture.Allocate(64);
+
+        auto distance = rhs.GetData() - lhs.GetData();
+
+        SYNTROPY_UNIT_EQUAL(fixture.GetFreeCount(), 1);
+        SYNTROPY_UNIT_EQUAL((distance >= 64) && (distance <= 128), true);
+        SYNTROPY_UNIT_EQUAL(fixture.GetLargestFreeSize()
+                            < fixture.pool_free_size_, true);
+
+        fixture.Deallocate(lhs);
+        fixture.Deallocate(rhs);
+    })
+
+    .TestCase(u8"Deallocating a block coalesces it with adjacent free "
+              u8"blocks.", [](auto& fixture)
+    {
+        auto first = fixture.Allocate(100);
+        auto second = fixture.Allocate(200);
+        auto third = fixture.Allocate(300);
+
+        fixture.Deallocate(first);
+
+        SYNTROPY_UNIT_EQUAL(fixture.GetFreeCount(), 2);
+
+        // The third block merges with the trailing free block.
+
+        fixture.Deallocate(third);
+
+        SYNTROPY_UNIT_EQUAL(fixture.GetFreeCount(), 2);
+
+        // The second block merges with both neighbours.
+
+        fixture.Deallocate(second);
+
+        SYNTROPY_UNIT_EQUAL(fixture.GetFreeCount(), 1);
+        SYNTROPY_UNIT_EQUAL(fixture.GetLargestFreeSize(),
+                            fixture.pool_free_size_);
+    })
+
+    .TestCase(u8"Aligned blocks honor their alignment and return the "
+              u8"padding when deallocated.", [](auto& fixture)
+    {
+        constexpr auto kCount = Int{ 8 };
+
+        Memory::RWByteSpan blocks[kCount];
+
+        auto misaligned_count = Int{ 0 };
+
+        for (auto index = Int{ 0 }; index < kCount; ++index)
+        {
+            auto alignment = Memory::ToAlignment(Int{ 16 } << index);
+
+            blocks[index] = fixture.allocator_.Allocate(
+                Memory::ToBytes(24), alignment);
+
+            auto address = reinterpret_cast<std::uintptr_t>(
+                blocks[index].GetData());
+
+            if ((address % (std::uintptr_t{ 16 } << index)) != 0)
+            {
+                ++misaligned_count;
+            }
+        }
+
+        SYNTROPY_UNIT_EQUAL(misaligned_count, 0);
+
+        for (auto index = Int{ 0 }; index < kCount; ++index)
+        {
+            auto alignment = Memory::ToAlignment(Int{ 16 } << index);
+
+            fixture.allocator_.Deallocate(blocks[index], alignment);
+        }
+
+        SYNTROPY_UNIT_EQUAL(fixture.GetFreeCount(), 1);
+        SYNTROPY_UNIT_EQUAL(fixture.GetLargestFreeSize(),
+                            fixture.pool_free_size_);
+    })
+
+    .TestCase(u8"Blocks exceeding the first-level index are not "
+              u8"allocated.", [](auto& fixture)
+    {
+        auto block = fixture.Allocate(Int{ 1 } << 41);
+
+        SYNTROPY_UNIT_EQUAL(block.GetData() == nullptr, true);
+
+        SYNTROPY_UNIT_EQUAL(ToInt(fixture.allocator_.GetStatistics()
+                                  .reserved_size_),
+                            fixture.reserved_size_);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // TLSFAllocatorTestFixture.
+
+    inline void TLSFAllocatorTestFixture::Before()
+    {
+        // Acquire the first pool.
+
+        Deallocate(Allocate(1));
+
+        pool_free_size_ = GetLargestFreeSize();
+
+        reserved_size_ = ToInt(allocator_.GetStatistics().reserved_size_);
+    }
+
+    inline void TLSFAllocatorTestFixture::After()
+    {
+        allocator_.DeallocateAll();
+    }
+
+    [[nodiscard]] inline Memory::RWByteSpan TLSFAllocatorTestFixture
+    ::Allocate(Int size) noexcept
+    {
+        return allocator_.Allocate(Memory::ToBytes(size),
+                                   Memory::MaxAlignment());
+    }
+
+    inline void TLSFAllocatorTestFixture
+    ::Deallocate(Immutable<Memory::RWByteSpan> block) noexcept
+    {
+        allocator_.Deallocate(block, Memory::MaxAlignment());
+    }
+
+    [[nodiscard]] inline Int TLSFAllocatorTestFixture
+    ::GetFreeCount() const noexcept
+    {
+        return allocator_.GetStatistics().free_count_;
+    }
+
+    [[nodiscard]] inline Int TLSFAllocatorTestFixture
+    ::GetLargestFreeSize() const noexcept
+    {
+        return ToInt(allocator_.GetStatistics().largest_free_size_);
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,272 @@
+/// \file inline_buffer_unit_test.h
+///
+/// \author Raffaele D. Facendola - 2021.
+
+#pragma once
+
+#include "syntropy/language/foundation/foundation.h"
+
+#include "syntropy/memory/foundation/byte.h"
+#include "syntropy/memory/foundation/size.h"
+#include "syntropy/memory/foundation/alignment.h"
+#include "syntropy/memory/foundation/byte_span.h"
+#include "syntropy/memory/foundation/inline_buffer.h"
+
+#include "syntropy/memory/allocators/allocator.h"
+
+#include "syntropy/diagnostics/unit_test/unit_test.h"
+
+// ===========================================================================
+
+namespace Syntropy::UnitTest
+{
+    /************************************************************************/
+    /* INLINE BUFFER TEST FIXTURE                                           */
+    /************************************************************************/
+
+    /// \brief Inline buffer test fixture.
+    struct InlineBufferTestFixture
+    {
+        /// \brief Allocator counting the blocks it allocates.
+        struct CountingAllocator : Memory::BaseAllocator
+        {
+            /// \brief Number of blocks allocated so far.
+            Int allocation_count_{ 0 };
+
+            /// \brief Number of blocks deallocated so far.
+            Int deallocation_count_{ 0 };
+
+            [[nodiscard]] Memory::RWByteSpan
+            Allocate(Memory::Bytes size,
+                     Memory::Alignment alignment) noexcept override;
+
+            void
+            Deallocate(Immutable<Memory::RWByteSpan> block,
+                       Memory::Alignment alignment) noexcept override;
+        };
+
+        /// \brief Number of bytes in the inline storage.
+        static constexpr Int kInlineCount = 16;
+
+        /// \brief Type of the buffer under test.
+        using TBuffer = Memory::InlineBuffer<kInlineCount>;
+
+        /// \brief Allocator.
+        CountingAllocator allocator_;
+
+        /// \brief Executed before each test case.
+        void Before();
+
+        /// \brief Fill a buffer with a sequence of increasing bytes,
+        ///        starting from a given value.
+        static void
+        Fill(Mutable<TBuffer> buffer, Int first) noexcept;
+
+        /// \brief Check whether the first count bytes in a buffer are a
+        ///        sequence of increasing bytes, starting from a given value.
+        [[nodiscard]] static Bool
+        IsFilled(Immutable<TBuffer> buffer, Int first, Int count) noexcept;
+    };
+
+    /************************************************************************/
+    /* UNIT TEST                                                            */
+    /************************************************************************/
+
+    inline const auto& inline_buffer_unit_test
+        = MakeAutoUnitTest<InlineBufferTestFixture>(
+            u8"inline_buffer.foundation.memory.syntropy")
+
+    .TestCase(u8"Buffers fitting the inline storage don't allocate.",
+              [](auto& fixture)
+    {
+        {
+            auto buffer = InlineBufferTestFixture::TBuffer{
+                Memory::ToBytes(fixture.kInlineCount), fixture.allocator_ };
+
+            SYNTROPY_UNIT_EQUAL(buffer.IsInline(), true);
+            SYNTROPY_UNIT_EQUAL(fixture.IsFilled(buffer, 0, 0), true);
+        }
+
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.allocation_count_, 0);
+    })
+
+    .TestCase(u8"Buffers exceeding the inline storage or its alignment are "
+              u8"allocated.", [](auto& fixture)
+    {
+        {
+            auto large = InlineBufferTestFixture::TBuffer{
+                Memory::ToBytes(fixture.kInlineCount + 1),
+                fixture.allocator_ };
+
+            auto aligned = InlineBufferTestFixture::TBuffer{
+                Memory::ToBytes(1),
+                Memory::ToAlignment(4096),
+                fixture.allocator_ };
+
+            SYNTROPY_UNIT_EQUAL(large.IsInline(), false);
+            SYNTROPY_UNIT_EQUAL(aligned.IsInline(), false);
+            SYNTROPY_UNIT_EQUAL(fixture.allocator_.allocation_count_, 2);
+        }
+
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.deallocation_count_, 2);
+    })
+
+    .TestCase(u8"Growing past the inline storage moves the content to the "
+              u8"allocator, shrinking moves it back.", [](auto& fixture)
+    {
+        auto buffer = InlineBufferTestFixture::TBuffer{
+            Memory::ToBytes(fixture.kInlineCount), fixture.allocator_ };
+
+        fixture.Fill(buffer, 1);
+
+        buffer.Resize(Memory::ToBytes(4 * fixture.kInlineCount));
+
+        SYNTROPY_UNIT_EQUAL(buffer.IsInline(), false);
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(buffer, 1, fixture.kInlineCount),
+                            true);
+        SYNTROPY_UNIT_EQUAL((buffer[Memory::ToBytes(fixture.kInlineCount)]
+                             == Memory::Byte{ 0 }), true);
+
+        buffer.Resize(Memory::ToBytes(fixture.kInlineCount / 2));
+        buffer.ShrinkToFit();
+
+        SYNTROPY_UNIT_EQUAL(buffer.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(buffer,
+                                             1,
+                                             fixture.kInlineCount / 2),
+                            true);
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.deallocation_count_,
+                            fixture.allocator_.allocation_count_);
+    })
+
+    .TestCase(u8"Copies preserve the content and the storage kind of the "
+              u8"original buffer.", [](auto& fixture)
+    {
+        auto small = InlineBufferTestFixture::TBuffer{
+            Memory::ToBytes(fixture.kInlineCount), fixture.allocator_ };
+
+        auto large = InlineBufferTestFixture::TBuffer{
+            Memory::ToBytes(3 * fixture.kInlineCount), fixture.allocator_ };
+
+        fixture.Fill(small, 10);
+        fixture.Fill(large, 20);
+
+        auto small_copy = small;
+        auto large_copy = large;
+
+        SYNTROPY_UNIT_EQUAL(small_copy.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(small_copy,
+                                             10,
+                                             fixture.kInlineCount),
+                            true);
+
+        SYNTROPY_UNIT_EQUAL(large_copy.IsInline(), false);
+        SYNTROPY_UNIT_EQUAL(large_copy.GetData() != large.GetData(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(large_copy,
+                                             20,
+                                             3 * fixture.kInlineCount),
+                            true);
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.allocation_count_, 2);
+    })
+
+    .TestCase(u8"Moving an allocated buffer acquires its storage, moving an "
+              u8"inline buffer copies its content.", [](auto& fixture)
+    {
+        auto small = InlineBufferTestFixture::TBuffer{
+            Memory::ToBytes(fixture.kInlineCount), fixture.allocator_ };
+
+        auto large = InlineBufferTestFixture::TBuffer{
+            Memory::ToBytes(3 * fixture.kInlineCount), fixture.allocator_ };
+
+        fixture.Fill(small, 10);
+        fixture.Fill(large, 20);
+
+        auto large_data = large.GetData();
+
+        auto small_moved = Move(small);
+        auto large_moved = Move(large);
+
+        SYNTROPY_UNIT_EQUAL(small_moved.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(small_moved,
+                                             10,
+                                             fixture.kInlineCount),
+                            true);
+
+        SYNTROPY_UNIT_EQUAL(large_moved.GetData() == large_data, true);
+        SYNTROPY_UNIT_EQUAL(fixture.IsFilled(large_moved,
+                                             20,
+                                             3 * fixture.kInlineCount),
+                            true);
+
+        SYNTROPY_UNIT_EQUAL(small.GetCount() == Memory::ToBytes(0), true);
+        SYNTROPY_UNIT_EQUAL(large.GetCount() == Memory::ToBytes(0), true);
+        SYNTROPY_UNIT_EQUAL(large.IsInline(), true);
+        SYNTROPY_UNIT_EQUAL(fixture.allocator_.allocation_count_, 1);
+    });
+
+    /************************************************************************/
+    /* IMPLEMENTATION                                                       */
+    /************************************************************************/
+
+    // InlineBufferTestFixture.
+
+    inline void InlineBufferTestFixture::Before()
+    {
+        allocator_.allocation_count_ = 0;
+        allocator_.deallocation_count_ = 0;
+    }
+
+    inline void InlineBufferTestFixture
+    ::Fill(Mutable<TBuffer> buffer, Int first) noexcept
+    {
+        for (auto index = Int{ 0 }; index < ToInt(buffer.GetCount());
+             ++index)
+        {
+            buffer[Memory::ToBytes(index)] = Memory::ToByte(first + index);
+        }
+    }
+
+    [[nodiscard]] inline Bool InlineBufferTestFixture
+    ::IsFilled(Immutable<TBuffer> buffer, Int first, Int count) noexcept
+    {
+        if (ToInt(buffer.GetCount()) < count)
+        {
+            return false;
+        }
+
+        for (auto index = Int{ 0 }; index < count; ++index)
+        {
+            if (buffer[Memory::ToBytes(index)]
+                != Memory::ToByte(first + index))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // InlineBufferTestFixture :: CountingAllocator.
+
+    [[nodiscard]] inline Memory::RWByteSpan
+    InlineBufferTestFixture::CountingAllocator
+    ::Allocate(Memory::Bytes size, Memory::Alignment alignment) noexcept
+    {
+        ++allocation_count_;
+
+        return Memory::GetSystemAllocator().Allocate(size, alignment);
+    }
+
+    inline void
+    InlineBufferTestFixture::CountingAllocator
+    ::Deallocate(Immutable<Memory::RWByteSpan> block,
+                 Memory::Alignment alignment) noexcept
+    {
+        ++deallocation_count_;
+
+        Memory::GetSystemAllocator().Deallocate(block, alignment);
+    }
+
+}
+
+// ===========================================================================
@@ -0,0 +1,22 @@
+/// \file unit_tests.h
+/// \brief Contains the list of all unit tests to run.
+///
+/// \author Raffaele D. Facendola - 2021
+
+#pragma once
+
+#include "unit_tests/syntropy/core/foundation/shared_ptr_unit_test.h"
+
+#include "unit_tests/syntropy/core/strings/label_unit_test.h"
+#include "unit_tests/syntropy/core/strings/string_unit_test.h"
+#include "unit_tests/syntropy/core/strings/string_algorithm_unit_test.h"
+#include "unit_tests/syntropy/core/strings/unicode_unit_test.h"
+
+#include "unit_tests/syntropy/memory/foundation/inline_buffer_unit_test.h"
+
+#include "unit_tests/syntropy/memory/allocators/compacting_allocator_unit_test.h"
+#include "unit_tests/syntropy/memory/allocators/concurrent_pool_allocator_unit_test.h"
+#include "unit_tests/syntropy/memory/allocators/frame_allocator_unit_test.h"
+#include "unit_tests/syntropy/memory/allocators/numa_arena_allocator_unit_test.h"
+#include "unit_tests/syntropy/memory/allocators/tlsf_allocator_unit_test.h"
+#include "unit_tests/syntropy/memory/allocators/thread_caching_allocator_unit_test.h"
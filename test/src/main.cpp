@@ -4,98 +4,73 @@
 /// \author Raffaele D. Facendola - June 2020.
 
 #include <iostream>
-#include <string>
+#include <string_view>
 
 #include "syntropy/language/foundation/foundation.h"
 
-#include "syntropy/language/templates/type_traits.h"
-#include "syntropy/language/templates/sequence.h"
-#include "syntropy/language/templates/ratio.h"
-#include "syntropy/language/templates/math.h"
-#include "syntropy/language/templates/concepts.h"
-#include "syntropy/language/templates/priority.h"
+#include "syntropy/core/strings/string.h"
 
-#include "syntropy/language/preprocessor/macro.h"
+#include "syntropy/diagnostics/unit_test/test_runner.h"
 
-#include "syntropy/language/support/initializer_list.h"
-#include "syntropy/language/support/ignore.h"
-#include "syntropy/language/support/swap.h"
+#include "unit_tests/unit_tests.h"
 
-#include "syntropy/core/support/scope_guard.h"
-#include "syntropy/core/support/visitor.h"
+// ===========================================================================
 
-#include "syntropy/core/concepts/ntuple.h"
-
-#include "syntropy/core/concepts/forward_range.h"
-#include "syntropy/core/concepts/sized_range.h"
-#include "syntropy/core/concepts/bidirectional_range.h"
-#include "syntropy/core/concepts/random_access_range.h"
-#include "syntropy/core/concepts/contiguous_range.h"
-#include "syntropy/core/concepts/reverse_range.h"
-#include "syntropy/core/concepts/zip_range.h"
-
-#include "syntropy/core/foundation/tuple.h"
-#include "syntropy/core/foundation/span.h"
-#include "syntropy/core/foundation/unique_ptr.h"
-
-#include "syntropy/core/reflection/type_id.h"
-
-#include "syntropy/memory/foundation/byte.h"
-#include "syntropy/memory/foundation/address.h"
-#include "syntropy/memory/foundation/size.h"
-#include "syntropy/memory/foundation/alignment.h"
-#include "syntropy/memory/foundation/byte_span.h"
-
-#include "syntropy/memory/allocators/allocator.h"
-#include "syntropy/memory/allocators/system_allocator.h"
+namespace
+{
+    /// \brief Get a view to the code-units in a string.
+    std::string_view
+    ToStringView(Syntropy::Immutable<Syntropy::String> string) noexcept
+    {
+        auto code_units = string.GetCodeUnits();
 
-#include "syntropy/diagnostics/foundation/debugger.h"
-#include "syntropy/diagnostics/foundation/assert.h"
+        auto data = reinterpret_cast<const char*>(code_units.GetData());
+        auto count = Syntropy::ToInt(code_units.GetCount());
 
-#include "syntropy/core/support/event.h"
+        return { data, static_cast<std::size_t>(count) };
+    }
+}
 
-#include "syntropy/core/containers/fix_array.h"
+// ===========================================================================
 
-int main(int argc, char** argv)
+/// \brief Run every unit test and report failures.
+///
+/// \return Returns zero if every test case succeeded, one otherwise.
+int main()
 {
-    std::cout << "Hello Syntropy!\n";
-
-    using namespace Syntropy::Memory::Literals;
-
-    {
-        Syntropy::Int arr[] = { 1, 2, 3 };
-        Syntropy::FixArray<Syntropy::Int, 3> arr2 = { 1,2,3 };
-
-        auto span1 = Syntropy::MakeSpan(arr);
-        auto span2 = Syntropy::MakeSpan(arr);
+    using namespace Syntropy;
 
-        auto span = Syntropy::Ranges::Zip(span1, span2);
+    auto test_runner = UnitTest::TestRunner{};
 
-        using TSpan = Syntropy::Templates::UnqualifiedOf<decltype(span1)>;
+    auto success_count = Int{ 0 };
+    auto failure_count = Int{ 0 };
 
-        static_assert(Syntropy::Ranges::Templates::ForwardRange<TSpan>, "nope!");
-        static_assert(Syntropy::Ranges::Templates::SizedRange<TSpan>, "nope!");
-        static_assert(Syntropy::Ranges::Templates::BidirectionalRange<TSpan>, "nope!");
-        static_assert(Syntropy::Ranges::Templates::RandomAccessRange<TSpan>, "nope!");
-        static_assert(Syntropy::Ranges::Templates::ContiguousRange<TSpan>, "nope!");
+    auto listener = test_runner.OnCaseSuccess(
+        [&success_count](const auto& sender, const auto& event_args)
+    {
+        ++success_count;
+    });
 
-        auto x0 = Syntropy::Ranges::Front(span);
-        auto y0 = Syntropy::Ranges::PopFront(span);
-        auto z0 = Syntropy::Ranges::IsEmpty(span);
-        auto w0 = Syntropy::Ranges::Count(span);
-        auto xx0 = Syntropy::Ranges::Back(span);
-        auto yy0 = Syntropy::Ranges::PopBack(span);
-        auto zz0 = Syntropy::Ranges::At(span, 0);
-        auto ww0 = Syntropy::Ranges::Slice(span, 0, 2);
+    listener += test_runner.OnCaseFailure(
+        [&failure_count](const auto& sender, const auto& event_args)
+    {
+        ++failure_count;
 
-        //for (auto e : span)
-        //{
-        //    std::cout << Syntropy::Sequences::Get<0>(e) << ";" << Syntropy::Sequences::Get<1>(e) << "\n";
-        //}
+        std::cout << ToStringView(event_args.test_suite_) << " - "
+                  << ToStringView(event_args.test_case_) << "\n    "
+                  << ToStringView(event_args.location_.GetFileName())
+                  << "(" << event_args.location_.GetLine() << "): "
+                  << ToStringView(event_args.expression_) << " is "
+                  << ToStringView(event_args.result_) << ", expected "
+                  << ToStringView(event_args.expected_) << "\n";
+    });
 
-        system("pause");
-    }
+    test_runner.Run();
 
-    system("pause");
+    std::cout << success_count << " succeeded, "
+              << failure_count << " failed.\n";
 
+    return (failure_count == 0) ? 0 : 1;
 }
+
+// ===========================================================================